@@ -0,0 +1,658 @@
+/******************************************************************************/
+/*                                                                            */
+/*                  C6502 - PORTABLE 6502 CORE (MAKE6502 API)                 */
+/*                                                                            */
+/******************************************************************************/
+
+/* Plain C replacement for the 32 bit x86 asm generated by make6502.c. It
+ * exports the same interface (m6502.h) with the same context structure and
+ * memory maps, so m6502hlp.c, cpumain.c, the drivers and the savegames don't
+ * see a difference. It's selected by C6502=1 in the makefile (forced by
+ * NO_ASM).
+ *
+ * It behaves like the asm core generated with -6510 (65c02 extensions) and
+ * without -z : opcodes and their operands are fetched directly from the base
+ * pointer, the stack and the vectors are accessed directly in the base too,
+ * and every other access goes through the memory maps, terminated by a region
+ * with lowAddr = -1. When no region matches, the base is used.
+ * The opcodes take the fixed number of cycles of the timing table (no page
+ * crossing penalty), and an opcode is executed only if there are enough
+ * cycles left for it, like make6502 did. */
+
+#include "deftypes.h"
+#include "m6502.h"
+
+#define F_C 0x01
+#define F_Z 0x02
+#define F_I 0x04
+#define F_D 0x08
+#define F_B 0x10
+#define F_U 0x20
+#define F_V 0x40
+#define F_N 0x80
+
+/* Live context. The program counter is the m6502pc global so that the
+ * memory handlers can read and change it (StopM6502Mode2...) */
+static struct m6502context cpu;
+UINT16 m6502pc;
+static UINT8 reg_a, reg_x, reg_y, reg_p, reg_s;
+
+static UINT32 dwElapsedTicks;
+static UINT32 cyclesRemaining;
+
+static const UINT8 cycles[256] =
+{
+	0x07, 0x06, 0x02, 0x02, 0x03, 0x03, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x03, 0x04, 0x06, 0x02, 0x02, 0x04, 0x02, 0x02, 0x04, 0x04, 0x07, 0x02,
+	0x06, 0x06, 0x02, 0x02, 0x02, 0x03, 0x05, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x02, 0x02, 0x04, 0x02, 0x02, 0x03, 0x04, 0x07, 0x02,
+	0x06, 0x06, 0x02, 0x02, 0x02, 0x03, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x04, 0x07, 0x02,
+	0x06, 0x06, 0x02, 0x02, 0x03, 0x03, 0x05, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x04, 0x04, 0x06, 0x02, 0x02, 0x04, 0x04, 0x02, 0x06, 0x04, 0x07, 0x02,
+	0x02, 0x06, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02,
+	0x03, 0x06, 0x03, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x04, 0x05, 0x05, 0x02,
+	0x02, 0x06, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02,
+	0x02, 0x06, 0x02, 0x02, 0x03, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x04, 0x07, 0x02,
+	0x02, 0x06, 0x02, 0x02, 0x03, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x04, 0x07, 0x02 };
+
+/******************************************************************************/
+/*  Memory access                                                             */
+/******************************************************************************/
+
+static UINT8 read_byte(UINT32 adr)
+{
+  struct MemoryReadByte *mr;
+  for (mr = cpu.m6502MemoryRead; mr->lowAddr != 0xffffffff; mr++) {
+    if (adr >= mr->lowAddr && adr <= mr->highAddr) {
+      if (mr->memoryCall)
+	return mr->memoryCall(adr, mr);
+      return ((UINT8 *)mr->pUserArea)[adr];
+    }
+  }
+  return cpu.m6502Base[adr];
+}
+
+static void write_byte(UINT32 adr, UINT8 data)
+{
+  struct MemoryWriteByte *mw;
+  for (mw = cpu.m6502MemoryWrite; mw->lowAddr != 0xffffffff; mw++) {
+    if (adr >= mw->lowAddr && adr <= mw->highAddr) {
+      if (mw->memoryCall)
+	mw->memoryCall(adr, data, mw);
+      else
+	((UINT8 *)mw->pUserArea)[adr] = data;
+      return;
+    }
+  }
+  cpu.m6502Base[adr] = data;
+}
+
+static UINT32 read_word(UINT32 adr)
+{
+  return read_byte(adr) | (read_byte((adr + 1) & 0xffff) << 8);
+}
+
+#define FETCH()		(cpu.m6502Base[m6502pc++])
+
+static UINT32 fetch_word(void)
+{
+  UINT32 lo = FETCH();
+  return lo | (FETCH() << 8);
+}
+
+#define PUSH(v)		cpu.m6502Base[0x100 | reg_s--] = (v)
+#define PULL()		cpu.m6502Base[0x100 | ++reg_s]
+
+static UINT32 vector(UINT32 adr)
+{
+  return cpu.m6502Base[adr] | (cpu.m6502Base[adr + 1] << 8);
+}
+
+/******************************************************************************/
+/*  Addressing modes : they all return the effective address                  */
+/******************************************************************************/
+
+#define EA_ZP()		FETCH()
+#define EA_ZPX()	((FETCH() + reg_x) & 0xff)
+#define EA_ZPY()	((FETCH() + reg_y) & 0xff)
+#define EA_ABS()	fetch_word()
+#define EA_ABSX()	((fetch_word() + reg_x) & 0xffff)
+#define EA_ABSY()	((fetch_word() + reg_y) & 0xffff)
+#define EA_INDX()	read_word((FETCH() + reg_x) & 0xff)
+#define EA_INDY()	((read_word(FETCH()) + reg_y) & 0xffff)
+#define EA_IND()	read_word(FETCH())
+
+/******************************************************************************/
+/*  Operations                                                                */
+/******************************************************************************/
+
+#define SET_NZ(v)	reg_p = (reg_p & ~(F_N | F_Z)) | ((v) & F_N) | ((v) ? 0 : F_Z)
+
+static void op_adc(UINT32 v)
+{
+  UINT32 c = reg_p & F_C;
+  if (reg_p & F_D) {
+    UINT32 lo = (reg_a & 0x0f) + (v & 0x0f) + c;
+    UINT32 hi = (reg_a & 0xf0) + (v & 0xf0);
+    reg_p &= ~(F_N | F_V | F_Z | F_C);
+    if (!((reg_a + v + c) & 0xff))
+      reg_p |= F_Z;
+    if (lo > 9) {
+      lo += 6;
+      hi += 0x10;
+    }
+    if (hi & 0x80)
+      reg_p |= F_N;
+    if (~(reg_a ^ v) & (reg_a ^ hi) & 0x80)
+      reg_p |= F_V;
+    if (hi > 0x90)
+      hi += 0x60;
+    if (hi & 0xff00)
+      reg_p |= F_C;
+    reg_a = (lo & 0x0f) | (hi & 0xf0);
+  } else {
+    UINT32 t = reg_a + v + c;
+    reg_p &= ~(F_V | F_C);
+    if (~(reg_a ^ v) & (reg_a ^ t) & 0x80)
+      reg_p |= F_V;
+    if (t & 0x100)
+      reg_p |= F_C;
+    reg_a = t;
+    SET_NZ(reg_a);
+  }
+}
+
+static void op_sbc(UINT32 v)
+{
+  UINT32 c = (reg_p & F_C) ^ F_C;
+  UINT32 t = reg_a - v - c;
+  if (reg_p & F_D) {
+    UINT32 lo = (reg_a & 0x0f) - (v & 0x0f) - c;
+    UINT32 hi = (reg_a & 0xf0) - (v & 0xf0);
+    if (lo & 0x10) {
+      lo -= 6;
+      hi--;
+    }
+    reg_p &= ~(F_V | F_C);
+    if ((reg_a ^ v) & (reg_a ^ t) & 0x80)
+      reg_p |= F_V;
+    if (hi & 0x100)
+      hi -= 0x60;
+    if (!(t & 0xff00))
+      reg_p |= F_C;
+    SET_NZ(t & 0xff);
+    reg_a = (lo & 0x0f) | (hi & 0xf0);
+  } else {
+    reg_p &= ~(F_V | F_C);
+    if ((reg_a ^ v) & (reg_a ^ t) & 0x80)
+      reg_p |= F_V;
+    if (!(t & 0xff00))
+      reg_p |= F_C;
+    reg_a = t;
+    SET_NZ(reg_a);
+  }
+}
+
+static void op_cmp(UINT32 r, UINT32 v)
+{
+  UINT32 t = (r - v) & 0xff;
+  reg_p &= ~F_C;
+  if (r >= v)
+    reg_p |= F_C;
+  SET_NZ(t);
+}
+
+static void op_bit(UINT32 v)
+{
+  reg_p &= ~(F_N | F_V | F_Z);
+  reg_p |= v & (F_N | F_V);
+  if (!(reg_a & v))
+    reg_p |= F_Z;
+}
+
+static UINT32 op_asl(UINT32 v)
+{
+  reg_p = (reg_p & ~F_C) | (v >> 7);
+  v = (v << 1) & 0xff;
+  SET_NZ(v);
+  return v;
+}
+
+static UINT32 op_lsr(UINT32 v)
+{
+  reg_p = (reg_p & ~F_C) | (v & 1);
+  v >>= 1;
+  SET_NZ(v);
+  return v;
+}
+
+static UINT32 op_rol(UINT32 v)
+{
+  UINT32 c = reg_p & F_C;
+  reg_p = (reg_p & ~F_C) | (v >> 7);
+  v = ((v << 1) | c) & 0xff;
+  SET_NZ(v);
+  return v;
+}
+
+static UINT32 op_ror(UINT32 v)
+{
+  UINT32 c = reg_p & F_C;
+  reg_p = (reg_p & ~F_C) | (v & 1);
+  v = (v >> 1) | (c << 7);
+  SET_NZ(v);
+  return v;
+}
+
+static UINT32 op_inc(UINT32 v)
+{
+  v = (v + 1) & 0xff;
+  SET_NZ(v);
+  return v;
+}
+
+static UINT32 op_dec(UINT32 v)
+{
+  v = (v - 1) & 0xff;
+  SET_NZ(v);
+  return v;
+}
+
+/* Read-modify-write on memory */
+#define RMW(ea, fn)	do { UINT32 adr = ea; write_byte(adr, fn(read_byte(adr))); } while (0)
+
+#define BRANCH(cond)	do {						\
+    INT8 disp = FETCH();						\
+    if (cond)								\
+      m6502pc += disp;							\
+  } while (0)
+
+/******************************************************************************/
+/*  Interrupts                                                                */
+/******************************************************************************/
+
+static void take_interrupt(UINT32 vec)
+{
+  PUSH(m6502pc >> 8);
+  PUSH(m6502pc & 0xff);
+  PUSH(reg_p);
+  reg_p = (reg_p & ~F_B) | F_I | F_U;
+  m6502pc = vector(vec);
+}
+
+UINT32 m6502int(UINT32 irq)
+{
+  (void)(irq);
+  if (reg_p & F_I) {
+    cpu.irqPending = 1;
+    return 1;
+  }
+  take_interrupt(0xfffe);
+  cpu.irqPending = 0;
+  return 0;
+}
+
+UINT32 m6502nmi(void)
+{
+  take_interrupt(0xfffa);
+  return 0;
+}
+
+/* Called when the I flag is cleared by cli or rti */
+static void check_irq(void)
+{
+  if (cpu.irqPending && !(reg_p & F_I))
+    m6502int(1);
+}
+
+/******************************************************************************/
+/*  Execution                                                                 */
+/******************************************************************************/
+
+UINT32 m6502exec(UINT32 cycles_to_run)
+{
+  UINT32 op, ea;
+
+  cyclesRemaining = cycles_to_run;
+
+  for (;;) {
+    op = cpu.m6502Base[m6502pc];
+    if (cyclesRemaining < cycles[op])
+      return 0x80000000;
+    cyclesRemaining -= cycles[op];
+    dwElapsedTicks += cycles[op];
+    m6502pc++;
+
+    switch(op) {
+
+      /* Loads and stores */
+
+    case 0xa9: reg_a = FETCH(); SET_NZ(reg_a); break;
+    case 0xa5: reg_a = read_byte(EA_ZP()); SET_NZ(reg_a); break;
+    case 0xb5: reg_a = read_byte(EA_ZPX()); SET_NZ(reg_a); break;
+    case 0xad: reg_a = read_byte(EA_ABS()); SET_NZ(reg_a); break;
+    case 0xbd: reg_a = read_byte(EA_ABSX()); SET_NZ(reg_a); break;
+    case 0xb9: reg_a = read_byte(EA_ABSY()); SET_NZ(reg_a); break;
+    case 0xa1: reg_a = read_byte(EA_INDX()); SET_NZ(reg_a); break;
+    case 0xb1: reg_a = read_byte(EA_INDY()); SET_NZ(reg_a); break;
+    case 0xb2: reg_a = read_byte(EA_IND()); SET_NZ(reg_a); break;
+
+    case 0xa2: reg_x = FETCH(); SET_NZ(reg_x); break;
+    case 0xa6: reg_x = read_byte(EA_ZP()); SET_NZ(reg_x); break;
+    case 0xb6: reg_x = read_byte(EA_ZPY()); SET_NZ(reg_x); break;
+    case 0xae: reg_x = read_byte(EA_ABS()); SET_NZ(reg_x); break;
+    case 0xbe: reg_x = read_byte(EA_ABSY()); SET_NZ(reg_x); break;
+
+    case 0xa0: reg_y = FETCH(); SET_NZ(reg_y); break;
+    case 0xa4: reg_y = read_byte(EA_ZP()); SET_NZ(reg_y); break;
+    case 0xb4: reg_y = read_byte(EA_ZPX()); SET_NZ(reg_y); break;
+    case 0xac: reg_y = read_byte(EA_ABS()); SET_NZ(reg_y); break;
+    case 0xbc: reg_y = read_byte(EA_ABSX()); SET_NZ(reg_y); break;
+
+    case 0x85: write_byte(EA_ZP(), reg_a); break;
+    case 0x95: write_byte(EA_ZPX(), reg_a); break;
+    case 0x8d: write_byte(EA_ABS(), reg_a); break;
+    case 0x9d: write_byte(EA_ABSX(), reg_a); break;
+    case 0x99: write_byte(EA_ABSY(), reg_a); break;
+    case 0x81: write_byte(EA_INDX(), reg_a); break;
+    case 0x91: write_byte(EA_INDY(), reg_a); break;
+    case 0x92: write_byte(EA_IND(), reg_a); break;
+
+    case 0x86: write_byte(EA_ZP(), reg_x); break;
+    case 0x96: write_byte(EA_ZPY(), reg_x); break;
+    case 0x8e: write_byte(EA_ABS(), reg_x); break;
+
+    case 0x84: write_byte(EA_ZP(), reg_y); break;
+    case 0x94: write_byte(EA_ZPX(), reg_y); break;
+    case 0x8c: write_byte(EA_ABS(), reg_y); break;
+
+    case 0x64: write_byte(EA_ZP(), 0); break;
+    case 0x74: write_byte(EA_ZPX(), 0); break;
+    case 0x9c: write_byte(EA_ABS(), 0); break;
+    case 0x9e: write_byte(EA_ABSX(), 0); break;
+
+      /* Transfers */
+
+    case 0xaa: reg_x = reg_a; SET_NZ(reg_x); break;
+    case 0x8a: reg_a = reg_x; SET_NZ(reg_a); break;
+    case 0xa8: reg_y = reg_a; SET_NZ(reg_y); break;
+    case 0x98: reg_a = reg_y; SET_NZ(reg_a); break;
+    case 0xba: reg_x = reg_s; SET_NZ(reg_x); break;
+    case 0x9a: reg_s = reg_x; break;
+
+      /* Logical and arithmetic */
+
+    case 0x29: reg_a &= FETCH(); SET_NZ(reg_a); break;
+    case 0x25: reg_a &= read_byte(EA_ZP()); SET_NZ(reg_a); break;
+    case 0x35: reg_a &= read_byte(EA_ZPX()); SET_NZ(reg_a); break;
+    case 0x2d: reg_a &= read_byte(EA_ABS()); SET_NZ(reg_a); break;
+    case 0x3d: reg_a &= read_byte(EA_ABSX()); SET_NZ(reg_a); break;
+    case 0x39: reg_a &= read_byte(EA_ABSY()); SET_NZ(reg_a); break;
+    case 0x21: reg_a &= read_byte(EA_INDX()); SET_NZ(reg_a); break;
+    case 0x31: reg_a &= read_byte(EA_INDY()); SET_NZ(reg_a); break;
+    case 0x32: reg_a &= read_byte(EA_IND()); SET_NZ(reg_a); break;
+
+    case 0x09: reg_a |= FETCH(); SET_NZ(reg_a); break;
+    case 0x05: reg_a |= read_byte(EA_ZP()); SET_NZ(reg_a); break;
+    case 0x15: reg_a |= read_byte(EA_ZPX()); SET_NZ(reg_a); break;
+    case 0x0d: reg_a |= read_byte(EA_ABS()); SET_NZ(reg_a); break;
+    case 0x1d: reg_a |= read_byte(EA_ABSX()); SET_NZ(reg_a); break;
+    case 0x19: reg_a |= read_byte(EA_ABSY()); SET_NZ(reg_a); break;
+    case 0x01: reg_a |= read_byte(EA_INDX()); SET_NZ(reg_a); break;
+    case 0x11: reg_a |= read_byte(EA_INDY()); SET_NZ(reg_a); break;
+    case 0x12: reg_a |= read_byte(EA_IND()); SET_NZ(reg_a); break;
+
+    case 0x49: reg_a ^= FETCH(); SET_NZ(reg_a); break;
+    case 0x45: reg_a ^= read_byte(EA_ZP()); SET_NZ(reg_a); break;
+    case 0x55: reg_a ^= read_byte(EA_ZPX()); SET_NZ(reg_a); break;
+    case 0x4d: reg_a ^= read_byte(EA_ABS()); SET_NZ(reg_a); break;
+    case 0x5d: reg_a ^= read_byte(EA_ABSX()); SET_NZ(reg_a); break;
+    case 0x59: reg_a ^= read_byte(EA_ABSY()); SET_NZ(reg_a); break;
+    case 0x41: reg_a ^= read_byte(EA_INDX()); SET_NZ(reg_a); break;
+    case 0x51: reg_a ^= read_byte(EA_INDY()); SET_NZ(reg_a); break;
+    case 0x52: reg_a ^= read_byte(EA_IND()); SET_NZ(reg_a); break;
+
+    case 0x69: op_adc(FETCH()); break;
+    case 0x65: op_adc(read_byte(EA_ZP())); break;
+    case 0x75: op_adc(read_byte(EA_ZPX())); break;
+    case 0x6d: op_adc(read_byte(EA_ABS())); break;
+    case 0x7d: op_adc(read_byte(EA_ABSX())); break;
+    case 0x79: op_adc(read_byte(EA_ABSY())); break;
+    case 0x61: op_adc(read_byte(EA_INDX())); break;
+    case 0x71: op_adc(read_byte(EA_INDY())); break;
+    case 0x72: op_adc(read_byte(EA_IND())); break;
+
+    case 0xe9: op_sbc(FETCH()); break;
+    case 0xe5: op_sbc(read_byte(EA_ZP())); break;
+    case 0xf5: op_sbc(read_byte(EA_ZPX())); break;
+    case 0xed: op_sbc(read_byte(EA_ABS())); break;
+    case 0xfd: op_sbc(read_byte(EA_ABSX())); break;
+    case 0xf9: op_sbc(read_byte(EA_ABSY())); break;
+    case 0xe1: op_sbc(read_byte(EA_INDX())); break;
+    case 0xf1: op_sbc(read_byte(EA_INDY())); break;
+    case 0xf2: op_sbc(read_byte(EA_IND())); break;
+
+    case 0xc9: op_cmp(reg_a, FETCH()); break;
+    case 0xc5: op_cmp(reg_a, read_byte(EA_ZP())); break;
+    case 0xd5: op_cmp(reg_a, read_byte(EA_ZPX())); break;
+    case 0xcd: op_cmp(reg_a, read_byte(EA_ABS())); break;
+    case 0xdd: op_cmp(reg_a, read_byte(EA_ABSX())); break;
+    case 0xd9: op_cmp(reg_a, read_byte(EA_ABSY())); break;
+    case 0xc1: op_cmp(reg_a, read_byte(EA_INDX())); break;
+    case 0xd1: op_cmp(reg_a, read_byte(EA_INDY())); break;
+    case 0xd2: op_cmp(reg_a, read_byte(EA_IND())); break;
+
+    case 0xe0: op_cmp(reg_x, FETCH()); break;
+    case 0xe4: op_cmp(reg_x, read_byte(EA_ZP())); break;
+    case 0xec: op_cmp(reg_x, read_byte(EA_ABS())); break;
+
+    case 0xc0: op_cmp(reg_y, FETCH()); break;
+    case 0xc4: op_cmp(reg_y, read_byte(EA_ZP())); break;
+    case 0xcc: op_cmp(reg_y, read_byte(EA_ABS())); break;
+
+    case 0x24: op_bit(read_byte(EA_ZP())); break;
+    case 0x34: op_bit(read_byte(EA_ZPX())); break;
+    case 0x2c: op_bit(read_byte(EA_ABS())); break;
+    case 0x3c: op_bit(read_byte(EA_ABSX())); break;
+    case 0x89: /* bit #imm only changes Z */
+      if (reg_a & FETCH())
+	reg_p &= ~F_Z;
+      else
+	reg_p |= F_Z;
+      break;
+
+    case 0x04: /* tsb */
+    case 0x0c:
+    case 0x14: /* trb */
+    case 0x1c:
+      ea = (op & 8 ? EA_ABS() : EA_ZP());
+      {
+	UINT32 v = read_byte(ea);
+	if (reg_a & v)
+	  reg_p &= ~F_Z;
+	else
+	  reg_p |= F_Z;
+	write_byte(ea, (op & 0x10 ? v & ~reg_a : v | reg_a));
+      }
+      break;
+
+      /* Shifts, rotations, increments */
+
+    case 0x0a: reg_a = op_asl(reg_a); break;
+    case 0x06: RMW(EA_ZP(), op_asl); break;
+    case 0x16: RMW(EA_ZPX(), op_asl); break;
+    case 0x0e: RMW(EA_ABS(), op_asl); break;
+    case 0x1e: RMW(EA_ABSX(), op_asl); break;
+
+    case 0x4a: reg_a = op_lsr(reg_a); break;
+    case 0x46: RMW(EA_ZP(), op_lsr); break;
+    case 0x56: RMW(EA_ZPX(), op_lsr); break;
+    case 0x4e: RMW(EA_ABS(), op_lsr); break;
+    case 0x5e: RMW(EA_ABSX(), op_lsr); break;
+
+    case 0x2a: reg_a = op_rol(reg_a); break;
+    case 0x26: RMW(EA_ZP(), op_rol); break;
+    case 0x36: RMW(EA_ZPX(), op_rol); break;
+    case 0x2e: RMW(EA_ABS(), op_rol); break;
+    case 0x3e: RMW(EA_ABSX(), op_rol); break;
+
+    case 0x6a: reg_a = op_ror(reg_a); break;
+    case 0x66: RMW(EA_ZP(), op_ror); break;
+    case 0x76: RMW(EA_ZPX(), op_ror); break;
+    case 0x6e: RMW(EA_ABS(), op_ror); break;
+    case 0x7e: RMW(EA_ABSX(), op_ror); break;
+
+    case 0x1a: reg_a = op_inc(reg_a); break;
+    case 0xe6: RMW(EA_ZP(), op_inc); break;
+    case 0xf6: RMW(EA_ZPX(), op_inc); break;
+    case 0xee: RMW(EA_ABS(), op_inc); break;
+    case 0xfe: RMW(EA_ABSX(), op_inc); break;
+    case 0xe8: reg_x = op_inc(reg_x); break;
+    case 0xc8: reg_y = op_inc(reg_y); break;
+
+    case 0x3a: reg_a = op_dec(reg_a); break;
+    case 0xc6: RMW(EA_ZP(), op_dec); break;
+    case 0xd6: RMW(EA_ZPX(), op_dec); break;
+    case 0xce: RMW(EA_ABS(), op_dec); break;
+    case 0xde: RMW(EA_ABSX(), op_dec); break;
+    case 0xca: reg_x = op_dec(reg_x); break;
+    case 0x88: reg_y = op_dec(reg_y); break;
+
+      /* Branches and jumps */
+
+    case 0x10: BRANCH(!(reg_p & F_N)); break;
+    case 0x30: BRANCH(reg_p & F_N); break;
+    case 0x50: BRANCH(!(reg_p & F_V)); break;
+    case 0x70: BRANCH(reg_p & F_V); break;
+    case 0x90: BRANCH(!(reg_p & F_C)); break;
+    case 0xb0: BRANCH(reg_p & F_C); break;
+    case 0xd0: BRANCH(!(reg_p & F_Z)); break;
+    case 0xf0: BRANCH(reg_p & F_Z); break;
+    case 0x80: BRANCH(1); break;
+
+    case 0x4c: m6502pc = fetch_word(); break;
+    case 0x6c: m6502pc = read_word(fetch_word()); break;
+    case 0x7c: m6502pc = read_word((fetch_word() + reg_x) & 0xffff); break;
+
+    case 0x20:
+      ea = fetch_word();
+      m6502pc--;
+      PUSH(m6502pc >> 8);
+      PUSH(m6502pc & 0xff);
+      m6502pc = ea;
+      break;
+    case 0x60:
+      ea = PULL();
+      ea |= PULL() << 8;
+      m6502pc = ea + 1;
+      break;
+
+    case 0x00: /* brk */
+      m6502pc++;
+      reg_p |= F_B | F_I;
+      PUSH(m6502pc >> 8);
+      PUSH(m6502pc & 0xff);
+      PUSH(reg_p);
+      m6502pc = vector(0xfffe);
+      break;
+    case 0x40: /* rti */
+      reg_p = PULL() | F_U;
+      ea = PULL();
+      ea |= PULL() << 8;
+      m6502pc = ea;
+      check_irq();
+      break;
+
+      /* Stack */
+
+    case 0x48: PUSH(reg_a); break;
+    case 0x08: PUSH(reg_p); break;
+    case 0xda: PUSH(reg_x); break;
+    case 0x5a: PUSH(reg_y); break;
+    case 0x68: reg_a = PULL(); SET_NZ(reg_a); break;
+    case 0x28: reg_p = PULL(); break;
+    case 0xfa: reg_x = PULL(); SET_NZ(reg_x); break;
+    case 0x7a: reg_y = PULL(); SET_NZ(reg_y); break;
+
+      /* Flags */
+
+    case 0x18: reg_p &= ~F_C; break;
+    case 0x38: reg_p |= F_C; break;
+    case 0x58: reg_p &= ~F_I; check_irq(); break;
+    case 0x78: reg_p |= F_I; break;
+    case 0xb8: reg_p &= ~F_V; break;
+    case 0xd8: reg_p &= ~F_D; break;
+    case 0xf8: reg_p |= F_D; break;
+
+    case 0xea: break;
+
+    default:
+      /* Invalid opcode : stop here, without consuming its cycles, and return
+       * its address like make6502 */
+      m6502pc--;
+      cyclesRemaining += cycles[op];
+      dwElapsedTicks -= cycles[op];
+      return m6502pc;
+    }
+  }
+}
+
+void m6502ReleaseTimeslice()
+{
+  cyclesRemaining = 0;
+}
+
+UINT32 m6502GetElapsedTicks(UINT32 clear)
+{
+  UINT32 ticks = dwElapsedTicks;
+  if (clear)
+    dwElapsedTicks = 0;
+  return ticks;
+}
+
+void m6502reset(void)
+{
+  reg_a = reg_x = reg_y = 0;
+  reg_s = 0xff;
+  reg_p = F_U | F_Z;
+  cpu.irqPending = 0;
+  m6502pc = vector(0xfffc);
+}
+
+void m6502init(void)
+{
+}
+
+/******************************************************************************/
+/*  Contexts                                                                  */
+/******************************************************************************/
+
+void m6502SetContext(struct m6502context *context)
+{
+  cpu = *context;
+  m6502pc = cpu.m6502pc;
+  reg_a = cpu.m6502af & 0xff;
+  reg_p = cpu.m6502af >> 8;
+  reg_x = cpu.m6502x;
+  reg_y = cpu.m6502y;
+  reg_s = cpu.m6502s;
+}
+
+void m6502GetContext(struct m6502context *context)
+{
+  cpu.m6502pc = m6502pc;
+  cpu.m6502af = reg_a | (reg_p << 8);
+  cpu.m6502x = reg_x;
+  cpu.m6502y = reg_y;
+  cpu.m6502s = reg_s;
+  *context = cpu;
+}
+
+UINT32 m6502GetContextSize(void)
+{
+  return sizeof(struct m6502context);
+}
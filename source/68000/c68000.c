@@ -0,0 +1,2424 @@
+/******************************************************************************/
+/*                                                                            */
+/*                 C68000 - PORTABLE 68000 CORE (STARSCREAM API)              */
+/*                                                                            */
+/******************************************************************************/
+
+/* This is a plain C replacement for the starscream asm core. It exports
+ * exactly the same interface (starcpu.h) and uses the same context and memory
+ * maps, so that starhelp.c, cpumain.c and all the drivers keep working
+ * without knowing which core is compiled in. It's selected by C68000=1 in the
+ * makefile (forced by NO_ASM), and is what allows a native 64 bit build.
+ *
+ * Like starscream it expects the memory to be stored as an array of words in
+ * native order (byteswapped), and the addresses are masked to 24 bits.
+ * What is not emulated : trace mode, bus and address errors (starscream
+ * didn't emulate them either). */
+
+#include <string.h>
+#include "deftypes.h"
+#include "starcpu.h"
+#include "c68000.h"
+
+struct S68000CONTEXT s68000context;
+
+#define ADDRESS_MASK 0xffffff
+
+#define DREG(n) (s68000context.dreg[n])
+#define AREG(n) (s68000context.areg[n])
+
+/* Live registers while s68000exec is running. The other registers are used
+ * directly from s68000context */
+static UINT32 pc;
+static UINT8 *fetch_base;
+static UINT32 fetch_lo, fetch_hi;
+static UINT32 flag_x, flag_n, flag_z, flag_v, flag_c;
+static UINT8 irq_mask;
+
+static int remaining, slice, executing;
+static UINT32 exit_code, bad_pc;
+
+/* What we fetch from when the pc goes out of bounds, so that the current
+ * instruction can finish without crashing */
+static UINT16 dummy_fetch[16];
+
+typedef void (*op_handler)(UINT32 op);
+static op_handler optable[0x10000];
+
+static const UINT32 size_mask[5] = { 0, 0xff, 0xffff, 0, 0xffffffff };
+static const UINT32 size_msb[5] = { 0, 0x80, 0x8000, 0, 0x80000000 };
+static const int op_size[4] = { 1, 2, 4, 0 };
+
+#define OP_SIZE(op) op_size[((op) >> 6) & 3]
+#define EA_MODE(op) (((op) >> 3) & 7)
+#define EA_REG(op) ((op) & 7)
+#define REG_X(op) (((op) >> 9) & 7)
+
+#define USE_CYCLES(n) remaining -= (n)
+
+/******************************************************************************/
+/*  Memory access                                                             */
+/******************************************************************************/
+
+typedef UINT8 (*rb_func)(UINT32 adr);
+typedef UINT16 (*rw_func)(UINT32 adr);
+typedef void (*wb_func)(UINT32 adr, UINT8 data);
+typedef void (*ww_func)(UINT32 adr, UINT16 data);
+
+static inline struct STARSCREAM_DATAREGION *find_region(
+	struct STARSCREAM_DATAREGION *r, UINT32 adr)
+{
+    for (; r->lowaddr != 0xffffffff; r++)
+	if (adr >= r->lowaddr && adr <= r->highaddr)
+	    return r;
+    return NULL;
+}
+
+/* The data region lists are turned into page tables : 4KB pages over the 24
+ * bit space, one table per region list. A page entirely inside a region
+ * without handler points directly at the host memory, so that most ram/rom
+ * accesses are one indexed load. The other pages keep the first region which
+ * touches them, and the lookup walks the list from there (just 1 test when a
+ * handler covers the whole page).
+ * The tables are built when a list is used for the 1st time and must be
+ * updated by starhelp.c each time a list is changed (add/insert/del/set), see
+ * c68000_update_memory_map. */
+
+#define PAGE_SHIFT 12
+#define NB_PAGES ((ADDRESS_MASK >> PAGE_SHIFT) + 1)
+#define MAX_MAPS 8
+
+typedef struct {
+    UINT8 *data; // host address = data + adr when not NULL
+    struct STARSCREAM_DATAREGION *first;
+} MEM_PAGE;
+
+typedef struct {
+    struct STARSCREAM_DATAREGION *regions;
+    MEM_PAGE page[NB_PAGES];
+} MEM_MAP;
+
+static MEM_MAP maps[MAX_MAPS];
+static int next_map;
+static MEM_PAGE *page_rb, *page_rw, *page_wb, *page_ww;
+
+/* for the pages without any region */
+static struct STARSCREAM_DATAREGION no_region = { 0xffffffff, 0xffffffff, NULL, NULL };
+
+static void paint_pages(MEM_MAP *map, UINT32 plo, UINT32 phi)
+{
+    struct STARSCREAM_DATAREGION *r;
+    UINT32 p, lo, hi;
+    int n, count;
+
+    for (p = plo; p <= phi; p++) {
+	map->page[p].data = NULL;
+	map->page[p].first = &no_region;
+    }
+    /* The lists are not always terminated after the catch all region added
+     * by finish_conf_68000, nothing after it can be reached anyway */
+    for (count = 0; map->regions[count].lowaddr != 0xffffffff; count++)
+	if (!map->regions[count].lowaddr &&
+		map->regions[count].highaddr >= ADDRESS_MASK) {
+	    count++;
+	    break;
+	}
+    /* Backwards, so that the 1st matching region wins like in find_region */
+    for (n = count - 1; n >= 0; n--) {
+	r = &map->regions[n];
+	if (r->lowaddr > r->highaddr || r->lowaddr > ADDRESS_MASK)
+	    continue;
+	lo = r->lowaddr >> PAGE_SHIFT;
+	hi = (r->highaddr > ADDRESS_MASK ? ADDRESS_MASK : r->highaddr) >> PAGE_SHIFT;
+	if (lo < plo) lo = plo;
+	if (hi > phi) hi = phi;
+	for (p = lo; p <= hi; p++) {
+	    map->page[p].first = r;
+	    if (!r->memorycall && r->lowaddr <= (p << PAGE_SHIFT) &&
+		    r->highaddr >= (p << PAGE_SHIFT) + (1 << PAGE_SHIFT) - 1)
+		map->page[p].data = r->userdata;
+	    else
+		map->page[p].data = NULL;
+	}
+    }
+}
+
+static MEM_PAGE *get_pages(struct STARSCREAM_DATAREGION *regions)
+{
+    MEM_MAP *map;
+    int n;
+    if (!regions)
+	regions = &no_region;
+    for (n = 0; n < MAX_MAPS; n++)
+	if (maps[n].regions == regions)
+	    return maps[n].page;
+    map = &maps[next_map];
+    next_map = (next_map + 1) % MAX_MAPS;
+    map->regions = regions;
+    paint_pages(map, 0, NB_PAGES - 1);
+    return map->page;
+}
+
+/* Must be called each time the memory map changes (context, supervisor bit) */
+static void select_pages(void)
+{
+    page_rb = get_pages(s68000context.readbyte);
+    page_rw = get_pages(s68000context.readword);
+    page_wb = get_pages(s68000context.writebyte);
+    page_ww = get_pages(s68000context.writeword);
+}
+
+void c68000_update_memory_map(struct STARSCREAM_DATAREGION *regions,
+	UINT32 lo, UINT32 hi)
+{
+    int n;
+    if (lo > ADDRESS_MASK || lo > hi)
+	return;
+    if (hi > ADDRESS_MASK)
+	hi = ADDRESS_MASK;
+    for (n = 0; n < MAX_MAPS; n++)
+	if (maps[n].regions == regions)
+	    paint_pages(&maps[n], lo >> PAGE_SHIFT, hi >> PAGE_SHIFT);
+}
+
+void c68000_clear_memory_maps(void)
+{
+    int n;
+    for (n = 0; n < MAX_MAPS; n++)
+	maps[n].regions = NULL;
+    next_map = 0;
+}
+
+static UINT32 read_byte(UINT32 adr)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    adr &= ADDRESS_MASK;
+    pg = &page_rb[adr >> PAGE_SHIFT];
+    if (pg->data)
+	return pg->data[adr ^ 1];
+    r = find_region(pg->first, adr);
+    if (!r) return 0xff;
+    if (r->memorycall)
+	return ((rb_func)r->memorycall)(adr);
+    return ((UINT8 *)r->userdata)[adr ^ 1];
+}
+
+static UINT32 read_word(UINT32 adr)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    adr &= ADDRESS_MASK;
+    pg = &page_rw[adr >> PAGE_SHIFT];
+    if (pg->data)
+	return *(UINT16 *)(pg->data + adr);
+    r = find_region(pg->first, adr);
+    if (!r) return 0xffff;
+    if (r->memorycall)
+	return ((rw_func)r->memorycall)(adr);
+    return *(UINT16 *)((UINT8 *)r->userdata + adr);
+}
+
+static UINT32 read_long(UINT32 adr)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    UINT16 *p;
+    adr &= ADDRESS_MASK;
+    pg = &page_rw[adr >> PAGE_SHIFT];
+    if (pg->data)
+	p = (UINT16 *)(pg->data + adr);
+    else {
+	r = find_region(pg->first, adr);
+	if (!r) return 0xffffffff;
+	if (r->memorycall)
+	    return (((rw_func)r->memorycall)(adr) << 16) |
+		((rw_func)r->memorycall)(adr+2);
+	p = (UINT16 *)((UINT8 *)r->userdata + adr);
+    }
+    return (p[0] << 16) | p[1];
+}
+
+static void write_byte(UINT32 adr, UINT32 data)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    adr &= ADDRESS_MASK;
+    pg = &page_wb[adr >> PAGE_SHIFT];
+    if (pg->data) {
+	pg->data[adr ^ 1] = data;
+	return;
+    }
+    r = find_region(pg->first, adr);
+    if (!r) return;
+    if (r->memorycall)
+	((wb_func)r->memorycall)(adr, data);
+    else
+	((UINT8 *)r->userdata)[adr ^ 1] = data;
+}
+
+static void write_word(UINT32 adr, UINT32 data)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    adr &= ADDRESS_MASK;
+    pg = &page_ww[adr >> PAGE_SHIFT];
+    if (pg->data) {
+	*(UINT16 *)(pg->data + adr) = data;
+	return;
+    }
+    r = find_region(pg->first, adr);
+    if (!r) return;
+    if (r->memorycall)
+	((ww_func)r->memorycall)(adr, data);
+    else
+	*(UINT16 *)((UINT8 *)r->userdata + adr) = data;
+}
+
+static void write_long(UINT32 adr, UINT32 data)
+{
+    MEM_PAGE *pg;
+    struct STARSCREAM_DATAREGION *r;
+    UINT16 *p;
+    adr &= ADDRESS_MASK;
+    pg = &page_ww[adr >> PAGE_SHIFT];
+    if (pg->data)
+	p = (UINT16 *)(pg->data + adr);
+    else {
+	r = find_region(pg->first, adr);
+	if (!r) return;
+	if (r->memorycall) {
+	    ((ww_func)r->memorycall)(adr, data >> 16);
+	    ((ww_func)r->memorycall)(adr+2, data & 0xffff);
+	    return;
+	}
+	p = (UINT16 *)((UINT8 *)r->userdata + adr);
+    }
+    p[0] = data >> 16;
+    p[1] = data;
+}
+
+static UINT32 read_mem(UINT32 adr, int sz)
+{
+    if (sz == 1) return read_byte(adr);
+    if (sz == 2) return read_word(adr);
+    return read_long(adr);
+}
+
+static void write_mem(UINT32 adr, int sz, UINT32 data)
+{
+    if (sz == 1) write_byte(adr, data);
+    else if (sz == 2) write_word(adr, data);
+    else write_long(adr, data);
+}
+
+static void push16(UINT32 data)
+{
+    AREG(7) -= 2;
+    write_word(AREG(7), data);
+}
+
+static void push32(UINT32 data)
+{
+    AREG(7) -= 4;
+    write_long(AREG(7), data);
+}
+
+static UINT32 pop16(void)
+{
+    UINT32 data = read_word(AREG(7));
+    AREG(7) += 2;
+    return data;
+}
+
+static UINT32 pop32(void)
+{
+    UINT32 data = read_long(AREG(7));
+    AREG(7) += 4;
+    return data;
+}
+
+/******************************************************************************/
+/*  Program fetch                                                             */
+/******************************************************************************/
+
+/* Stops the current s68000exec call, the elapsed cycles are kept */
+static void abort_exec(UINT32 code)
+{
+    exit_code = code;
+    slice -= remaining;
+    remaining = 0;
+}
+
+static struct STARSCREAM_PROGRAMREGION *find_fetch(
+	struct STARSCREAM_PROGRAMREGION *r, UINT32 adr)
+{
+    if (!r) return NULL;
+    for (; r->lowaddr != 0xffffffff; r++)
+	if (adr >= r->lowaddr && adr <= r->highaddr)
+	    return r;
+    return NULL;
+}
+
+/* Called after every jump : find the program region of the new pc */
+static int rebase(void)
+{
+    struct STARSCREAM_PROGRAMREGION *r;
+    pc &= ADDRESS_MASK;
+    if (pc >= fetch_lo && pc <= fetch_hi)
+	return 1;
+    r = find_fetch(s68000context.fetch, pc);
+    if (r) {
+	fetch_lo = r->lowaddr;
+	fetch_hi = r->highaddr;
+	fetch_base = (UINT8 *)r->offset;
+	return 1;
+    }
+    fetch_lo = 1;
+    fetch_hi = 0;
+    fetch_base = (UINT8 *)dummy_fetch - pc;
+    if (executing && exit_code == 0x80000000) {
+	bad_pc = pc;
+	abort_exec(0x80000001);
+    }
+    return 0;
+}
+
+static inline UINT32 fetch16(void)
+{
+    UINT32 data = *(UINT16 *)(fetch_base + pc);
+    pc += 2;
+    return data;
+}
+
+static inline UINT32 fetch32(void)
+{
+    UINT32 data = fetch16() << 16;
+    return data | fetch16();
+}
+
+/******************************************************************************/
+/*  Status register and exceptions                                            */
+/******************************************************************************/
+
+static UINT32 get_ccr(void)
+{
+    return (flag_x << 4) | (flag_n << 3) | (flag_z << 2) | (flag_v << 1) | flag_c;
+}
+
+static void set_ccr(UINT32 ccr)
+{
+    flag_x = (ccr >> 4) & 1;
+    flag_n = (ccr >> 3) & 1;
+    flag_z = (ccr >> 2) & 1;
+    flag_v = (ccr >> 1) & 1;
+    flag_c = ccr & 1;
+}
+
+static UINT32 get_sr(void)
+{
+    return (s68000context.sr & 0xa700) | get_ccr();
+}
+
+static void update_irq_mask(void)
+{
+    int ppl = (s68000context.sr >> 8) & 7;
+    /* level 7 is not maskable */
+    irq_mask = ((0xff << (ppl+1)) | 0x80) & 0xfe;
+}
+
+static void switch_memory_map(int supervisor)
+{
+    if (supervisor) {
+	s68000context.fetch     = s68000context.s_fetch;
+	s68000context.readbyte  = s68000context.s_readbyte;
+	s68000context.readword  = s68000context.s_readword;
+	s68000context.writebyte = s68000context.s_writebyte;
+	s68000context.writeword = s68000context.s_writeword;
+    } else {
+	s68000context.fetch     = s68000context.u_fetch;
+	s68000context.readbyte  = s68000context.u_readbyte;
+	s68000context.readword  = s68000context.u_readword;
+	s68000context.writebyte = s68000context.u_writebyte;
+	s68000context.writeword = s68000context.u_writeword;
+    }
+    select_pages();
+    fetch_lo = 1;
+    fetch_hi = 0;
+}
+
+static void set_sr(UINT32 sr)
+{
+    UINT32 old = s68000context.sr;
+    sr &= 0xa71f;
+    if ((old ^ sr) & 0x2000) {
+	UINT32 tmp = AREG(7);
+	AREG(7) = s68000context.asp;
+	s68000context.asp = tmp;
+	s68000context.sr = sr;
+	switch_memory_map(sr & 0x2000);
+    } else
+	s68000context.sr = sr;
+    set_ccr(sr);
+    update_irq_mask();
+}
+
+/* Group 1 & 2 exceptions. The caller must rebase the pc */
+static void exception(int vector)
+{
+    UINT32 old_sr = get_sr();
+    UINT32 new_pc = read_long(vector*4);
+    s68000context.interrupts[0] &= 0xfe;
+    set_sr((old_sr & ~0x8000) | 0x2000);
+    push32(pc);
+    push16(old_sr);
+    pc = new_pc;
+}
+
+/* Exceptions which point to the instruction which caused them (illegal,
+ * privilege violation...) */
+static void exception_here(int vector, UINT32 op_pc)
+{
+    pc = op_pc;
+    exception(vector);
+    rebase();
+    USE_CYCLES(34);
+}
+
+static void trap(int vector, int cycles)
+{
+    exception(vector);
+    rebase();
+    USE_CYCLES(cycles);
+}
+
+/* Takes the highest pending interrupt above the current ppl, if any */
+static int take_interrupt(void)
+{
+    int level, ppl = (s68000context.sr >> 8) & 7;
+    for (level = 7; level > ppl || level == 7; level--) {
+	if (s68000context.interrupts[0] & (1 << level)) {
+	    s68000context.interrupts[0] &= ~(1 << level);
+	    exception(s68000context.interrupts[level]);
+	    s68000context.sr = (s68000context.sr & ~0x700) | (level << 8);
+	    update_irq_mask();
+	    USE_CYCLES(44);
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+/******************************************************************************/
+/*  Effective addresses                                                       */
+/******************************************************************************/
+
+static const UINT8 ea_cycles[2][12] = {
+    { 0, 0, 4, 4, 6, 8, 10, 8, 12, 8, 10, 4 },
+    { 0, 0, 8, 8, 10, 12, 14, 12, 16, 12, 14, 8 }
+};
+
+/* Only valid for the modes accepted by the opcode table */
+static inline int ea_index(int mode, int reg)
+{
+    return (mode < 7 ? mode : 7 + reg);
+}
+
+#define EA_CYCLES(mode, reg, sz) ea_cycles[(sz) == 4][ea_index(mode, reg)]
+
+static UINT32 index_address(UINT32 base)
+{
+    UINT32 ext = fetch16();
+    INT32 idx = (ext & 0x8000) ? AREG((ext >> 12) & 7) : DREG((ext >> 12) & 7);
+    if (!(ext & 0x800))
+	idx = (INT16)idx;
+    return base + idx + (INT8)ext;
+}
+
+static UINT32 ea_address(int mode, int reg, int sz)
+{
+    UINT32 adr;
+    switch (mode) {
+    case 2:
+	return AREG(reg);
+    case 3:
+	adr = AREG(reg);
+	AREG(reg) += (reg == 7 && sz == 1) ? 2 : sz;
+	return adr;
+    case 4:
+	AREG(reg) -= (reg == 7 && sz == 1) ? 2 : sz;
+	return AREG(reg);
+    case 5:
+	return AREG(reg) + (INT16)fetch16();
+    case 6:
+	return index_address(AREG(reg));
+    default:
+	switch (reg) {
+	case 0: return (INT16)fetch16();
+	case 1: return fetch32();
+	case 2: adr = pc; return adr + (INT16)fetch16();
+	default: return index_address(pc);
+	}
+    }
+}
+
+static void set_dreg(int reg, UINT32 data, int sz)
+{
+    if (sz == 4)
+	DREG(reg) = data;
+    else
+	DREG(reg) = (DREG(reg) & ~size_mask[sz]) | (data & size_mask[sz]);
+}
+
+/* Read an operand and remember its address for a later ea_store */
+static UINT32 ea_fetch(int mode, int reg, int sz, UINT32 *adr)
+{
+    switch (mode) {
+    case 0: return DREG(reg) & size_mask[sz];
+    case 1: return AREG(reg) & size_mask[sz];
+    case 7:
+	if (reg == 4)
+	    return (sz == 4 ? fetch32() : fetch16() & size_mask[sz]);
+    }
+    *adr = ea_address(mode, reg, sz);
+    return read_mem(*adr, sz);
+}
+
+static void ea_store(int mode, int reg, int sz, UINT32 adr, UINT32 data)
+{
+    if (mode == 0)
+	set_dreg(reg, data, sz);
+    else if (mode == 1)
+	AREG(reg) = data;
+    else
+	write_mem(adr, sz, data);
+}
+
+static UINT32 read_ea(int mode, int reg, int sz)
+{
+    UINT32 adr;
+    return ea_fetch(mode, reg, sz, &adr);
+}
+
+static void write_ea(int mode, int reg, int sz, UINT32 data)
+{
+    if (mode == 0)
+	set_dreg(reg, data, sz);
+    else if (mode == 1)
+	AREG(reg) = data;
+    else
+	write_mem(ea_address(mode, reg, sz), sz, data);
+}
+
+/******************************************************************************/
+/*  ALU                                                                       */
+/******************************************************************************/
+
+static inline void logic_flags(UINT32 res, int sz)
+{
+    flag_n = (res & size_msb[sz]) != 0;
+    flag_z = (res & size_mask[sz]) == 0;
+    flag_v = flag_c = 0;
+}
+
+static UINT32 alu_add(UINT32 src, UINT32 dst, int sz)
+{
+    UINT32 res = (dst + src) & size_mask[sz];
+    flag_n = (res & size_msb[sz]) != 0;
+    flag_z = res == 0;
+    flag_v = ((src ^ res) & (dst ^ res) & size_msb[sz]) != 0;
+    flag_x = flag_c = (sz == 4 ? res < dst : (dst + src) > size_mask[sz]);
+    return res;
+}
+
+static UINT32 alu_sub(UINT32 src, UINT32 dst, int sz)
+{
+    UINT32 res = (dst - src) & size_mask[sz];
+    flag_n = (res & size_msb[sz]) != 0;
+    flag_z = res == 0;
+    flag_v = ((src ^ dst) & (res ^ dst) & size_msb[sz]) != 0;
+    flag_x = flag_c = src > dst;
+    return res;
+}
+
+static void alu_cmp(UINT32 src, UINT32 dst, int sz)
+{
+    UINT32 res = (dst - src) & size_mask[sz];
+    flag_n = (res & size_msb[sz]) != 0;
+    flag_z = res == 0;
+    flag_v = ((src ^ dst) & (res ^ dst) & size_msb[sz]) != 0;
+    flag_c = src > dst;
+}
+
+static UINT32 alu_addx(UINT32 src, UINT32 dst, int sz)
+{
+    UINT64 full = (UINT64)dst + src + flag_x;
+    UINT32 res = full & size_mask[sz];
+    flag_n = (res & size_msb[sz]) != 0;
+    if (res) flag_z = 0;
+    flag_v = ((src ^ res) & (dst ^ res) & size_msb[sz]) != 0;
+    flag_x = flag_c = full > size_mask[sz];
+    return res;
+}
+
+static UINT32 alu_subx(UINT32 src, UINT32 dst, int sz)
+{
+    UINT32 res = (dst - src - flag_x) & size_mask[sz];
+    flag_n = (res & size_msb[sz]) != 0;
+    if (res) flag_z = 0;
+    flag_v = ((src ^ dst) & (res ^ dst) & size_msb[sz]) != 0;
+    flag_x = flag_c = (UINT64)src + flag_x > dst;
+    return res;
+}
+
+static int test_cc(int cc)
+{
+    switch (cc) {
+    case 0: return 1;
+    case 1: return 0;
+    case 2: return !flag_c && !flag_z;
+    case 3: return flag_c || flag_z;
+    case 4: return !flag_c;
+    case 5: return flag_c;
+    case 6: return !flag_z;
+    case 7: return flag_z;
+    case 8: return !flag_v;
+    case 9: return flag_v;
+    case 10: return !flag_n;
+    case 11: return flag_n;
+    case 12: return flag_n == flag_v;
+    case 13: return flag_n != flag_v;
+    case 14: return !flag_z && flag_n == flag_v;
+    default: return flag_z || flag_n != flag_v;
+    }
+}
+
+/******************************************************************************/
+/*  Instructions                                                              */
+/******************************************************************************/
+
+static void op_illegal(UINT32 op)
+{
+    int vector = 4;
+    if ((op >> 12) == 0xa) vector = 10;
+    else if ((op >> 12) == 0xf) vector = 11;
+    exception_here(vector, pc - 2);
+}
+
+static int check_supervisor(void)
+{
+    if (s68000context.sr & 0x2000)
+	return 1;
+    exception_here(8, pc - 2);
+    return 0;
+}
+
+/* ORI/ANDI/SUBI/ADDI/EORI/CMPI */
+static void op_imm(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 src = (sz == 4 ? fetch32() : fetch16() & size_mask[sz]);
+    UINT32 adr = 0, dst = ea_fetch(mode, reg, sz, &adr), res;
+    int type = (op >> 9) & 7;
+    switch (type) {
+    case 0: res = dst | src; logic_flags(res, sz); break;
+    case 1: res = dst & src; logic_flags(res, sz); break;
+    case 2: res = alu_sub(src, dst, sz); break;
+    case 3: res = alu_add(src, dst, sz); break;
+    case 5: res = dst ^ src; logic_flags(res, sz); break;
+    default:
+	alu_cmp(src, dst, sz);
+	USE_CYCLES((mode ? 8 : (sz == 4 ? 14 : 8)) + (mode ? EA_CYCLES(mode, reg, sz) : 0));
+	return;
+    }
+    ea_store(mode, reg, sz, adr, res);
+    if (mode == 0)
+	USE_CYCLES(sz == 4 ? 16 : 8);
+    else
+	USE_CYCLES((sz == 4 ? 20 : 12) + EA_CYCLES(mode, reg, sz));
+}
+
+/* ORI/ANDI/EORI to CCR and SR */
+static void op_imm_sr(UINT32 op)
+{
+    UINT32 src = fetch16(), sr;
+    if (op & 0x40) {
+	if (!check_supervisor()) return;
+	sr = get_sr();
+    } else {
+	src &= 0x1f;
+	sr = get_ccr();
+    }
+    switch ((op >> 9) & 7) {
+    case 0: sr |= src; break;
+    case 1: sr &= src | (op & 0x40 ? 0 : 0xff00); break;
+    default: sr ^= src; break;
+    }
+    if (op & 0x40)
+	set_sr(sr);
+    else
+	set_ccr(sr);
+    USE_CYCLES(20);
+}
+
+/* BTST/BCHG/BCLR/BSET, dynamic (bit number in Dn) or static (immediate) */
+static void op_bit(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 bit = (op & 0x100) ? DREG(REG_X(op)) : fetch16();
+    int type = (op >> 6) & 3, cycles = (op & 0x100) ? 0 : 4;
+    UINT32 adr = 0, data, mask;
+    if (mode == 0) {
+	mask = 1 << (bit & 31);
+	data = DREG(reg);
+	cycles += (type == 0 ? 6 : (type == 2 ? 10 : 8));
+    } else {
+	mask = 1 << (bit & 7);
+	data = ea_fetch(mode, reg, 1, &adr);
+	cycles += (type == 0 ? 4 : 8) + EA_CYCLES(mode, reg, 1);
+    }
+    flag_z = (data & mask) == 0;
+    USE_CYCLES(cycles);
+    switch (type) {
+    case 0: return;
+    case 1: data ^= mask; break;
+    case 2: data &= ~mask; break;
+    case 3: data |= mask; break;
+    }
+    if (mode == 0)
+	DREG(reg) = data;
+    else
+	write_byte(adr, data);
+}
+
+static void op_movep(UINT32 op)
+{
+    UINT32 adr = AREG(EA_REG(op)) + (INT16)fetch16();
+    int dn = REG_X(op);
+    switch ((op >> 6) & 3) {
+    case 0:
+	set_dreg(dn, (read_byte(adr) << 8) | read_byte(adr+2), 2);
+	USE_CYCLES(16);
+	break;
+    case 1:
+	DREG(dn) = (read_byte(adr) << 24) | (read_byte(adr+2) << 16) |
+	    (read_byte(adr+4) << 8) | read_byte(adr+6);
+	USE_CYCLES(24);
+	break;
+    case 2:
+	write_byte(adr, DREG(dn) >> 8);
+	write_byte(adr+2, DREG(dn));
+	USE_CYCLES(16);
+	break;
+    default:
+	write_byte(adr, DREG(dn) >> 24);
+	write_byte(adr+2, DREG(dn) >> 16);
+	write_byte(adr+4, DREG(dn) >> 8);
+	write_byte(adr+6, DREG(dn));
+	USE_CYCLES(24);
+	break;
+    }
+}
+
+static void op_move(UINT32 op)
+{
+    static const int move_size[4] = { 0, 1, 4, 2 };
+    int sz = move_size[op >> 12];
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    int dmode = (op >> 6) & 7, dreg = REG_X(op);
+    UINT32 data = read_ea(mode, reg, sz);
+    logic_flags(data, sz);
+    write_ea(dmode, dreg, sz, data);
+    USE_CYCLES(4 + EA_CYCLES(mode, reg, sz) +
+	    (dmode == 4 ? EA_CYCLES(2, 0, sz) : EA_CYCLES(dmode, dreg, sz)));
+}
+
+static void op_movea(UINT32 op)
+{
+    int sz = (op & 0x1000) ? 2 : 4;
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 data = read_ea(mode, reg, sz);
+    AREG(REG_X(op)) = (sz == 2 ? (INT16)data : data);
+    USE_CYCLES(4 + EA_CYCLES(mode, reg, sz));
+}
+
+/* NEGX/CLR/NEG/NOT */
+static void op_unary(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = 0, dst = 0, res;
+    int type = (op >> 9) & 3;
+    if (type != 1)
+	dst = ea_fetch(mode, reg, sz, &adr);
+    else if (mode)
+	adr = ea_address(mode, reg, sz);
+    switch (type) {
+    case 0: res = alu_subx(dst, 0, sz); break;
+    case 1: res = 0; logic_flags(0, sz); break;
+    case 2: res = alu_sub(dst, 0, sz); break;
+    default: res = ~dst & size_mask[sz]; logic_flags(res, sz); break;
+    }
+    ea_store(mode, reg, sz, adr, res);
+    if (mode == 0)
+	USE_CYCLES(sz == 4 ? 6 : 4);
+    else
+	USE_CYCLES((sz == 4 ? 12 : 8) + EA_CYCLES(mode, reg, sz));
+}
+
+static void op_move_from_sr(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    write_ea(mode, reg, 2, get_sr());
+    USE_CYCLES(mode ? 8 + EA_CYCLES(mode, reg, 2) : 6);
+}
+
+static void op_move_to_ccr(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    set_ccr(read_ea(mode, reg, 2));
+    USE_CYCLES(12 + EA_CYCLES(mode, reg, 2));
+}
+
+static void op_move_to_sr(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    if (!check_supervisor()) return;
+    set_sr(read_ea(mode, reg, 2));
+    USE_CYCLES(12 + EA_CYCLES(mode, reg, 2));
+    if (!(s68000context.sr & 0x2000))
+	rebase();
+}
+
+static void op_chk(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    INT16 bound = read_ea(mode, reg, 2);
+    INT16 val = DREG(REG_X(op));
+    USE_CYCLES(10 + EA_CYCLES(mode, reg, 2));
+    if (val < 0 || val > bound) {
+	flag_n = val < 0;
+	trap(6, 40);
+    }
+}
+
+static void op_lea(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    AREG(REG_X(op)) = ea_address(mode, reg, 4);
+    USE_CYCLES(EA_CYCLES(mode, reg, 2) + (mode == 6 || (mode == 7 && reg == 3) ? 2 : 0));
+}
+
+static void op_pea(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    push32(ea_address(mode, reg, 4));
+    USE_CYCLES(8 + EA_CYCLES(mode, reg, 2) + (mode == 6 || (mode == 7 && reg == 3) ? 2 : 0));
+}
+
+static void op_nbcd(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = 0, dst = ea_fetch(mode, reg, 1, &adr);
+    UINT32 res = (0x9a - dst - flag_x) & 0xff;
+    if (res != 0x9a) {
+	if ((res & 0x0f) == 0x0a)
+	    res = (res & 0xf0) + 0x10;
+	res &= 0xff;
+	ea_store(mode, reg, 1, adr, res);
+	if (res) flag_z = 0;
+	flag_c = flag_x = 1;
+    } else {
+	flag_c = flag_x = 0;
+	res = 0;
+    }
+    flag_n = (res & 0x80) != 0;
+    USE_CYCLES(mode ? 8 + EA_CYCLES(mode, reg, 1) : 6);
+}
+
+static void op_swap(UINT32 op)
+{
+    UINT32 *d = &DREG(EA_REG(op));
+    *d = (*d >> 16) | (*d << 16);
+    logic_flags(*d, 4);
+    USE_CYCLES(4);
+}
+
+static void op_ext(UINT32 op)
+{
+    int reg = EA_REG(op);
+    if (op & 0x40) {
+	DREG(reg) = (INT16)DREG(reg);
+	logic_flags(DREG(reg), 4);
+    } else {
+	set_dreg(reg, (INT8)DREG(reg), 2);
+	logic_flags(DREG(reg), 2);
+    }
+    USE_CYCLES(4);
+}
+
+static void op_movem_to_mem(UINT32 op)
+{
+    UINT32 list = fetch16();
+    int sz = (op & 0x40) ? 4 : 2;
+    int mode = EA_MODE(op), reg = EA_REG(op), n, count = 0;
+    UINT32 adr;
+    if (mode == 4) {
+	/* predecrement : the list is reversed (bit 0 = a7) */
+	adr = AREG(reg);
+	for (n = 0; n < 16; n++) {
+	    if (list & (1 << n)) {
+		adr -= sz;
+		write_mem(adr, sz, n < 8 ? AREG(7-n) : DREG(15-n));
+		count++;
+	    }
+	}
+	AREG(reg) = adr;
+    } else {
+	adr = ea_address(mode, reg, sz);
+	for (n = 0; n < 16; n++) {
+	    if (list & (1 << n)) {
+		write_mem(adr, sz, n < 8 ? DREG(n) : AREG(n-8));
+		adr += sz;
+		count++;
+	    }
+	}
+    }
+    USE_CYCLES(8 + count*(sz == 4 ? 8 : 4) + (mode == 4 ? 0 : EA_CYCLES(mode, reg, 2)));
+}
+
+static void op_movem_to_reg(UINT32 op)
+{
+    UINT32 list = fetch16();
+    int sz = (op & 0x40) ? 4 : 2;
+    int mode = EA_MODE(op), reg = EA_REG(op), n, count = 0;
+    UINT32 adr, data;
+    adr = (mode == 3 ? AREG(reg) : ea_address(mode, reg, sz));
+    for (n = 0; n < 16; n++) {
+	if (list & (1 << n)) {
+	    data = read_mem(adr, sz);
+	    if (sz == 2) data = (INT16)data;
+	    if (n < 8) DREG(n) = data; else AREG(n-8) = data;
+	    adr += sz;
+	    count++;
+	}
+    }
+    if (mode == 3)
+	AREG(reg) = adr;
+    USE_CYCLES(12 + count*(sz == 4 ? 8 : 4) + (mode == 3 ? 0 : EA_CYCLES(mode, reg, 2)));
+}
+
+static void op_tst(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    logic_flags(read_ea(mode, reg, sz), sz);
+    USE_CYCLES(4 + EA_CYCLES(mode, reg, sz));
+}
+
+static void op_tas(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = 0, data = ea_fetch(mode, reg, 1, &adr);
+    logic_flags(data, 1);
+    ea_store(mode, reg, 1, adr, data | 0x80);
+    USE_CYCLES(mode ? 14 + EA_CYCLES(mode, reg, 1) : 4);
+}
+
+static void op_trap(UINT32 op)
+{
+    trap(32 + (op & 15), 34);
+}
+
+static void op_link(UINT32 op)
+{
+    int reg = EA_REG(op);
+    INT16 disp;
+    push32(AREG(reg));
+    AREG(reg) = AREG(7);
+    disp = fetch16();
+    AREG(7) += disp;
+    USE_CYCLES(16);
+}
+
+static void op_unlk(UINT32 op)
+{
+    int reg = EA_REG(op);
+    AREG(7) = AREG(reg);
+    AREG(reg) = pop32();
+    USE_CYCLES(12);
+}
+
+static void op_move_usp(UINT32 op)
+{
+    if (!check_supervisor()) return;
+    if (op & 8)
+	AREG(EA_REG(op)) = s68000context.asp;
+    else
+	s68000context.asp = AREG(EA_REG(op));
+    USE_CYCLES(4);
+}
+
+static void op_reset(UINT32 op)
+{
+    if (!check_supervisor()) return;
+    if (!s68000context.resethandler) {
+	pc -= 2;
+	abort_exec(pc);
+	return;
+    }
+    s68000context.resethandler();
+    USE_CYCLES(132);
+}
+
+static void op_nop(UINT32 op)
+{
+    USE_CYCLES(4);
+}
+
+static void op_stop(UINT32 op)
+{
+    UINT32 sr;
+    if (!check_supervisor()) return;
+    sr = fetch16();
+    set_sr(sr);
+    USE_CYCLES(4);
+    s68000context.interrupts[0] |= 1;
+    /* If no interrupt can wake us up now, the rest of the slice is lost */
+    if (!(s68000context.interrupts[0] & irq_mask))
+	remaining = 0;
+}
+
+static void op_rte(UINT32 op)
+{
+    UINT32 sr;
+    if (!check_supervisor()) return;
+    sr = pop16();
+    pc = pop32();
+    set_sr(sr);
+    rebase();
+    USE_CYCLES(20);
+}
+
+static void op_rts(UINT32 op)
+{
+    pc = pop32();
+    rebase();
+    USE_CYCLES(16);
+}
+
+static void op_trapv(UINT32 op)
+{
+    if (flag_v)
+	trap(7, 34);
+    else
+	USE_CYCLES(4);
+}
+
+static void op_rtr(UINT32 op)
+{
+    set_ccr(pop16());
+    pc = pop32();
+    rebase();
+    USE_CYCLES(20);
+}
+
+static const UINT8 jmp_cycles[12] = { 0, 0, 8, 0, 0, 10, 14, 10, 12, 10, 14, 0 };
+
+static void op_jsr(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = ea_address(mode, reg, 4);
+    push32(pc);
+    pc = adr;
+    rebase();
+    USE_CYCLES(jmp_cycles[ea_index(mode, reg)] + 8);
+}
+
+static void op_jmp(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    pc = ea_address(mode, reg, 4);
+    rebase();
+    USE_CYCLES(jmp_cycles[ea_index(mode, reg)]);
+}
+
+/* ADDQ/SUBQ */
+static void op_addq(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 src = ((op >> 9) & 7), adr = 0, dst, res;
+    if (!src) src = 8;
+    if (mode == 1) {
+	/* No flags and always 32 bits with an address register */
+	AREG(reg) += (op & 0x100) ? -src : src;
+	USE_CYCLES(8);
+	return;
+    }
+    dst = ea_fetch(mode, reg, sz, &adr);
+    res = (op & 0x100) ? alu_sub(src, dst, sz) : alu_add(src, dst, sz);
+    ea_store(mode, reg, sz, adr, res);
+    if (mode == 0)
+	USE_CYCLES(sz == 4 ? 8 : 4);
+    else
+	USE_CYCLES((sz == 4 ? 12 : 8) + EA_CYCLES(mode, reg, sz));
+}
+
+static void op_scc(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    int cond = test_cc((op >> 8) & 15);
+    write_ea(mode, reg, 1, cond ? 0xff : 0);
+    if (mode == 0)
+	USE_CYCLES(cond ? 6 : 4);
+    else
+	USE_CYCLES(8 + EA_CYCLES(mode, reg, 1));
+}
+
+/* Host addresses of the bcc instructions which close a busy wait loop, found
+ * by the idle loop detector (speed_hack.c). When one of them branches back,
+ * nothing can change before the next interrupt so the timeslice ends there */
+#define MAX_IDLE_LOOPS 8
+static UINT8 *idle_loop[MAX_IDLE_LOOPS];
+static int idle_count;
+
+static int is_idle_loop(UINT8 *host)
+{
+    int n;
+    for (n = 0; n < idle_count; n++)
+	if (idle_loop[n] == host)
+	    return 1;
+    return 0;
+}
+
+static void op_dbcc(UINT32 op)
+{
+    UINT32 base = pc;
+    INT16 disp = fetch16();
+    int reg = EA_REG(op);
+    if (!test_cc((op >> 8) & 15)) {
+	UINT32 count = (DREG(reg) - 1) & 0xffff;
+	set_dreg(reg, count, 2);
+	if (count != 0xffff) {
+	    pc = base + disp;
+	    rebase();
+	    USE_CYCLES(10);
+	} else
+	    USE_CYCLES(14);
+    } else
+	USE_CYCLES(12);
+}
+
+static void op_bcc(UINT32 op)
+{
+    UINT32 base = pc;
+    INT32 disp = (INT8)op;
+    int cond = (op >> 8) & 15;
+    if (!disp)
+	disp = (INT16)fetch16();
+    if (cond == 1) {
+	/* BSR */
+	push32(pc);
+	pc = base + disp;
+	rebase();
+	USE_CYCLES(18);
+    } else if (test_cc(cond)) {
+	UINT8 *host = fetch_base + base - 2;
+	pc = base + disp;
+	rebase();
+	USE_CYCLES(10);
+	if (idle_count && disp < 0 && is_idle_loop(host))
+	    s68000releaseTimeslice();
+    } else
+	USE_CYCLES((op & 0xff) ? 8 : 12);
+}
+
+static void op_moveq(UINT32 op)
+{
+    UINT32 data = (INT8)op;
+    DREG(REG_X(op)) = data;
+    logic_flags(data, 4);
+    USE_CYCLES(4);
+}
+
+/* OR/AND/ADD/SUB <ea>,Dn and Dn,<ea> */
+static void op_arith(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    int dn = REG_X(op), to_ea = op & 0x100;
+    UINT32 adr = 0, src, dst, res;
+    if (to_ea) {
+	src = DREG(dn) & size_mask[sz];
+	dst = ea_fetch(mode, reg, sz, &adr);
+    } else {
+	src = read_ea(mode, reg, sz);
+	dst = DREG(dn) & size_mask[sz];
+    }
+    switch (op >> 12) {
+    case 0x8: res = dst | src; logic_flags(res, sz); break;
+    case 0xc: res = dst & src; logic_flags(res, sz); break;
+    case 0x9: res = alu_sub(src, dst, sz); break;
+    default: res = alu_add(src, dst, sz); break;
+    }
+    if (to_ea) {
+	ea_store(mode, reg, sz, adr, res);
+	USE_CYCLES((sz == 4 ? 12 : 8) + EA_CYCLES(mode, reg, sz));
+    } else {
+	set_dreg(dn, res, sz);
+	if (sz == 4)
+	    USE_CYCLES((mode < 2 || (mode == 7 && reg == 4) ? 8 : 6) + EA_CYCLES(mode, reg, sz));
+	else
+	    USE_CYCLES(4 + EA_CYCLES(mode, reg, sz));
+    }
+}
+
+static void op_eor(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = 0, res = ea_fetch(mode, reg, sz, &adr) ^ DREG(REG_X(op));
+    res &= size_mask[sz];
+    logic_flags(res, sz);
+    ea_store(mode, reg, sz, adr, res);
+    if (mode == 0)
+	USE_CYCLES(sz == 4 ? 8 : 4);
+    else
+	USE_CYCLES((sz == 4 ? 12 : 8) + EA_CYCLES(mode, reg, sz));
+}
+
+static void op_cmp(UINT32 op)
+{
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    alu_cmp(read_ea(mode, reg, sz), DREG(REG_X(op)) & size_mask[sz], sz);
+    USE_CYCLES((sz == 4 ? 6 : 4) + EA_CYCLES(mode, reg, sz));
+}
+
+/* ADDA/SUBA/CMPA */
+static void op_arith_a(UINT32 op)
+{
+    int sz = (op & 0x100) ? 4 : 2, mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 src = read_ea(mode, reg, sz);
+    UINT32 *an = &AREG(REG_X(op));
+    if (sz == 2) src = (INT16)src;
+    switch (op >> 12) {
+    case 0x9: *an -= src; break;
+    case 0xd: *an += src; break;
+    default: alu_cmp(src, *an, 4); USE_CYCLES(6 + EA_CYCLES(mode, reg, sz)); return;
+    }
+    USE_CYCLES((sz == 2 || mode < 2 || (mode == 7 && reg == 4) ? 8 : 6) +
+	    EA_CYCLES(mode, reg, sz));
+}
+
+/* ADDX/SUBX */
+static void op_addx(UINT32 op)
+{
+    int sz = OP_SIZE(op), rx = REG_X(op), ry = EA_REG(op);
+    UINT32 src, dst, res;
+    int sub = (op >> 12) == 0x9;
+    if (op & 8) {
+	UINT32 adr_src = ea_address(4, ry, sz);
+	UINT32 adr_dst;
+	src = read_mem(adr_src, sz);
+	adr_dst = ea_address(4, rx, sz);
+	dst = read_mem(adr_dst, sz);
+	res = sub ? alu_subx(src, dst, sz) : alu_addx(src, dst, sz);
+	write_mem(adr_dst, sz, res);
+	USE_CYCLES(sz == 4 ? 30 : 18);
+    } else {
+	src = DREG(ry) & size_mask[sz];
+	dst = DREG(rx) & size_mask[sz];
+	res = sub ? alu_subx(src, dst, sz) : alu_addx(src, dst, sz);
+	set_dreg(rx, res, sz);
+	USE_CYCLES(sz == 4 ? 8 : 4);
+    }
+}
+
+static void op_cmpm(UINT32 op)
+{
+    int sz = OP_SIZE(op);
+    UINT32 src = read_mem(ea_address(3, EA_REG(op), sz), sz);
+    UINT32 dst = read_mem(ea_address(3, REG_X(op), sz), sz);
+    alu_cmp(src, dst, sz);
+    USE_CYCLES(sz == 4 ? 20 : 12);
+}
+
+/* ABCD/SBCD */
+static void op_bcd(UINT32 op)
+{
+    int rx = REG_X(op), ry = EA_REG(op);
+    UINT32 src, dst, res, adr = 0;
+    if (op & 8) {
+	src = read_byte(ea_address(4, ry, 1));
+	adr = ea_address(4, rx, 1);
+	dst = read_byte(adr);
+    } else {
+	src = DREG(ry) & 0xff;
+	dst = DREG(rx) & 0xff;
+    }
+    if ((op >> 12) == 0xc) {
+	res = (src & 0x0f) + (dst & 0x0f) + flag_x;
+	if (res > 9) res += 6;
+	res += (src & 0xf0) + (dst & 0xf0);
+	flag_x = flag_c = res > 0x99;
+	if (flag_c) res -= 0xa0;
+    } else {
+	res = (dst & 0x0f) - (src & 0x0f) - flag_x;
+	if (res > 9) res -= 6;
+	res += (dst & 0xf0) - (src & 0xf0);
+	flag_x = flag_c = res > 0x99;
+	if (flag_c) res += 0xa0;
+    }
+    res &= 0xff;
+    flag_n = (res & 0x80) != 0;
+    flag_v = 0;
+    if (res) flag_z = 0;
+    if (op & 8) {
+	write_byte(adr, res);
+	USE_CYCLES(18);
+    } else {
+	set_dreg(rx, res, 1);
+	USE_CYCLES(6);
+    }
+}
+
+static void op_mul(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op), dn = REG_X(op);
+    UINT32 src = read_ea(mode, reg, 2), res;
+    if (op & 0x100)
+	res = (INT16)src * (INT16)DREG(dn);
+    else
+	res = src * (DREG(dn) & 0xffff);
+    DREG(dn) = res;
+    logic_flags(res, 4);
+    USE_CYCLES(70 + EA_CYCLES(mode, reg, 2));
+}
+
+static void op_div(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op), dn = REG_X(op);
+    UINT32 src = read_ea(mode, reg, 2);
+    if (!src) {
+	USE_CYCLES(EA_CYCLES(mode, reg, 2));
+	trap(5, 38);
+	return;
+    }
+    flag_c = 0;
+    if (op & 0x100) {
+	INT64 quot = (INT64)(INT32)DREG(dn) / (INT16)src;
+	INT64 rem = (INT64)(INT32)DREG(dn) % (INT16)src;
+	if (quot != (INT16)quot) {
+	    flag_v = 1;
+	} else {
+	    DREG(dn) = (rem << 16) | (quot & 0xffff);
+	    flag_n = (quot & 0x8000) != 0;
+	    flag_z = (quot & 0xffff) == 0;
+	    flag_v = 0;
+	}
+	USE_CYCLES(158 + EA_CYCLES(mode, reg, 2));
+    } else {
+	UINT32 quot = DREG(dn) / src;
+	UINT32 rem = DREG(dn) % src;
+	if (quot > 0xffff) {
+	    flag_v = 1;
+	} else {
+	    DREG(dn) = (rem << 16) | quot;
+	    flag_n = (quot & 0x8000) != 0;
+	    flag_z = quot == 0;
+	    flag_v = 0;
+	}
+	USE_CYCLES(140 + EA_CYCLES(mode, reg, 2));
+    }
+}
+
+static void op_exg(UINT32 op)
+{
+    UINT32 *rx, *ry, tmp;
+    switch ((op >> 3) & 0x1f) {
+    case 0x08: rx = &DREG(REG_X(op)); ry = &DREG(EA_REG(op)); break;
+    case 0x09: rx = &AREG(REG_X(op)); ry = &AREG(EA_REG(op)); break;
+    default: rx = &DREG(REG_X(op)); ry = &AREG(EA_REG(op)); break;
+    }
+    tmp = *rx;
+    *rx = *ry;
+    *ry = tmp;
+    USE_CYCLES(6);
+}
+
+/* Shifts and rotations, type 0:AS 1:LS 2:ROX 3:RO */
+static UINT32 shift(int type, int left, UINT32 val, int count, int sz)
+{
+    int bits = sz*8;
+    UINT32 mask = size_mask[sz], res = val;
+    flag_v = 0;
+    if (!count)
+	flag_c = (type == 2 ? flag_x : 0);
+    else switch (type) {
+    case 0:
+	if (left) {
+	    if (count < bits) {
+		UINT32 top = (mask << (bits - count - 1)) & mask;
+		res = (val << count) & mask;
+		flag_c = (val >> (bits - count)) & 1;
+		flag_v = (val & top) != 0 && (val & top) != top;
+	    } else {
+		res = 0;
+		flag_c = (count == bits ? val & 1 : 0);
+		flag_v = val != 0;
+	    }
+	} else {
+	    INT32 sval = (sz == 1 ? (INT8)val : (sz == 2 ? (INT16)val : (INT32)val));
+	    if (count < bits) {
+		res = (sval >> count) & mask;
+		flag_c = (sval >> (count - 1)) & 1;
+	    } else {
+		res = (sval < 0 ? mask : 0);
+		flag_c = sval < 0;
+	    }
+	}
+	flag_x = flag_c;
+	break;
+    case 1:
+	if (count > bits) {
+	    res = 0;
+	    flag_c = 0;
+	} else if (left) {
+	    res = (count == bits ? 0 : (val << count) & mask);
+	    flag_c = (val >> (bits - count)) & 1;
+	} else {
+	    res = (count == bits ? 0 : val >> count);
+	    flag_c = (val >> (count - 1)) & 1;
+	}
+	flag_x = flag_c;
+	break;
+    case 2:
+	count %= bits + 1;
+	while (count--) {
+	    UINT32 out;
+	    if (left) {
+		out = (res & size_msb[sz]) != 0;
+		res = ((res << 1) | flag_x) & mask;
+	    } else {
+		out = res & 1;
+		res = (res >> 1) | (flag_x ? size_msb[sz] : 0);
+	    }
+	    flag_x = out;
+	}
+	flag_c = flag_x;
+	break;
+    default:
+	count %= bits;
+	if (count) {
+	    if (left)
+		res = ((val << count) | (val >> (bits - count))) & mask;
+	    else
+		res = ((val >> count) | (val << (bits - count))) & mask;
+	}
+	flag_c = left ? res & 1 : (res & size_msb[sz]) != 0;
+	break;
+    }
+    flag_n = (res & size_msb[sz]) != 0;
+    flag_z = res == 0;
+    return res;
+}
+
+static void op_shift_reg(UINT32 op)
+{
+    int sz = OP_SIZE(op), reg = EA_REG(op);
+    int count = REG_X(op);
+    if (op & 0x20)
+	count = DREG(count) & 63;
+    else if (!count)
+	count = 8;
+    set_dreg(reg, shift((op >> 3) & 3, op & 0x100, DREG(reg) & size_mask[sz], count, sz), sz);
+    USE_CYCLES((sz == 4 ? 8 : 6) + count*2);
+}
+
+static void op_shift_mem(UINT32 op)
+{
+    int mode = EA_MODE(op), reg = EA_REG(op);
+    UINT32 adr = ea_address(mode, reg, 2);
+    write_word(adr, shift((op >> 9) & 3, op & 0x100, read_word(adr), 1, 2));
+    USE_CYCLES(8 + EA_CYCLES(mode, reg, 2));
+}
+
+/******************************************************************************/
+/*  Opcode table                                                              */
+/******************************************************************************/
+
+/* Allowed addressing modes, bit n = ea_index n */
+#define EA_ALL       0xfff
+#define EA_DATA      0xffd
+#define EA_MEM       0xffc
+#define EA_DALT      0x1fd
+#define EA_MALT      0x1fc
+#define EA_ALT       0x1ff
+#define EA_CTRL      0x7e4
+#define EA_CALT      0x1e4
+#define EA_NOIMM     0x7fd
+#define EA_MOVEM_W   0x1f4
+#define EA_MOVEM_R   0x7ec
+
+typedef struct {
+    op_handler handler;
+    UINT16 mask, match;
+    UINT16 ea;     // allowed modes for bits 0-5, 0 = no ea there
+    UINT16 ea_dst; // allowed modes for the destination of move
+} OPCODE_INFO;
+
+static const OPCODE_INFO opcodes[] = {
+    { op_imm_sr,        0xffbf, 0x003c, 0, 0 },
+    { op_imm_sr,        0xffbf, 0x023c, 0, 0 },
+    { op_imm_sr,        0xffbf, 0x0a3c, 0, 0 },
+    { op_imm,           0xf100, 0x0000, EA_DALT, 0 }, // ORI..CMPI, size checked below
+    { op_movep,         0xf138, 0x0108, 0, 0 },
+    { op_bit,           0xf1c0, 0x0100, EA_DATA, 0 },
+    { op_bit,           0xf100, 0x0100, EA_DALT, 0 },
+    { op_bit,           0xffc0, 0x0800, EA_NOIMM & ~2, 0 },
+    { op_bit,           0xff00, 0x0800, EA_DALT, 0 },
+    { op_move,          0xf000, 0x1000, EA_DATA, EA_DALT },
+    { op_move,          0xf000, 0x2000, EA_ALL, EA_DALT },
+    { op_move,          0xf000, 0x3000, EA_ALL, EA_DALT },
+    { op_movea,         0xf1c0, 0x2040, EA_ALL, 0 },
+    { op_movea,         0xf1c0, 0x3040, EA_ALL, 0 },
+    { op_move_from_sr,  0xffc0, 0x40c0, EA_DALT, 0 },
+    { op_move_to_ccr,   0xffc0, 0x44c0, EA_DATA, 0 },
+    { op_move_to_sr,    0xffc0, 0x46c0, EA_DATA, 0 },
+    { op_unary,         0xf900, 0x4000, EA_DALT, 0 }, // NEGX/CLR/NEG/NOT
+    { op_chk,           0xf1c0, 0x4180, EA_DATA, 0 },
+    { op_lea,           0xf1c0, 0x41c0, EA_CTRL, 0 },
+    { op_nbcd,          0xffc0, 0x4800, EA_DALT, 0 },
+    { op_swap,          0xfff8, 0x4840, 0, 0 },
+    { op_pea,           0xffc0, 0x4840, EA_CTRL, 0 },
+    { op_ext,           0xffb8, 0x4880, 0, 0 },
+    { op_movem_to_mem,  0xff80, 0x4880, EA_MOVEM_W, 0 },
+    { op_movem_to_reg,  0xff80, 0x4c80, EA_MOVEM_R, 0 },
+    { op_illegal,       0xffff, 0x4afc, 0, 0 },
+    { op_tas,           0xffc0, 0x4ac0, EA_DALT, 0 },
+    { op_tst,           0xff00, 0x4a00, EA_DALT, 0 },
+    { op_trap,          0xfff0, 0x4e40, 0, 0 },
+    { op_link,          0xfff8, 0x4e50, 0, 0 },
+    { op_unlk,          0xfff8, 0x4e58, 0, 0 },
+    { op_move_usp,      0xfff0, 0x4e60, 0, 0 },
+    { op_reset,         0xffff, 0x4e70, 0, 0 },
+    { op_nop,           0xffff, 0x4e71, 0, 0 },
+    { op_stop,          0xffff, 0x4e72, 0, 0 },
+    { op_rte,           0xffff, 0x4e73, 0, 0 },
+    { op_rts,           0xffff, 0x4e75, 0, 0 },
+    { op_trapv,         0xffff, 0x4e76, 0, 0 },
+    { op_rtr,           0xffff, 0x4e77, 0, 0 },
+    { op_jsr,           0xffc0, 0x4e80, EA_CTRL, 0 },
+    { op_jmp,           0xffc0, 0x4ec0, EA_CTRL, 0 },
+    { op_dbcc,          0xf0f8, 0x50c8, 0, 0 },
+    { op_scc,           0xf0c0, 0x50c0, EA_DALT, 0 },
+    { op_addq,          0xf000, 0x5000, EA_ALT, 0 },
+    { op_bcc,           0xf000, 0x6000, 0, 0 },
+    { op_moveq,         0xf100, 0x7000, 0, 0 },
+    { op_div,           0xf0c0, 0x80c0, EA_DATA, 0 },
+    { op_bcd,           0xb1f0, 0x8100, 0, 0 }, // SBCD/ABCD
+    { op_exg,           0xf1f8, 0xc140, 0, 0 },
+    { op_exg,           0xf1f8, 0xc148, 0, 0 },
+    { op_exg,           0xf1f8, 0xc188, 0, 0 },
+    { op_mul,           0xf0c0, 0xc0c0, EA_DATA, 0 },
+    { op_arith,         0xb100, 0x8000, EA_DATA, 0 }, // OR/AND <ea>,Dn
+    { op_arith,         0xb100, 0x8100, EA_MALT, 0 }, // OR/AND Dn,<ea>
+    { op_arith_a,       0xb0c0, 0x90c0, EA_ALL, 0 },  // SUBA/ADDA
+    { op_addx,          0xb130, 0x9100, 0, 0 },       // SUBX/ADDX
+    { op_arith,         0xb100, 0x9000, EA_ALL, 0 },  // SUB/ADD <ea>,Dn
+    { op_arith,         0xb100, 0x9100, EA_MALT, 0 }, // SUB/ADD Dn,<ea>
+    { op_arith_a,       0xf0c0, 0xb0c0, EA_ALL, 0 },  // CMPA
+    { op_cmpm,          0xf138, 0xb108, 0, 0 },
+    { op_eor,           0xf100, 0xb100, EA_DALT, 0 },
+    { op_cmp,           0xf100, 0xb000, EA_ALL, 0 },
+    { op_shift_mem,     0xf8c0, 0xe0c0, EA_MALT, 0 },
+    { op_shift_reg,     0xf000, 0xe000, 0, 0 },
+};
+
+static int ea_allowed(UINT32 allowed, int mode, int reg)
+{
+    if (mode == 7 && reg > 4)
+	return 0;
+    return (allowed & (1 << ea_index(mode, reg))) != 0;
+}
+
+static int count_bits(UINT32 mask)
+{
+    int n = 0;
+    while (mask) {
+	n += mask & 1;
+	mask >>= 1;
+    }
+    return n;
+}
+
+static int has_size_field(op_handler h)
+{
+    return h == op_imm || h == op_unary || h == op_tst || h == op_addq ||
+	h == op_arith || h == op_eor || h == op_cmp || h == op_addx ||
+	h == op_cmpm || h == op_shift_reg;
+}
+
+static void build_optable(void)
+{
+    int op, bits, n;
+    for (op = 0; op < 0x10000; op++)
+	optable[op] = op_illegal;
+    /* The most specific masks first */
+    for (bits = 16; bits >= 0; bits--) {
+	for (n = 0; n < ARRAY_LENGTH(opcodes); n++) {
+	    const OPCODE_INFO *info = &opcodes[n];
+	    if (count_bits(info->mask) != bits)
+		continue;
+	    for (op = 0; op < 0x10000; op++) {
+		if ((op & info->mask) != info->match || optable[op] != op_illegal)
+		    continue;
+		if (has_size_field(info->handler)) {
+		    /* Size 3 is either invalid or another instruction, and An can't
+		     * be accessed as a byte. Bits 5-3 are only an EA mode when there
+		     * is an EA : for addx/subx, cmpm and the register shifts, 001
+		     * is the -(Ay),-(Ax) form, (Ay)+,(Ax)+ or a shift type */
+		    if (((op >> 6) & 3) == 3 ||
+			(info->ea && ((op >> 6) & 3) == 0 && EA_MODE(op) == 1))
+			continue;
+		}
+		if (info->handler == op_imm && (((op >> 9) & 7) == 4 || ((op >> 9) & 7) == 7))
+		    continue;
+		if (info->ea && !ea_allowed(info->ea, EA_MODE(op), EA_REG(op)))
+		    continue;
+		if (info->ea_dst && !ea_allowed(info->ea_dst, (op >> 6) & 7, REG_X(op)))
+		    continue;
+		optable[op] = info->handler;
+	    }
+	}
+    }
+}
+
+/******************************************************************************/
+/*  x86-64 recompiler                                                         */
+/******************************************************************************/
+
+/* Optional (C68000_JIT=1 in the makefile, native x86-64 builds only).
+ * Basic blocks are translated to native code. The simple instructions working
+ * on registers and immediate values (moveq, move, add, sub, cmp, logical
+ * ops, addq, adda, lea...) are emitted inline using the flags of the host,
+ * everything else becomes a direct call to its handler above, so that the
+ * opcode fetch and the table lookup of the interpreter disappear. The handlers
+ * still fetch their extension words from pc, so pc is set before each call.
+ * After each instruction the remaining cycles are tested, this way a memory
+ * handler which calls s68000releaseTimeslice (Stop68000) stops the block at
+ * once. Interrupts are checked between blocks, and when a block loops on
+ * itself.
+ *
+ * The blocks are kept in a direct mapped cache keyed by pc and host address
+ * of the code. Blocks which come from a ram area (there is a direct write
+ * region covering them) keep a copy of their code and are checked before
+ * being executed : this catches self modifying code, dma and files loaded by
+ * neocd, savegames... A block which keeps changing is left to the
+ * interpreter. Rom patches done from outside (speed hacks, debuger) must call
+ * c68000_flush_code (flush_68000_code in starhelp.c). */
+
+#if defined(C68000_JIT) && defined(__x86_64__)
+
+#ifdef RAINE_WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#define JIT_ENTRIES     0x4000
+#define JIT_BUFFER_SIZE (16*1024*1024)
+#define JIT_MAX_OPS     32
+#define JIT_MAX_FAILS   4
+/* Worst case size of a block, see jit_translate */
+#define JIT_MAX_BLOCK   (128 + JIT_MAX_OPS*80 + JIT_MAX_OPS*5*2)
+
+typedef struct {
+    UINT8 *host;      // host address of the 1st instruction
+    UINT32 pc;
+    UINT16 words;     // size of the code of the block in words
+    UINT8 fails;      // number of times a ram block changed
+    void (*code)(void); // NULL = interpreted
+    UINT16 *copy;     // copy of the code for ram blocks, NULL for rom
+} JIT_BLOCK;
+
+static JIT_BLOCK jit_table[JIT_ENTRIES];
+static UINT8 *jit_buffer, *jit_ptr;
+static int jit_disabled;
+
+static int ea_words(int mode, int reg, int sz)
+{
+    switch (mode) {
+    case 5: case 6: return 1;
+    case 7:
+	if (reg == 1) return 2;
+	if (reg == 4) return (sz == 4 ? 2 : 1);
+	return 1;
+    }
+    return 0;
+}
+
+/* Size in words of an instruction, including the opcode */
+static int op_words(UINT32 op)
+{
+    op_handler h = optable[op];
+    int mode = EA_MODE(op), reg = EA_REG(op), sz = OP_SIZE(op);
+    if (h == op_imm) return 1 + (sz == 4 ? 2 : 1) + ea_words(mode, reg, sz);
+    if (h == op_bit) return 1 + !(op & 0x100) + ea_words(mode, reg, 1);
+    if (h == op_move) {
+	static const int move_size[4] = { 0, 1, 4, 2 };
+	sz = move_size[op >> 12];
+	return 1 + ea_words(mode, reg, sz) + ea_words((op >> 6) & 7, REG_X(op), sz);
+    }
+    if (h == op_movea) return 1 + ea_words(mode, reg, (op & 0x1000) ? 2 : 4);
+    if (h == op_arith_a) return 1 + ea_words(mode, reg, (op & 0x100) ? 4 : 2);
+    if (h == op_movem_to_mem || h == op_movem_to_reg)
+	return 2 + ea_words(mode, reg, 2);
+    if (h == op_bcc) return ((op & 0xff) ? 1 : 2);
+    if (h == op_imm_sr || h == op_movep || h == op_link || h == op_stop ||
+	    h == op_dbcc)
+	return 2;
+    if (h == op_unary || h == op_tst || h == op_addq || h == op_arith ||
+	    h == op_eor || h == op_cmp)
+	return 1 + ea_words(mode, reg, sz);
+    if (h == op_move_from_sr || h == op_move_to_ccr || h == op_move_to_sr ||
+	    h == op_chk || h == op_lea || h == op_pea || h == op_nbcd ||
+	    h == op_tas || h == op_jsr || h == op_jmp || h == op_scc ||
+	    h == op_mul || h == op_div || h == op_shift_mem)
+	return 1 + ea_words(mode, reg, 2); // no immediate long for these
+    return 1;
+}
+
+/* Instructions which can change the flow or the interrupt mask end a block */
+static int ends_block(op_handler h)
+{
+    return h == op_bcc || h == op_dbcc || h == op_jmp || h == op_jsr ||
+	h == op_rts || h == op_rte || h == op_rtr || h == op_trap ||
+	h == op_trapv || h == op_chk || h == op_div || h == op_illegal ||
+	h == op_reset || h == op_stop || h == op_move_to_sr ||
+	h == op_imm_sr || h == op_move_usp;
+}
+
+static int jit_init(void)
+{
+    if (jit_buffer) return 1;
+#ifdef RAINE_WIN32
+    jit_buffer = VirtualAlloc(NULL, JIT_BUFFER_SIZE, MEM_COMMIT | MEM_RESERVE,
+	    PAGE_EXECUTE_READWRITE);
+#else
+    jit_buffer = mmap(NULL, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+	    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jit_buffer == MAP_FAILED) jit_buffer = NULL;
+#endif
+    if (!jit_buffer) {
+	jit_disabled = 1;
+	return 0;
+    }
+    jit_ptr = jit_buffer;
+    return 1;
+}
+
+void c68000_flush_code(void)
+{
+    memset(jit_table, 0, sizeof(jit_table));
+    jit_ptr = jit_buffer;
+}
+
+#define EMIT8(x) *p++ = (x)
+#define EMIT16(x) do { UINT16 v_ = (x); memcpy(p, &v_, 2); p += 2; } while (0)
+#define EMIT32(x) do { UINT32 v_ = (x); memcpy(p, &v_, 4); p += 4; } while (0)
+#define EMIT64(x) do { UINT64 v_ = (UINT64)(uintptr_t)(x); memcpy(p, &v_, 8); p += 8; } while (0)
+
+/* All the variables used by the generated code are addressed from rbx, which
+ * points to s68000context (they are all in the data of this file so that the
+ * offsets always fit in 32 bits) */
+#define VAR(v) ((UINT32)((UINT8 *)&(v) - (UINT8 *)&s68000context))
+
+/* modrm for [rbx+disp32] */
+#define EMIT_MEM(reg, v) do { EMIT8(0x83 | ((reg) << 3)); EMIT32(VAR(v)); } while (0)
+
+#define EAX 0
+#define ECX 1
+
+/* operand size prefix for 16 bits */
+#define EMIT_SIZE(sz) do { if ((sz) == 2) EMIT8(0x66); } while (0)
+
+/* mov reg,[var] */
+static UINT8 *emit_load(UINT8 *p, int reg, UINT32 *var)
+{
+    EMIT8(0x8b); EMIT_MEM(reg, *var);
+    return p;
+}
+
+/* mov [var],eax/ax/al */
+static UINT8 *emit_store(UINT8 *p, int sz, UINT32 *var)
+{
+    EMIT_SIZE(sz);
+    EMIT8(sz == 1 ? 0x88 : 0x89); EMIT_MEM(EAX, *var);
+    return p;
+}
+
+/* mov dword [var],imm */
+static UINT8 *emit_store_imm(UINT8 *p, UINT32 *var, UINT32 imm)
+{
+    EMIT8(0xc7); EMIT_MEM(0, *var); EMIT32(imm);
+    return p;
+}
+
+/* setcc byte [var] : the flags are always 0 or 1 so writing the low byte
+ * is enough */
+static UINT8 *emit_setcc(UINT8 *p, int cc, UINT32 *var)
+{
+    EMIT8(0x0f); EMIT8(0x90 | cc); EMIT_MEM(0, *var);
+    return p;
+}
+
+#define X86_O 0x0
+#define X86_C 0x2
+#define X86_Z 0x4
+#define X86_S 0x8
+
+/* 68000 flags from the host flags, the x flag only for arithmetic */
+static UINT8 *emit_flags(UINT8 *p, int arith)
+{
+    p = emit_setcc(p, X86_S, &flag_n);
+    p = emit_setcc(p, X86_Z, &flag_z);
+    p = emit_setcc(p, X86_O, &flag_v);
+    p = emit_setcc(p, X86_C, &flag_c);
+    if (arith)
+	p = emit_setcc(p, X86_C, &flag_x);
+    return p;
+}
+
+/* alu opcodes */
+#define ALU_ADD 0x00
+#define ALU_OR  0x08
+#define ALU_AND 0x20
+#define ALU_SUB 0x28
+#define ALU_XOR 0x30
+#define ALU_CMP 0x38
+
+/* op eax,ecx */
+static UINT8 *emit_alu_reg(UINT8 *p, int alu, int sz)
+{
+    EMIT_SIZE(sz);
+    EMIT8(alu | (sz == 1 ? 0 : 1)); EMIT8(0xc8);
+    return p;
+}
+
+/* op eax,imm */
+static UINT8 *emit_alu_imm(UINT8 *p, int alu, int sz, UINT32 imm)
+{
+    EMIT_SIZE(sz);
+    EMIT8(alu | (sz == 1 ? 4 : 5));
+    if (sz == 1) EMIT8(imm);
+    else if (sz == 2) EMIT16(imm);
+    else EMIT32(imm);
+    return p;
+}
+
+/* test eax,eax */
+static UINT8 *emit_test(UINT8 *p, int sz)
+{
+    EMIT_SIZE(sz);
+    EMIT8(sz == 1 ? 0x84 : 0x85); EMIT8(0xc0);
+    return p;
+}
+
+static UINT32 *reg_var(int mode, int reg)
+{
+    return (mode ? &AREG(reg) : &DREG(reg));
+}
+
+/* Source operand which can be handled inline : Dn, An or immediate */
+static int simple_src(int mode, int reg)
+{
+    return mode < 2 || (mode == 7 && reg == 4);
+}
+
+static UINT32 read_imm(UINT16 *ext, int sz)
+{
+    if (sz == 4)
+	return (ext[0] << 16) | ext[1];
+    return ext[0] & size_mask[sz];
+}
+
+/* dst = dst alu src, src being a register or an immediate */
+static UINT8 *emit_alu(UINT8 *p, int alu, int sz, UINT32 *dst, int mode,
+	int reg, UINT16 *ext)
+{
+    p = emit_load(p, EAX, dst);
+    if (mode == 7) {
+	p = emit_alu_imm(p, alu, sz, read_imm(ext, sz));
+    } else {
+	p = emit_load(p, ECX, reg_var(mode, reg));
+	p = emit_alu_reg(p, alu, sz);
+    }
+    p = emit_flags(p, alu == ALU_ADD || alu == ALU_SUB);
+    if (alu != ALU_CMP)
+	p = emit_store(p, sz, dst);
+    return p;
+}
+
+/* Inline code for the simple instructions, returns NULL if the instruction
+ * must call its handler. The cycles must be the same as in the handlers */
+static UINT8 *emit_native(UINT8 *p, UINT32 op, UINT16 *ext, int *cycles)
+{
+    static const int arith_alu[16] = {
+	0, 0, 0, 0, 0, 0, 0, 0, ALU_OR, ALU_SUB, 0, 0, ALU_AND, ALU_ADD, 0, 0 };
+    static const int imm_alu[8] = {
+	ALU_OR, ALU_AND, ALU_SUB, ALU_ADD, -1, ALU_XOR, ALU_CMP, -1 };
+    op_handler h = optable[op];
+    int sz = OP_SIZE(op), mode = EA_MODE(op), reg = EA_REG(op);
+    int imm_cycles;
+
+    if (h == op_moveq) {
+	UINT32 data = (INT8)op;
+	p = emit_store_imm(p, &DREG(REG_X(op)), data);
+	p = emit_store_imm(p, &flag_n, (data >> 31));
+	p = emit_store_imm(p, &flag_z, data == 0);
+	p = emit_store_imm(p, &flag_v, 0);
+	p = emit_store_imm(p, &flag_c, 0);
+	*cycles = 4;
+	return p;
+    }
+    if (h == op_move && ((op >> 6) & 7) == 0 && simple_src(mode, reg)) {
+	static const int move_size[4] = { 0, 1, 4, 2 };
+	sz = move_size[op >> 12];
+	if (mode == 7) {
+	    EMIT8(0xb8); EMIT32(read_imm(ext, sz)); // mov eax,imm
+	} else
+	    p = emit_load(p, EAX, reg_var(mode, reg));
+	p = emit_test(p, sz);
+	p = emit_flags(p, 0);
+	p = emit_store(p, sz, &DREG(REG_X(op)));
+	*cycles = 4 + EA_CYCLES(mode, reg, sz);
+	return p;
+    }
+    if (h == op_movea && simple_src(mode, reg)) {
+	sz = (op & 0x1000) ? 2 : 4;
+	if (mode == 7) {
+	    UINT32 data = read_imm(ext, sz);
+	    p = emit_store_imm(p, &AREG(REG_X(op)), sz == 2 ? (INT16)data : data);
+	} else {
+	    if (sz == 2) {
+		EMIT8(0x0f); EMIT8(0xbf); EMIT_MEM(EAX, *reg_var(mode, reg)); // movsx eax,word
+	    } else
+		p = emit_load(p, EAX, reg_var(mode, reg));
+	    p = emit_store(p, 4, &AREG(REG_X(op)));
+	}
+	*cycles = 4 + EA_CYCLES(mode, reg, sz);
+	return p;
+    }
+    if (h == op_arith && !(op & 0x100) && simple_src(mode, reg)) {
+	p = emit_alu(p, arith_alu[op >> 12], sz, &DREG(REG_X(op)), mode, reg, ext);
+	if (sz == 4)
+	    *cycles = (mode < 2 || mode == 7 ? 8 : 6) + EA_CYCLES(mode, reg, sz);
+	else
+	    *cycles = 4 + EA_CYCLES(mode, reg, sz);
+	return p;
+    }
+    if (h == op_cmp && simple_src(mode, reg)) {
+	p = emit_alu(p, ALU_CMP, sz, &DREG(REG_X(op)), mode, reg, ext);
+	*cycles = (sz == 4 ? 6 : 4) + EA_CYCLES(mode, reg, sz);
+	return p;
+    }
+    if (h == op_eor && mode == 0) {
+	p = emit_alu(p, ALU_XOR, sz, &DREG(reg), 0, REG_X(op), ext);
+	*cycles = (sz == 4 ? 8 : 4);
+	return p;
+    }
+    if (h == op_imm && mode == 0) {
+	int alu = imm_alu[(op >> 9) & 7];
+	imm_cycles = (alu == ALU_CMP ? (sz == 4 ? 14 : 8) : (sz == 4 ? 16 : 8));
+	p = emit_alu(p, alu, sz, &DREG(reg), 7, 4, ext);
+	*cycles = imm_cycles;
+	return p;
+    }
+    if (h == op_addq && mode < 2) {
+	UINT32 data = (op >> 9) & 7;
+	if (!data) data = 8;
+	if (mode == 1) {
+	    /* add/sub dword [An],imm, no flags */
+	    EMIT8(0x81); EMIT_MEM((op & 0x100) ? 5 : 0, AREG(reg)); EMIT32(data);
+	    *cycles = 8;
+	} else {
+	    UINT16 imm[2] = { 0, data };
+	    p = emit_alu(p, (op & 0x100) ? ALU_SUB : ALU_ADD, sz, &DREG(reg), 7, 4,
+		    (sz == 4 ? imm : imm + 1));
+	    *cycles = (sz == 4 ? 8 : 4);
+	}
+	return p;
+    }
+    if (h == op_arith_a && simple_src(mode, reg) && (op >> 12) != 0xb) {
+	sz = (op & 0x100) ? 4 : 2;
+	if (mode == 7) {
+	    UINT32 data = read_imm(ext, sz);
+	    EMIT8(0xb9); EMIT32(sz == 2 ? (INT16)data : data); // mov ecx,imm
+	} else if (sz == 2) {
+	    EMIT8(0x0f); EMIT8(0xbf); EMIT_MEM(ECX, *reg_var(mode, reg)); // movsx ecx,word
+	} else
+	    p = emit_load(p, ECX, reg_var(mode, reg));
+	/* add/sub [An],ecx */
+	EMIT8((op >> 12) == 0x9 ? 0x29 : 0x01); EMIT_MEM(ECX, AREG(REG_X(op)));
+	*cycles = 8 + EA_CYCLES(mode, reg, sz);
+	return p;
+    }
+    if (h == op_lea && (mode == 2 || mode == 5)) {
+	p = emit_load(p, EAX, &AREG(reg));
+	if (mode == 5) {
+	    EMIT8(0x05); EMIT32((INT16)ext[0]); // add eax,d16
+	}
+	p = emit_store(p, 4, &AREG(REG_X(op)));
+	*cycles = EA_CYCLES(mode, reg, 2);
+	return p;
+    }
+    if (h == op_tst && mode == 0) {
+	p = emit_load(p, EAX, &DREG(reg));
+	p = emit_test(p, sz);
+	p = emit_flags(p, 0);
+	*cycles = 4;
+	return p;
+    }
+    return NULL;
+}
+
+static int is_ram_code(UINT32 adr, UINT8 *host)
+{
+    struct STARSCREAM_DATAREGION *r = find_region(s68000context.writeword, adr);
+    if (r && !r->memorycall && (UINT8 *)r->userdata + adr == host)
+	return 1;
+    r = find_region(s68000context.writebyte, adr);
+    return r && !r->memorycall && (UINT8 *)r->userdata + adr == host;
+}
+
+/* Target of a bcc/dbcc instruction at adr, or 1 (never a valid pc) */
+static UINT32 branch_target(UINT32 op, UINT16 *ext, UINT32 adr)
+{
+    if (optable[op] == op_dbcc)
+	return adr + 2 + (INT16)ext[0];
+    if (optable[op] == op_bcc && ((op >> 8) & 15) != 1) {
+	if (op & 0xff)
+	    return adr + 2 + (INT8)op;
+	return adr + 2 + (INT16)ext[0];
+    }
+    return 1;
+}
+
+/* jcc rel32 to the exit of the block, patched at the end */
+#define EMIT_EXIT(cc) do { EMIT8(0x0f); EMIT8(0x80 | (cc)); exits[nb_exits++] = p; EMIT32(0); } while (0)
+#define X86_NE 0x5
+#define X86_LE 0xe
+
+static void jit_translate(JIT_BLOCK *b, UINT8 *host)
+{
+    UINT8 *p, *top, *exits[JIT_MAX_OPS*2+4];
+    UINT16 *ext;
+    UINT32 adr = pc, op, rel;
+    int nb = 0, nb_exits = 0, n, words = 0, len, cycles;
+    op_handler h;
+    UINT8 *native;
+
+    if (jit_ptr + JIT_MAX_BLOCK > jit_buffer + JIT_BUFFER_SIZE)
+	c68000_flush_code();
+    b->host = host;
+    b->pc = pc;
+    b->code = NULL;
+    b->copy = NULL;
+    p = jit_ptr;
+
+    /* The call to the block leaves rsp at 8 mod 16, the push of rbx aligns
+     * it for the calls. win64 needs 32 bytes of shadow space on top. */
+    EMIT8(0x53); // push rbx
+#ifdef RAINE_WIN32
+    EMIT8(0x48); EMIT8(0x83); EMIT8(0xec); EMIT8(0x20); // sub rsp,32
+#endif
+    EMIT8(0x48); EMIT8(0xbb); EMIT64(&s68000context); // mov rbx,&s68000context
+    top = p;
+
+    do {
+	op = *(UINT16 *)(host + words*2);
+	ext = (UINT16 *)(host + words*2 + 2);
+	h = optable[op];
+	len = op_words(op);
+	if (adr + len*2 - 1 > fetch_hi)
+	    break;
+	native = emit_native(p, op, ext, &cycles);
+	if (native) {
+	    p = native;
+	    p = emit_store_imm(p, &pc, adr + len*2);
+	    EMIT8(0x81); EMIT_MEM(5, remaining); EMIT32(cycles); // sub [remaining],cycles
+	} else {
+	    p = emit_store_imm(p, &pc, adr + 2);
+#ifdef RAINE_WIN32
+	    EMIT8(0xb9); EMIT32(op);                   // mov ecx,op
+#else
+	    EMIT8(0xbf); EMIT32(op);                   // mov edi,op
+#endif
+	    EMIT8(0x48); EMIT8(0xb8); EMIT64(h);       // mov rax,handler
+	    EMIT8(0xff); EMIT8(0xd0);                  // call rax
+	}
+	words += len;
+	if (ends_block(h)) {
+	    if (branch_target(op, ext, adr) == b->pc) {
+		/* The block loops on itself as long as the branch is taken,
+		 * there are cycles left, and no interrupt is pending */
+		EMIT8(0x81); EMIT_MEM(7, pc); EMIT32(b->pc); // cmp [pc],start
+		EMIT_EXIT(X86_NE);
+		EMIT8(0x83); EMIT_MEM(7, remaining); EMIT8(0); // cmp [remaining],0
+		EMIT_EXIT(X86_LE);
+		EMIT8(0x0f); EMIT8(0xb6); EMIT_MEM(EAX, s68000context.interrupts[0]); // movzx eax,byte
+		EMIT8(0x84); EMIT_MEM(EAX, irq_mask);       // test [irq_mask],al
+		EMIT_EXIT(X86_NE);
+		EMIT8(0xe9); rel = top - (p + 4); EMIT32(rel); // jmp top
+	    }
+	    break;
+	}
+	adr += len*2;
+	if (++nb == JIT_MAX_OPS)
+	    break;
+	EMIT8(0x83); EMIT_MEM(7, remaining); EMIT8(0); // cmp [remaining],0
+	EMIT_EXIT(X86_LE);
+    } while (1);
+
+    if (!words)
+	return; // the 1st instruction crosses the end of the region
+    for (n = 0; n < nb_exits; n++) {
+	/* rel32 from the end of the jcc */
+	rel = p - (exits[n] + 4);
+	memcpy(exits[n], &rel, 4);
+    }
+#ifdef RAINE_WIN32
+    EMIT8(0x48); EMIT8(0x83); EMIT8(0xc4); EMIT8(0x20); // add rsp,32
+#endif
+    EMIT8(0x5b); EMIT8(0xc3); // pop rbx; ret
+
+    b->code = (void (*)(void))jit_ptr;
+    b->words = words;
+    if (is_ram_code(pc, host)) {
+	b->copy = (UINT16 *)p;
+	memcpy(p, host, words*2);
+	p += words*2;
+    }
+    jit_ptr = (UINT8 *)(((uintptr_t)p + 15) & ~(uintptr_t)15);
+}
+
+/* Returns the block starting at pc, or NULL if it must be interpreted */
+static inline JIT_BLOCK *jit_block(void)
+{
+    UINT8 *host = fetch_base + pc;
+    int fails = 0;
+    JIT_BLOCK *b = &jit_table[(pc >> 1) & (JIT_ENTRIES - 1)];
+    if (b->host == host && b->pc == pc) {
+	if (!b->code)
+	    return NULL;
+	if (!b->copy || !memcmp(b->copy, host, b->words*2))
+	    return b;
+	/* The code in ram has changed */
+	if (++b->fails >= JIT_MAX_FAILS) {
+	    b->code = NULL;
+	    return NULL;
+	}
+	fails = b->fails;
+    }
+    if (jit_disabled || fetch_lo > fetch_hi || (!jit_buffer && !jit_init()))
+	return NULL;
+    jit_translate(b, host);
+    b->fails = fails;
+    return (b->code ? b : NULL);
+}
+
+#else
+
+void c68000_flush_code(void)
+{
+}
+
+#endif
+
+/******************************************************************************/
+/*  Starscream interface                                                      */
+/******************************************************************************/
+
+int s68000init(void)
+{
+    if (optable[0] != op_imm)
+	build_optable();
+    return 0;
+}
+
+static void load_registers(void)
+{
+    pc = s68000context.pc & ADDRESS_MASK;
+    select_pages();
+    set_ccr(s68000context.sr);
+    update_irq_mask();
+    fetch_lo = 1;
+    fetch_hi = 0;
+}
+
+static void save_registers(void)
+{
+    s68000context.pc = pc;
+    s68000context.sr = get_sr();
+}
+
+unsigned s68000reset(void)
+{
+    struct STARSCREAM_PROGRAMREGION *r;
+    int n;
+    if (executing || !s68000context.s_fetch)
+	return 1;
+    for (n = 0; n < 8; n++)
+	DREG(n) = AREG(n) = 0;
+    s68000context.asp = 0;
+    s68000context.sr = 0x2700;
+    switch_memory_map(1);
+    s68000context.pc = 1;
+    s68000context.interrupts[0] = 0;
+    r = find_fetch(s68000context.fetch, 0);
+    if (!r)
+	return 1;
+    AREG(7) = (((UINT16 *)r->offset)[0] << 16) | ((UINT16 *)r->offset)[1];
+    s68000context.pc = (((UINT16 *)r->offset)[2] << 16) | ((UINT16 *)r->offset)[3];
+    /* An odd pc here is a double fault */
+    s68000context.interrupts[0] = s68000context.pc & 1;
+    return 0;
+}
+
+unsigned s68000exec(int n)
+{
+    UINT32 op;
+    if (s68000context.interrupts[0] & 1) {
+	/* stopped or double fault */
+	if (s68000context.pc & 1)
+	    return 0xffffffff;
+	s68000context.odometer += n;
+	return 0x80000000;
+    }
+    executing = 1;
+    exit_code = 0x80000000;
+    slice = remaining = n;
+    load_registers();
+    if (rebase()) {
+	do {
+	    if (s68000context.interrupts[0] & irq_mask) {
+		take_interrupt();
+		rebase();
+		if (remaining <= 0) break;
+	    }
+#if defined(C68000_JIT) && defined(__x86_64__)
+	    {
+		JIT_BLOCK *b = jit_block();
+		if (b) {
+		    b->code();
+		    continue;
+		}
+	    }
+#endif
+	    op = fetch16();
+	    optable[op](op);
+	} while (remaining > 0);
+    }
+    save_registers();
+    s68000context.odometer += slice - remaining;
+    executing = 0;
+    return exit_code;
+}
+
+int s68000interrupt(int level, int vector)
+{
+    if (level < 1 || level > 7 || vector > 255 || vector < -2)
+	return 2;
+    if (vector == -2)
+	vector = 0x18;
+    else if (vector == -1)
+	vector = 0x18 + level;
+    if (s68000context.interrupts[0] & (1 << level))
+	return 1;
+    s68000context.interrupts[0] |= 1 << level;
+    s68000context.interrupts[level] = vector;
+    s68000context.interrupts[0] &= 0xfe;
+    return 0;
+}
+
+void s68000flushInterrupts(void)
+{
+    if (executing)
+	return; // exec will take them anyway
+    load_registers();
+    slice = remaining = 0;
+    take_interrupt();
+    save_registers();
+    s68000context.odometer -= remaining;
+}
+
+int s68000GetContextSize(void)
+{
+    return sizeof(struct S68000CONTEXT);
+}
+
+void s68000GetContext(void *context)
+{
+    memcpy(context, &s68000context, sizeof(struct S68000CONTEXT));
+}
+
+void s68000SetContext(void *context)
+{
+    memcpy(&s68000context, context, sizeof(struct S68000CONTEXT));
+}
+
+int s68000fetch(unsigned address)
+{
+    struct STARSCREAM_PROGRAMREGION *r;
+    address &= ADDRESS_MASK;
+    r = find_fetch(s68000context.s_fetch, address);
+    if (!r)
+	return -1;
+    return *(UINT16 *)((UINT8 *)r->offset + address);
+}
+
+unsigned s68000readOdometer(void)
+{
+    if (executing)
+	return s68000context.odometer + slice - remaining;
+    return s68000context.odometer;
+}
+
+unsigned s68000tripOdometer(void)
+{
+    unsigned ret = s68000readOdometer();
+    if (executing)
+	slice = remaining;
+    s68000context.odometer = 0;
+    return ret;
+}
+
+unsigned s68000controlOdometer(int n)
+{
+    if (n)
+	return s68000tripOdometer();
+    return s68000readOdometer();
+}
+
+void c68000_add_idle_loop(UINT8 *host)
+{
+    if (idle_count < MAX_IDLE_LOOPS && !is_idle_loop(host))
+	idle_loop[idle_count++] = host;
+}
+
+void c68000_clear_idle_loops(void)
+{
+    idle_count = 0;
+}
+
+void s68000releaseTimeslice(void)
+{
+    if (executing) {
+	slice -= remaining;
+	remaining = 0;
+    }
+}
+
+unsigned s68000readPC(void)
+{
+    if (executing)
+	return pc;
+    return s68000context.pc;
+}
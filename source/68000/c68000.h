@@ -0,0 +1,28 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+/******************************************************************************/
+/*                                                                            */
+/*            C68000 : EXTENSIONS WHICH ARE NOT PART OF STARCPU.H             */
+/*                                                                            */
+/******************************************************************************/
+
+/* Forget all the translated blocks (C68000_JIT), must be called when some
+ * 68000 code is patched from outside the cpu. Does nothing without the jit */
+void c68000_flush_code(void);
+
+/* host is the address of a bcc instruction in a program region. When it is
+ * taken backward, the current timeslice ends (see add_68000_idle_loop) */
+void c68000_add_idle_loop(UINT8 *host);
+void c68000_clear_idle_loops(void);
+
+/* The data regions are looked up through page tables built from the lists,
+ * they must be updated after a change of a list between lo and hi (whole
+ * list for an insertion or a deletion). clear forgets all the lists */
+void c68000_update_memory_map(struct STARSCREAM_DATAREGION *regions,
+	UINT32 lo, UINT32 hi);
+void c68000_clear_memory_maps(void);
+
+#ifdef __cplusplus
+}
+#endif
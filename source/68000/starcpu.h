@@ -9,6 +9,8 @@
 #ifndef __STARCPU_H__
 #define __STARCPU_H__
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,7 +19,7 @@ extern "C" {
 struct STARSCREAM_PROGRAMREGION {
 	unsigned lowaddr;
 	unsigned highaddr;
-	unsigned offset;
+	uintptr_t offset; /* same size as unsigned on 32 bit hosts */
 };
 
 struct STARSCREAM_DATAREGION {
@@ -5,6 +5,9 @@
 /******************************************************************************/
 
 #include "starhelp.h"
+#ifdef HAS_C68000
+#include "c68000.h"
+#endif
 #include "raine.h"
 #include "savegame.h"
 #include "games/default.h"
@@ -104,6 +107,18 @@ void *get_userfunc(UINT32 cpu, int read, int size, int off_start, UINT32 offset)
   return NULL;
 }
 
+// The C core keeps page tables of the data regions, they must follow the lists
+static void update_memory_map(struct STARSCREAM_DATAREGION *regions, UINT32 d0, UINT32 d1)
+{
+#ifdef HAS_C68000
+  c68000_update_memory_map(regions,d0,d1);
+#else
+  (void)(regions);
+  (void)(d0);
+  (void)(d1);
+#endif
+}
+
 void AddMemoryList(UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
 {
    MC68000A_memoryall[ma].lowaddr    = d0;
@@ -126,7 +141,7 @@ void add_68000_program_region(UINT32 cpu, UINT32 d0, UINT32 d1, UINT8 *d2)
 
    M68000_programregion[cpu][program_count[cpu]].lowaddr  = d0;
    M68000_programregion[cpu][program_count[cpu]].highaddr = d1;
-   M68000_programregion[cpu][program_count[cpu]].offset   = (UINT32) d2;
+   M68000_programregion[cpu][program_count[cpu]].offset   = (uintptr_t) d2;
    program_count[cpu]++;
 }
 
@@ -136,7 +151,7 @@ static void set_68000_program_region(UINT32 cpu, UINT32 d0, UINT32 d1, UINT8 *d2
     for (n=0; n<program_count[cpu]; n++) {
 	if (d0 == M68000_programregion[cpu][n].lowaddr &&
 		d1 == M68000_programregion[cpu][n].highaddr) {
-	    M68000_programregion[cpu][n].offset   = (UINT32) d2;
+	    M68000_programregion[cpu][n].offset   = (uintptr_t) d2;
 	    return;
 	}
     }
@@ -180,6 +195,7 @@ void add_68000_rb(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
      fprintf(stderr,"overflow rb\n");
      exit(1);
    }
+   update_memory_map(M68000_dataregion_rb[cpu],d0,d1);
 
    if(cpu == 0)
       AddMemoryList(d0,d1,d2,d3);
@@ -196,6 +212,7 @@ void add_68000_rw(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
      fprintf(stderr,"overflow rw\n");
      exit(1);
    }
+   update_memory_map(M68000_dataregion_rw[cpu],d0,d1);
 
    if(cpu == 0)
       AddMemoryList(d0,d1,d2,d3);
@@ -212,6 +229,7 @@ void add_68000_wb(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
      fprintf(stderr,"overflow wb\n");
      exit(1);
    }
+   update_memory_map(M68000_dataregion_wb[cpu],d0,d1);
 
    if(cpu == 0)
       AddMemoryList(d0,d1,d2,d3);
@@ -233,6 +251,7 @@ void del_wb(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
 	    &M68000_dataregion_wb[cpu][index+1],
 	    sizeof(struct STARSCREAM_DATAREGION)*(data_count_wb[cpu]-index-1));
   data_count_wb[cpu]--;
+  update_memory_map(M68000_dataregion_wb[cpu],0,0xffffffff);
 }
 
 void del_ww(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
@@ -251,6 +270,7 @@ void del_ww(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
 	    &M68000_dataregion_ww[cpu][index+1],
 	    sizeof(struct STARSCREAM_DATAREGION)*(data_count_ww[cpu]-index-1));
   data_count_ww[cpu]--;
+  update_memory_map(M68000_dataregion_ww[cpu],0,0xffffffff);
 }
 
 void del_rb(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
@@ -269,6 +289,7 @@ void del_rb(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
 	    &M68000_dataregion_rb[cpu][index+1],
 	    sizeof(struct STARSCREAM_DATAREGION)*(data_count_rb[cpu]-index-1));
   data_count_rb[cpu]--;
+  update_memory_map(M68000_dataregion_rb[cpu],0,0xffffffff);
 }
 
 void del_rw(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
@@ -287,6 +308,7 @@ void del_rw(int cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
 	    &M68000_dataregion_rw[cpu][index+1],
 	    sizeof(struct STARSCREAM_DATAREGION)*(data_count_rw[cpu]-index-1));
   data_count_rw[cpu]--;
+  update_memory_map(M68000_dataregion_rw[cpu],0,0xffffffff);
 }
 
 int insert_wb(int cpu, int index, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
@@ -301,6 +323,7 @@ int insert_wb(int cpu, int index, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
    M68000_dataregion_wb[cpu][index].memorycall = d2;
    M68000_dataregion_wb[cpu][index].userdata   = d3 - d0;
    data_count_wb[cpu]++;
+   update_memory_map(M68000_dataregion_wb[cpu],0,0xffffffff);
    return 1;
 }
 
@@ -316,6 +339,7 @@ int insert_ww(int cpu, int index, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
   M68000_dataregion_ww[cpu][index].memorycall = d2;
   M68000_dataregion_ww[cpu][index].userdata   = d3 - d0;
   data_count_ww[cpu]++;
+  update_memory_map(M68000_dataregion_ww[cpu],0,0xffffffff);
   return 1;
 }
 
@@ -331,6 +355,7 @@ int insert_rb(int cpu, int index, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
   M68000_dataregion_rb[cpu][index].memorycall = d2;
   M68000_dataregion_rb[cpu][index].userdata   = d3 - d0;
   data_count_rb[cpu]++;
+  update_memory_map(M68000_dataregion_rb[cpu],0,0xffffffff);
   return 1;
 }
 
@@ -346,6 +371,7 @@ int insert_rw(int cpu, int index, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3) {
   M68000_dataregion_rw[cpu][index].memorycall = d2;
   M68000_dataregion_rw[cpu][index].userdata   = d3 - d0;
   data_count_rw[cpu]++;
+  update_memory_map(M68000_dataregion_rw[cpu],0,0xffffffff);
   return 1;
 }
 
@@ -361,6 +387,7 @@ void add_68000_ww(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
      fprintf(stderr,"overflow add_68000_ww\n");
      exit(1);
    }
+   update_memory_map(M68000_dataregion_ww[cpu],d0,d1);
 
    if(cpu == 0)
       AddMemoryList(d0,d1,d2,d3);
@@ -374,6 +401,7 @@ void set_68000_rb(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
 	M68000_dataregion_rb[cpu][i].highaddr == d1) {
       M68000_dataregion_rb[cpu][i].memorycall = d2;
       M68000_dataregion_rb[cpu][i].userdata = d3 - d0;
+      update_memory_map(M68000_dataregion_rb[cpu],d0,d1);
       break;
     }
   }
@@ -391,6 +419,7 @@ void set_68000_rw(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
 	M68000_dataregion_rw[cpu][i].highaddr == d1) {
       M68000_dataregion_rw[cpu][i].memorycall = d2;
       M68000_dataregion_rw[cpu][i].userdata = d3 - d0;
+      update_memory_map(M68000_dataregion_rw[cpu],d0,d1);
       break;
     }
   }
@@ -408,6 +437,7 @@ void set_68000_wb(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
 	M68000_dataregion_wb[cpu][i].highaddr == d1) {
       M68000_dataregion_wb[cpu][i].memorycall = d2;
       M68000_dataregion_wb[cpu][i].userdata = d3 - d0;
+      update_memory_map(M68000_dataregion_wb[cpu],d0,d1);
       break;
     }
   }
@@ -421,6 +451,7 @@ void set_68000_ww(UINT32 cpu, UINT32 d0, UINT32 d1, void *d2, UINT8 *d3)
 	M68000_dataregion_ww[cpu][i].highaddr == d1) {
       M68000_dataregion_ww[cpu][i].memorycall = d2;
       M68000_dataregion_ww[cpu][i].userdata = d3 - d0;
+      update_memory_map(M68000_dataregion_ww[cpu],d0,d1);
       break;
     }
   }
@@ -569,6 +600,11 @@ void Clear68000List(void)
    }
 
    ma = 0;
+   flush_68000_code();
+#ifdef HAS_C68000
+   c68000_clear_idle_loops();
+   c68000_clear_memory_maps();
+#endif
 }
 
 void WriteStarScreamByte(UINT32 address, UINT8 data)
@@ -674,6 +710,29 @@ void AddInitMemoryMC68000B(void)
  *  ---------------------------------------------------------
  */
 
+void flush_68000_code(void)
+{
+#ifdef HAS_C68000
+  c68000_flush_code();
+#endif
+}
+
+int add_68000_idle_loop(UINT32 cpu, UINT32 adr)
+{
+#ifdef HAS_C68000
+  UINT32 start,end;
+  UINT8 *base = s68k_get_code_range(cpu,adr,&start,&end);
+  if (!base)
+    return 0;
+  c68000_add_idle_loop(base + adr);
+  return 1;
+#else
+  (void)(cpu);
+  (void)(adr);
+  return 0; // starscream can't do it without patching the rom
+#endif
+}
+
 void Stop68000(UINT32 address, UINT8 data)
 {
 	(void)(address);
@@ -81,6 +81,14 @@ void Clear68000List(void);
 
 void Stop68000(UINT32 address, UINT8 data);
 
+// Must be called after patching some 68000 code from outside of the cpu
+// (speed hacks, breakpoints), the C core can have translated it already.
+void flush_68000_code(void);
+
+// adr is a bcc closing a busy wait loop : the cpu stops for the rest of its
+// timeslice each time it branches back. Returns 0 if the core can't do it.
+int add_68000_idle_loop(UINT32 cpu, UINT32 adr);
+
 UINT8 DefBadReadByte(UINT32 address);
 UINT16 DefBadReadWord(UINT32 address);
 void DefBadWriteByte(UINT32 address, UINT8 data);
@@ -0,0 +1,131 @@
+#!/usr/bin/perl
+
+# Builds video/hqx_rules.h, the tables used by the portable hq2x/hq3x in
+# video/hqx.c, from the rules of the asm versions :
+# perl bonus/hqx_rules.pl video/hq2x16.asm video/hq3x16.asm > video/hqx_rules.h
+#
+# Each case of the asm (..@flagN: a pattern of the 8 neighbours) writes the
+# output pixels with PIXELxy_n macros, some of them inside a DiffOrNot wA,wB
+# which chooses between 2 macros when wA and wB are different. Each macro is
+# an Interp of w5 and some neighbours, which becomes weights out of 16.
+# The cross cases of the asm are only quicker versions of flag0.
+
+use strict;
+
+my %weights = (
+    "Interp1" => [12,4],
+    "Interp2" => [8,4,4],
+    "Interp3" => [14,2],
+    "Interp4" => [2,7,7],
+    "Interp5" => [8,8],
+    "Interp6" => [10,4,2],
+    "Interp7" => [12,2,2],
+    "Interp9" => [4,6,6],
+    "Interp10" => [14,1,1],
+    );
+# these ones take w5 (eax) without passing it
+my %implicit = map { $_ => 1 } qw(Interp3 Interp4 Interp6 Interp7 Interp9 Interp10);
+my @conds = ("2,6","6,8","8,4","4,2");
+
+my @ops = ();
+my %op_index = ();
+
+sub get_op {
+    my ($w,$n) = @_;
+    my @w = @$w;
+    my @n = @$n;
+    while (@w < 3) { push @w,0; push @n,5; }
+    my $key = sprintf("{ { %2d,%2d,%2d }, { %d,%d,%d } }",@w,@n);
+    if (!defined($op_index{$key})) {
+	$op_index{$key} = scalar(@ops);
+	push @ops,$key;
+    }
+    return $op_index{$key};
+}
+
+sub parse {
+    my ($file,$size) = @_;
+    open(F,"<$file") || die "can't open $file";
+    my @lines = <F>;
+    close(F);
+    my (%macro,%rules,@labels,$cur);
+    for (my $i=0; $i<@lines; $i++) {
+	if ($lines[$i] =~ /^%macro (PIXEL(\d)(\d)\w*) 0/) {
+	    my ($name,$out) = ($1,$2*$size+$3);
+	    my $body = $lines[$i+1];
+	    $body =~ s/;.*//;
+	    $body =~ s/^\s+|\s+$//g;
+	    if ($body =~ /^mov/) {
+		$macro{$name} = [$out,get_op([16],[5])];
+		next;
+	    }
+	    my ($ins,$args) = split(/\s+/,$body,2);
+	    die "unknown $ins" if (!$weights{$ins});
+	    my @args = split(/\s*,\s*/,$args);
+	    shift @args; # destination
+	    my @n = map { /eax/ ? 5 : /\[w(\d)\]/ ? $1 : die "arg $_" } @args;
+	    unshift @n,5 if ($implicit{$ins});
+	    die "args of $body" if (@n != @{$weights{$ins}});
+	    $macro{$name} = [$out,get_op($weights{$ins},\@n)];
+	}
+    }
+    get_op([16],[5]) if (!@ops); # the copy is op 0
+    foreach (@lines) {
+	s/;.*//;
+	s/^\s+|\s+$//g;
+	next if (!$_);
+	if (/^\.\.\@flag(\d+):/) {
+	    push @labels,$1;
+	    $cur = {};
+	    next;
+	}
+	next if (!$cur);
+	if ($_ eq "jmp .loopx_end") {
+	    die "incomplete case @labels" if (keys %$cur != $size*$size);
+	    foreach my $l (@labels) {
+		$rules{$l} = $cur;
+	    }
+	    @labels = ();
+	    $cur = undef;
+	} elsif (/^DiffOrNot\s+w(\d),w(\d),(.+)/) {
+	    my $c = 0;
+	    while ($conds[$c] ne "$1,$2") { $c++; die "cond $1,$2" if ($c > 3); }
+	    my @m = split(/\s*,\s*/,$3);
+	    my $half = @m/2;
+	    for (my $n=0; $n<$half; $n++) {
+		my ($out,$diff) = @{$macro{$m[$n]}};
+		my ($out2,$same) = @{$macro{$m[$n+$half]}};
+		die "DiffOrNot $_" if ($out != $out2);
+		$$cur{$out} = [$c+1,$diff,$same];
+	    }
+	} elsif (/^PIXEL/) {
+	    die "unknown macro $_" if (!$macro{$_});
+	    my ($out,$op) = @{$macro{$_}};
+	    $$cur{$out} = [0,$op,$op];
+	} else { # the cross cases
+	    @labels = ();
+	    $cur = undef;
+	}
+    }
+    die "missing cases in $file" if (keys %rules != 256);
+    return \%rules;
+}
+
+my $hq2x = parse($ARGV[0],2);
+my $hq3x = parse($ARGV[1],3);
+
+print "/* Generated by bonus/hqx_rules.pl from hq2x16.asm and hq3x16.asm */\n\n";
+print "static const HQX_OP hqx_ops[".scalar(@ops)."] =\n{\n";
+print "   $_,\n" foreach (@ops);
+print "};\n";
+
+foreach ([ "hq2x_rules",$hq2x,4 ], [ "hq3x_rules",$hq3x,9 ]) {
+    my ($name,$rules,$nb) = @$_;
+    print "\nstatic const HQX_RULE ${name}[256][$nb] =\n{\n";
+    for (my $f=0; $f<256; $f++) {
+	my $r = $$rules{$f};
+	print "   { ".join(", ",map { "{".join(",",@{$$r{$_}})."}" } (0..$nb-1)).
+	    " }, // $f\n";
+    }
+    print "};\n";
+}
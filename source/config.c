@@ -29,6 +29,7 @@
 #include "version.h"
 #include "display.h" // load/save_screen_settings
 #include "files.h"
+#include "cpumain.h" // cpu_interleave
 #ifdef HAS_CONSOLE
 #include "sdl/console/scripts.h"
 #endif
@@ -1978,6 +1979,13 @@ void load_game_config(void)
    sprintf(str,"%s:romversion", current_game->main_name);
    load_romswitches(str);
 
+   // Load CPU interleave
+
+   sprintf(str,"%s:cpu", current_game->main_name);
+   cpu_interleave = raine_get_config_int(str,"interleave",get_default_interleave());
+   if (cpu_interleave < 1)
+       cpu_interleave = 1;
+
 #if HAS_NEO
    sprintf(str,"%s:assoc", current_game->main_name);
    load_assoc(str);
@@ -2055,6 +2063,14 @@ void save_game_config(void)
    sprintf(str,"%s:romversion", current_game->main_name);
    save_romswitches(str);
 
+   // Save CPU interleave (only when it's not the driver's default)
+
+   sprintf(str,"%s:cpu", current_game->main_name);
+   if (cpu_interleave == get_default_interleave())
+       raine_clear_config_section(str);
+   else
+       raine_set_config_int(str, "interleave", cpu_interleave);
+
 #if HAS_NEO
    sprintf(str,"%s:assoc", current_game->main_name);
    save_assoc(str);
@@ -19,6 +19,7 @@
 #include "cpuid.h"
 
 UINT32 raine_cpu_capabilities;
+UINT32 raine_cpu_ext_capabilities;
 /*
  * Generic CPUID function
  */
@@ -112,6 +113,7 @@ static int get_model_name(char *modelname)
 
 void get_cpu_name(char *my_model) {
   raine_cpu_capabilities = 0;
+  raine_cpu_ext_capabilities = 0;
 #ifndef NO_ASM
   if (have_cpuid_p()) {
     UINT32 cpu_family,cpuid_level,tfms,cpu_model,junk;
@@ -127,7 +129,7 @@ void get_cpu_name(char *my_model) {
 
     /* Intel-defined flags: level 0x00000001 */
     if ( cpuid_level >= 0x00000001 ) {
-      cpuid(0x00000001, &tfms, &junk, &junk,
+      cpuid(0x00000001, &tfms, &junk, &raine_cpu_ext_capabilities,
 	    &raine_cpu_capabilities);
       // Not used yet. Might be used one day to include amd specific features
       // but rather unlikely (raine will never emulate any 3dnow stuff)
@@ -165,5 +167,11 @@ void get_cpu_name(char *my_model) {
 #elif defined(SDL)
   if (SDL_HasRDTSC()) raine_cpu_capabilities |= CPU_TSC;
   if (SDL_HasMMX()) raine_cpu_capabilities |= CPU_MMX;
+  if (SDL_HasSSE2()) raine_cpu_capabilities |= CPU_SSE2;
+#endif
+#if defined(NO_ASM) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  // no cpuid here, but gcc knows (the c video core uses ssse3)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("ssse3")) raine_cpu_ext_capabilities |= CPU_SSSE3;
 #endif
 }
@@ -11,8 +11,13 @@ extern "C" {
      Taken from include/asm-i386/cpufeature.h in the linux kernel */
 #define CPU_MMX (1<<23)
 #define CPU_TSC (1<<4)
+#define CPU_SSE2 (1<<26)
+
+  /* ecx bits of cpuid 1, in raine_cpu_ext_capabilities */
+#define CPU_SSSE3 (1<<9)
 
 extern UINT32 raine_cpu_capabilities;
+extern UINT32 raine_cpu_ext_capabilities;
 extern void get_cpu_name(char *my_model);
 
 
@@ -13,6 +13,8 @@
 #endif
 #include "games/default.h"
 #include "sdl/gui.h" // goto_debuger
+#include "speed_hack.h"
+#include "timer.h" // wait_z80_audio_frame
 
 UINT32 current_cpu_num[0x10];
 
@@ -171,6 +173,7 @@ void cpu_interrupt(UINT32 cpu_id, UINT32 vector)
     if (goto_debuger) return;
 #endif
 
+   wait_z80_audio_frame();
    switch_cpu(cpu_id);
 
    switch(cpu_id){
@@ -212,6 +215,7 @@ request an nmi on a cpu
 
 void cpu_int_nmi(UINT32 cpu_id)
 {
+   wait_z80_audio_frame();
    switch_cpu(cpu_id);
 
    switch(cpu_id){
@@ -246,6 +250,7 @@ execute a cpu for some cycles
 
 void cpu_execute_cycles(UINT32 cpu_id, UINT32 cycles)
 {
+   wait_z80_audio_frame();
    switch_cpu(cpu_id);
 
    switch(cpu_id){
@@ -254,6 +259,9 @@ void cpu_execute_cycles(UINT32 cpu_id, UINT32 cycles)
       case CPU_68K_1:
          s68000exec(cycles);
 	 print_debug("PC:%06x SR:%04x SP:%04x\n",s68000context.pc,s68000context.sr,s68000context.areg[7]);
+#ifdef HAS_C68000
+	 detect_idle_68000(cpu_id & 0x0F);
+#endif
 #ifdef RAINE_DEBUG
 	 if (s68000context.pc & 0xff000000) {
 	   printf("pc out of bounds for 68k%d\n",cpu_id & 15);
@@ -287,12 +295,54 @@ void cpu_execute_cycles(UINT32 cpu_id, UINT32 cycles)
 
 /*
 
+Interleave : cpu_execute_interleaved runs 2 cpus for a frame, switching
+between them cpu_interleave times. The driver gives its default with
+set_interleave (1 = each cpu runs its whole frame at once), the user can
+change it for each game with "interleave" in the <game>:cpu section of
+config/games.cfg, trading speed for a tighter synchronisation.
+
+*/
+
+int cpu_interleave = 1;
+static int default_interleave = 1;
+
+void set_interleave(int slices)
+{
+   if (slices < 1) slices = 1;
+   default_interleave = cpu_interleave = slices;
+}
+
+int get_default_interleave(void)
+{
+   return default_interleave;
+}
+
+void cpu_execute_interleaved(UINT32 cpu1, UINT32 cycles1, UINT32 cpu2, UINT32 cycles2)
+{
+   int n, slices = cpu_interleave;
+   UINT32 done1 = 0, done2 = 0, next;
+
+   if (slices < 1) slices = 1;
+   for (n=1; n<=slices; n++) {
+      // integer slices, the last one gets what's left
+      next = (UINT64)cycles1*n/slices;
+      cpu_execute_cycles(cpu1, next - done1);
+      done1 = next;
+      next = (UINT64)cycles2*n/slices;
+      cpu_execute_cycles(cpu2, next - done2);
+      done2 = next;
+   }
+}
+
+/*
+
 reset a cpu
 
 */
 
 void cpu_reset(UINT32 cpu_id)
 {
+   wait_z80_audio_frame();
    switch_cpu(cpu_id);
 
    switch(cpu_id){
@@ -79,6 +79,24 @@ void cpu_execute_cycles(UINT32 cpu_id, UINT32 cycles);
 
 /*
 
+execute 2 cpus for a frame, by cpu_interleave slices
+
+*/
+
+void cpu_execute_interleaved(UINT32 cpu1, UINT32 cycles1, UINT32 cpu2, UINT32 cycles2);
+
+/*
+
+default number of slices of cpu_execute_interleaved (set by the driver)
+
+*/
+
+void set_interleave(int slices);
+int get_default_interleave(void);
+extern int cpu_interleave;
+
+/*
+
 reset a cpu
 
 */
@@ -97,9 +115,7 @@ UINT8 *get_code_range(UINT32 cpu, UINT32 adr, UINT32 *start, UINT32 *end);
 UINT8 *get_userdata(UINT32 cpu, UINT32 adr);
 int bcd(int value);
 
-#ifdef RAINE_DEBUG
 extern UINT32 current_cpu_num[0x10];
-#endif
 
 #ifdef __cplusplus
 }
@@ -50,7 +50,14 @@ extern "C" {
 #else
 #define CZ80_LITTLE_ENDIAN      1
 #endif
+#ifndef CZ80_USE_JUMPTABLE
+// computed gotos (threaded dispatch) are a gcc/clang extension
+#ifdef __GNUC__
+#define CZ80_USE_JUMPTABLE      1
+#else
 #define CZ80_USE_JUMPTABLE      0
+#endif
+#endif
 #define CZ80_SIZE_OPT           0
 #define CZ80_USE_WORD_HANDLER   1
 #define CZ80_EXACT              1
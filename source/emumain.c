@@ -48,6 +48,7 @@
 #include "profile.h"
 #include "timer.h"
 #include "savegame.h" // do_load/save-state
+#include "video/pipeline.h"
 #include "mz80help.h"
 #include "config.h"             // Command Line + Config file routines
 #include "history.h" // hist_open
@@ -145,6 +146,7 @@ UINT32 run_game_emulation(void)
 {
    UINT32 cpu_tick;
    UINT32 draw_screen;
+   int pipelined;
    const VIDEO_INFO *vid_info;
    char str[256];
 
@@ -236,6 +238,8 @@ UINT32 run_game_emulation(void)
    fpsm.use_cpu_frame_count = 1;
 #endif
 
+   pipelined = pipeline_start();
+
    while(!quit_loop && current_game){
 
      /* Handle sound FIRST : it is the most sensitive part for synchronisatino
@@ -249,6 +253,7 @@ UINT32 run_game_emulation(void)
 	  if(raine_cfg.show_fps_mode>2) ProfileStart(PRO_SOUND);
 #endif
 
+	  wait_z80_audio_frame();
 	  saUpdateSound(1);
 
 #ifdef RDTSC_PROFILE
@@ -271,6 +276,24 @@ UINT32 run_game_emulation(void)
 #endif
       }
 
+      if (pipeline_wait()) {
+	  // The frame drawn by the render thread during exec, blit it now.
+	  // BlitScreen clears RefreshBuffers, but pipeline_draw already cleared
+	  // it when this frame was started : if it's set, it's for the next one
+	  int refresh = RefreshBuffers;
+	  if (recording) {
+	      update_monitoring();
+	  }
+#ifdef RDTSC_PROFILE
+	  if(raine_cfg.show_fps_mode>2) ProfileStart(PRO_BLIT);
+#endif
+	  BlitScreen();
+#ifdef RDTSC_PROFILE
+	  if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_BLIT);
+#endif
+	  RefreshBuffers = refresh;
+      }
+
       draw_screen = 0;
       cpu_frame_count ++;
       skip_frame_count ++;
@@ -296,29 +319,42 @@ UINT32 run_game_emulation(void)
 	if(raine_cfg.show_fps_mode>2) ProfileStart(PRO_RENDER);
 #endif
 
-	if (!raine_cfg.req_pause_game || RefreshBuffers)
-	    vid_info->draw_game();
+	if (pipelined && !raine_cfg.req_pause_game) {
+	    // blitted after the next exec
+	    pipeline_draw(vid_info->draw_game);
+#ifdef RDTSC_PROFILE
+	    if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_RENDER);
+#endif
+	} else {
+	    if (!raine_cfg.req_pause_game || RefreshBuffers) {
+		if (pipelined) { // in pause, just refresh the snapshots
+		    pipeline_draw(vid_info->draw_game);
+		    pipeline_wait();
+		} else
+		    vid_info->draw_game();
+	    }
 #ifdef RDTSC_PROFILE
-	if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_RENDER);
+	    if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_RENDER);
 #endif
 
-	// blit video emulation to pc hardware, also prints ingame messages
+	    // blit video emulation to pc hardware, also prints ingame messages
 
-	if (recording) {
-	  update_monitoring();
-	}
+	    if (recording) {
+		update_monitoring();
+	    }
 
 #ifdef RDTSC_PROFILE
-	if(raine_cfg.show_fps_mode>2) ProfileStart(PRO_BLIT);
+	    if(raine_cfg.show_fps_mode>2) ProfileStart(PRO_BLIT);
 #endif
 
-        // printf("blit at %d\n",SDL_GetTicks());
-	BlitScreen();
-	// printf("end of blit %d\n",SDL_GetTicks());
+	    // printf("blit at %d\n",SDL_GetTicks());
+	    BlitScreen();
+	    // printf("end of blit %d\n",SDL_GetTicks());
 
 #ifdef RDTSC_PROFILE
-	if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_BLIT);
+	    if(raine_cfg.show_fps_mode>2) ProfileStop(PRO_BLIT);
 #endif
+	}
 
 	skip_frame_count = 0;
 	render_frame_count ++;
@@ -421,6 +457,10 @@ UINT32 run_game_emulation(void)
 #endif
    } // while...
 
+   // the sound thread must be done before saving or destroying the sound
+   stop_z80_audio_thread();
+   pipeline_stop();
+
    // auto-save
 
    if (raine_cfg.auto_save & FLAG_AUTO_SAVE)
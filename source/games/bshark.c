@@ -390,13 +390,10 @@ static void execute_bshark(void)
 
    /*------[CPU Execution]------*/
 
-   cpu_execute_cycles(CPU_68K_0, CPU_FRAME_MHz(10,60));	// M68000 12MHz (60fps)
-      print_debug("PC0:%06x SR0:%04x\n",s68000context.pc,s68000context.sr);
+   cpu_execute_interleaved(CPU_68K_0, CPU_FRAME_MHz(10,60),	// M68000 12MHz (60fps)
+	   CPU_68K_1, CPU_FRAME_MHz(10,60));	// M68000 12MHz (60fps)
    cpu_interrupt(CPU_68K_0, 6);
    cpu_interrupt(CPU_68K_0, 4);
-
-   cpu_execute_cycles(CPU_68K_1, CPU_FRAME_MHz(10,60));	// M68000 12MHz (60fps)
-      print_debug("PC1:%06x SR1:%04x\n",s68000context.pc,s68000context.sr);
    cpu_interrupt(CPU_68K_1, 4);
 }
 
@@ -47,6 +47,7 @@
 #include "2203intf.h"
 #include "2151intf.h"
 #include "savegame.h"
+#include "bands.h"
 #include "lspr16.h" // experimental line scroll (not finished)
 #include "decode.h" // BITSWAP24 for mazinger
 #include "emumain.h" // reset_game_hardware
@@ -2356,7 +2357,11 @@ static void execute_esprade(void)
    agallet_vblank_irq = 0;
 }
 
-static void blit_cave_layer(int num) {
+/* Each line of the screen is taken from 1 line of the layer bitmap, so the
+   lines can be drawn in bands by different threads */
+
+static void blit_cave_lines(int y1, int y2, void *param) {
+  int num = *(int*)param;
   UINT8 *RAM_BG,*pbline,*pline;
   BITMAP *plbitmap = layer_pbitmap[num];
   BITMAP *lbitmap = layer_bitmap[num];
@@ -2381,7 +2386,7 @@ static void blit_cave_layer(int num) {
 
     switch(display_cfg.bpp) {
     case 8:
-      for (y=0; y<240; y++) {
+      for (y=y1; y<y2; y++) {
 	UINT8 *line,*layer;
 	UINT32 py = ReadWord(RAM_BG+y*4);
 	if (py >= 240) py %= 240;
@@ -2399,7 +2404,7 @@ static void blit_cave_layer(int num) {
       break;
     case 15:
     case 16:
-      for (y=0; y<240; y++) {
+      for (y=y1; y<y2; y++) {
 	UINT16 *line,*layer;
 	UINT32 py = ReadWord(RAM_BG+y*4);
 	if (py >= 240) py %= 240;
@@ -2416,7 +2421,7 @@ static void blit_cave_layer(int num) {
       }
       break;
     case 32:
-      for (y=0; y<240; y++) {
+      for (y=y1; y<y2; y++) {
 	UINT32 *line,*layer;
 	UINT32 py = ReadWord(RAM_BG+y*4);
 	if (py >= 240) py %= 240;
@@ -2440,7 +2445,7 @@ static void blit_cave_layer(int num) {
     case 8:
       {
 	int w = GameBitmap->w;
-	for (y=0; y<240; y++) {
+	for (y=y1; y<y2; y++) {
 	  UINT16 py = ReadWord(RAM_BG+y*4) & 255;
 	  UINT8 *game_bitmap, *l_bitmap;
 	  UINT8 *p_bitmap,*p_lbitmap;
@@ -2468,7 +2473,7 @@ static void blit_cave_layer(int num) {
     case 16:
       {
 	int w = GameBitmap->w;
-	for (y=0; y<240; y++) {
+	for (y=y1; y<y2; y++) {
 	  UINT16 py = ReadWord(RAM_BG+y*4) & 255;
 	  UINT16 *game_bitmap, *l_bitmap;
 	  UINT8 *p_bitmap,*p_lbitmap;
@@ -2495,7 +2500,7 @@ static void blit_cave_layer(int num) {
     case 32:
       {
 	int w = GameBitmap->w;
-	for (y=0; y<240; y++) {
+	for (y=y1; y<y2; y++) {
 	  UINT16 py = ReadWord(RAM_BG+y*4) & 255;
 	  UINT32 *game_bitmap, *l_bitmap;
 	  UINT8 *p_bitmap,*p_lbitmap;
@@ -2523,6 +2528,10 @@ static void blit_cave_layer(int num) {
   }
 }
 
+static void blit_cave_layer(int num) {
+  render_bands(blit_cave_lines, &num, 0, 240);
+}
+
 extern UINT8 *RAM_PAL;
 
 static void reset_spr16() {
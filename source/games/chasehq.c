@@ -1434,17 +1434,10 @@ static void execute_nightstr(void)
    RAM_INPUT[0x100] = wx&0xFF;
    RAM_INPUT[0x104] = wy&0xFF;
 
-   cpu_execute_cycles(CPU_68K_0, CPU_FRAME_MHz(12,60));	// M68000 12MHz (60fps)
-   /*#ifdef RAINE_DEBUG
-      print_debug("PC0:%06x SR:%04x\n",s68000context.pc,s68000context.sr);
-#endif*/
+   cpu_execute_interleaved(CPU_68K_0, CPU_FRAME_MHz(12,60),	// M68000 12MHz (60fps)
+	   CPU_68K_1, CPU_FRAME_MHz(12,60));	// M68000 12MHz (60fps)
    cpu_interrupt(CPU_68K_0, 6);
    cpu_interrupt(CPU_68K_0, 4);
-
-   cpu_execute_cycles(CPU_68K_1, CPU_FRAME_MHz(12,60));	// M68000 12MHz (60fps)
-   /*#ifdef RAINE_DEBUG
-      print_debug("PC1:%06x SR:%04x\n",s68000context.pc,s68000context.sr);
-#endif*/
    cpu_interrupt(CPU_68K_1, 4);
 
    Taito2610_Frame();			// Z80 and YM2610
@@ -1648,12 +1641,9 @@ if (brake >= 0) {RAM[0x022804] = ((RAM[0x022804] & 0x1f) | analog_mask[brake]);}
 
    // CPU Emulation
 
-   cpu_execute_cycles(CPU_68K_0, CPU_FRAME_MHz(16,60));		// M68000 16MHz (60fps)
-      print_debug("PC0:%06x SR:%04x\n",s68000context.pc,s68000context.sr);
+   cpu_execute_interleaved(CPU_68K_0, CPU_FRAME_MHz(16,60),	// M68000 16MHz (60fps)
+	   CPU_68K_1, CPU_FRAME_MHz(16,60));	// M68000 16MHz (60fps)
    cpu_interrupt(CPU_68K_0, 5);
-
-   cpu_execute_cycles(CPU_68K_1, CPU_FRAME_MHz(16,60));		// M68000 16MHz (60fps)
-      print_debug("PC1:%06x SR:%04x\n",s68000context.pc,s68000context.sr);
    cpu_interrupt(CPU_68K_1, 4);
 
    Taito2610_Frame();				// Z80 and YM2610
@@ -53,6 +53,7 @@
 #include "speed_hack.h"
 #include "bld.h"
 #include "alpha.h"
+#include "video/gfxcache.h"
 
 /* Output ports */
 #define CPS1_OBJ_BASE		0x00	/* Base address of objects */
@@ -2022,26 +2023,36 @@ void load_common(int cps2)
    GFX_SPR = load_region[REGION_GFX1];
    size = get_region_size(REGION_GFX1); // size of packed region
 
-   load_message(_("Decoding GFX layer"));
-   if (cps2)
-     cps2_gfx_decode();
-   else
-     cps1_gfx_decode(GFX_SPR,size);
+   // The unpacked 16x16 layer is all that is needed from the decoding
+   GFX_SPR16 = gfx_cache_load("spr16",&cps2,sizeof(cps2),&ta,NULL);
+   if (GFX_SPR16 && ta != size*2)
+     GFX_SPR16 = NULL;
+
+   if (!GFX_SPR16) {
+     load_message(_("Decoding GFX layer"));
+     if (cps2)
+       cps2_gfx_decode();
+     else
+       cps1_gfx_decode(GFX_SPR,size);
+   }
 
    cps1_init_machine();
 
-   load_message(_("Rebuilding 16x16 layer"));
-   /* We can't use base2 to save memory on GFX_SPR16 because it's shared with sprites ! */
-   // printf("size of GFX_SPR16 %d Mb\n",size*2/1024/1024);
-   GFX_SPR16 = AllocateMem(size*2);
-   if (!GFX_SPR16) return;
+   if (!GFX_SPR16) {
+     load_message(_("Rebuilding 16x16 layer"));
+     /* We can't use base2 to save memory on GFX_SPR16 because it's shared with sprites ! */
+     // printf("size of GFX_SPR16 %d Mb\n",size*2/1024/1024);
+     GFX_SPR16 = AllocateMem(size*2);
+     if (!GFX_SPR16) return;
 
-   for(ta=0;ta<size;ta++)
-   {
-     GFX_SPR[ta] ^= 0xff;
-     // Unpack 16x16 sprites (and 32x32)
-     GFX_SPR16[(ta<<1)] = GFX_SPR[ta] & 0xf;
-     GFX_SPR16[(ta<<1)+1] = GFX_SPR[ta] >> 4;
+     for(ta=0;ta<size;ta++)
+     {
+       GFX_SPR[ta] ^= 0xff;
+       // Unpack 16x16 sprites (and 32x32)
+       GFX_SPR16[(ta<<1)] = GFX_SPR[ta] & 0xf;
+       GFX_SPR16[(ta<<1)+1] = GFX_SPR[ta] >> 4;
+     }
+     gfx_cache_save("spr16",&cps2,sizeof(cps2),GFX_SPR16,size*2,NULL,0);
    }
 
    if (rotate_screen) {
@@ -3415,15 +3426,10 @@ static void render_cps2_sprites_pbitmap()
 
 static void DrawTileQueue(int pri)
 {
-  struct TILE_Q *tile_ptr;
-  UINT32 ta;
+  UINT32 n;
 
-  tile_ptr = first_tile[pri];
-  while(tile_ptr->next){
-    ta = tile_ptr->tile;
-    alpha_sprite(ta,tile_ptr->x,tile_ptr->y,tile_ptr->map, tile_ptr->flip);
-    tile_ptr = tile_ptr->next;
-  }
+  for (n=tq_first[pri]; n<tq_first[pri+1]; n++)
+    alpha_sprite(tq.tile[n],tq.x[n],tq.y[n],tq.map[n], tq.flip[n]);
 }
 
 static void render_sprites()
@@ -26,6 +26,9 @@
 #include "config.h"
 #include "hiscore.h"
 #include "video/res.h"
+#include "video/pipeline.h"
+#include "video/gfxcache.h"
+#include "video/lazygfx.h"
 #include "tc005rot.h"
 #ifdef HAS_CONSOLE
 #include "sdl/console/console.h"
@@ -67,6 +70,7 @@ void LoadDefault(void)
   MouseB = &mouse_b;
   setup_z80_frame(CPU_Z80_0,CPU_FRAME_MHz(4,60));
   z80_offdata = 0; // code location = data location
+  set_interleave(1);
   reset_timers();
   reset_z80_banks();
 
@@ -78,6 +82,7 @@ void LoadDefault(void)
 
 #if HAVE_68000
    Clear68000List();				// Clear M68000 memory lists
+   reset_idle_hacks();				// Idle loops are per game
    StarScreamEngine=0;				// No M68000 by default
 #endif
 
@@ -199,6 +204,7 @@ void ClearDefault(void)
 #endif
    reset_arpro();				// Free action replay
    reset_savegames();
+   clear_video_states();
 
    saDestroySound(1);				// Free all sound resources
 
@@ -206,8 +212,10 @@ void ClearDefault(void)
 
    if(raine_cfg.show_fps_mode==2) raine_cfg.show_fps_mode=0;			// Don't like it running from time=0
 
+   lazy_gfx_close();				// before the pool, for the stats
    clear_regions();
    FreeMemoryPool();				// Free anything left in the memory pool
+   gfx_cache_close();				// and the mapped gfx
 
    LanguageSw.Count = 0;
 
@@ -18,6 +18,7 @@
 #include "emumain.h" // set_reset_function
 #include "scroll.h"
 #include "tchnosnd.h"
+#include "video/lazygfx.h"
 
 static UINT8 *RAM_Z80;
 static UINT8 *RAM_MAIN;
@@ -85,10 +86,11 @@ static void mugsmash_draw_sprites(void)
 
 	const UINT8 *source = RAM_SPRITE;
 	const UINT8 *finish = source+0x4000;
+	UINT8 *spr;
 
 	while( source<finish )
 	{
-		int num = source[6]|(source[4]<<8);
+		int num = (source[6]|(source[4]<<8)) % max_sprites[0];
 
 		int xpos = source[0];
 		int ypos = source[8];
@@ -108,6 +110,8 @@ static void mugsmash_draw_sprites(void)
 		if((xpos<=16)||(xpos>=320+32)) { source+=16; continue;} // offscreen, skip
 		if((ypos<=16)||(ypos>=240+32)) { source+=16; continue;} // offscreen, skip
 
+		spr = lazy_tile(lazy_gfx[0], num); // decodes it, sets gfx1_solid[num]
+
 		if(gfx1_solid[num])
 		{
 
@@ -132,13 +136,13 @@ static void mugsmash_draw_sprites(void)
 
 			if(gfx1_solid[num]==1) // Some pixels; trans
 			{
-				if(!flipx) Draw16x16_Trans_Mapped_Rot       (&gfx1[num<<8], xpos, ypos, map);
-				else Draw16x16_Trans_Mapped_FlipY_Rot       (&gfx1[num<<8], xpos, ypos, map); // in raine flipy is flipx .... wtf!
+				if(!flipx) Draw16x16_Trans_Mapped_Rot       (spr, xpos, ypos, map);
+				else Draw16x16_Trans_Mapped_FlipY_Rot       (spr, xpos, ypos, map); // in raine flipy is flipx .... wtf!
 			}
 			else                           // all pixels; solid
 			{
-				if(!flipx) Draw16x16_Mapped_Rot             (&gfx1[num<<8], xpos, ypos, map);
-				else Draw16x16_Mapped_FlipY_Rot             (&gfx1[num<<8], xpos, ypos, map); // in raine flipy is flipx .... wtf!
+				if(!flipx) Draw16x16_Mapped_Rot             (spr, xpos, ypos, map);
+				else Draw16x16_Mapped_FlipY_Rot             (spr, xpos, ypos, map); // in raine flipy is flipx .... wtf!
 			}
 
 
@@ -189,6 +193,7 @@ static void mugsmash_draw_16x16_layer(int scrollx,int scrolly, int palbase, int
 
 				colour += palbase;
 //				tileno &= 0xffff;
+				tileno %= max_sprites[1];
 
 				if( gfx2_solid[tileno] || layersolid )
 				{
@@ -202,20 +207,20 @@ static void mugsmash_draw_16x16_layer(int scrollx,int scrolly, int palbase, int
 					{
 						switch (flipxy)
 						{
-							case 0x00: Draw16x16_Trans_Mapped_Rot       (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0x80: Draw16x16_Trans_Mapped_FlipX_Rot (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0x40: Draw16x16_Trans_Mapped_FlipY_Rot (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0xc0: Draw16x16_Trans_Mapped_FlipXY_Rot(&gfx2[tileno<<8], drawx, drawy, map); break;
+							case 0x00: Draw16x16_Trans_Packed_Mapped_Rot       (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0x80: Draw16x16_Trans_Packed_Mapped_FlipX_Rot (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0x40: Draw16x16_Trans_Packed_Mapped_FlipY_Rot (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0xc0: Draw16x16_Trans_Packed_Mapped_FlipXY_Rot(&gfx2[tileno<<7], drawx, drawy, map); break;
 						}
 					}
 					else
 					{
 						switch (flipxy)
 						{
-							case 0x00: Draw16x16_Mapped_Rot       (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0x80: Draw16x16_Mapped_FlipX_Rot (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0x40: Draw16x16_Mapped_FlipY_Rot (&gfx2[tileno<<8], drawx, drawy, map); break;
-							case 0xc0: Draw16x16_Mapped_FlipXY_Rot(&gfx2[tileno<<8], drawx, drawy, map); break;
+							case 0x00: Draw16x16_Packed_Mapped_Rot       (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0x80: Draw16x16_Packed_Mapped_FlipX_Rot (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0x40: Draw16x16_Packed_Mapped_FlipY_Rot (&gfx2[tileno<<7], drawx, drawy, map); break;
+							case 0xc0: Draw16x16_Packed_Mapped_FlipXY_Rot(&gfx2[tileno<<7], drawx, drawy, map); break;
 						}
 					}
 				}
@@ -274,8 +279,8 @@ static gfx_layout mugsmash_16x16tiles2 =
 
 static struct GFX_LIST mugsmash_gfx[] =
 {
-   { REGION_GFX1, &mugsmash_16x16tiles, },
-   { REGION_GFX2, &mugsmash_16x16tiles2, },
+   { REGION_GFX1, &mugsmash_16x16tiles, GFX_LAZY },
+   { REGION_GFX2, &mugsmash_16x16tiles2, GFX_PACKED },
    { 0,           NULL,           },
 };
 
@@ -1150,10 +1150,9 @@ static void load_darius2(void)
 
 static void execute_ninjaw(void)
 {
-   cpu_execute_cycles(CPU_68K_0,CPU_FRAME_MHz(12,60));
+   cpu_execute_interleaved(CPU_68K_0,CPU_FRAME_MHz(12,60),
+	   CPU_68K_1,CPU_FRAME_MHz(12,60));
    cpu_interrupt(CPU_68K_0,4);
-
-   cpu_execute_cycles(CPU_68K_1,CPU_FRAME_MHz(12,60));
    cpu_interrupt(CPU_68K_1,4);
 
    execute_z80_audio_frame();
@@ -13,6 +13,7 @@
 #include "2151intf.h"
 #include "gun.h"
 #include "emumain.h"
+#include "video/pipeline.h"
 
 
 static struct ROM_INFO rom_opwolf[] =
@@ -547,6 +548,13 @@ static void load_opwolf(void)
    set_colour_mapper(&col_map_xxxx_rrrr_gggg_bbbb);
    InitPaletteMap(RAM+0x2A000, 0x100, 0x10, 0x1000);
 
+   // Everything read by DrawOperationWolf, for the pipelined rendering
+
+   add_video_state(&RAM_VIDEO,  0x20000);
+   add_video_state(&RAM_OBJECT, 0x02000);
+   add_video_state(&RAM_SCROLL, 0x00010);
+   add_video_palette(0x800);
+
 
 /*
  *  StarScream Main 68000 Setup
@@ -714,10 +714,9 @@ else{
 
    /*----[Run the 68000's]----*/
 
-   cpu_execute_cycles(CPU_68K_0, CPU_FRAME_MHz(16,60));
+   cpu_execute_interleaved(CPU_68K_0, CPU_FRAME_MHz(16,60),
+	   CPU_68K_1, CPU_FRAME_MHz(16,60));
    cpu_interrupt(CPU_68K_0, 4);
-
-   cpu_execute_cycles(CPU_68K_1, CPU_FRAME_MHz(16,60));
    cpu_interrupt(CPU_68K_1, 4);
    cpu_interrupt(CPU_68K_1, 5);
 }
@@ -433,7 +433,7 @@ struct SOUND_INFO taito_ym2610b_sound[] =
 /**** not pan control (lock volume) ****/
 void Taito2610_Frame(void){
   //cpu_execute_cycles(CPU_Z80_0, (4000000/60)*2);			// Sound Z80
-  execute_z80_audio_frame(); // How short !
+  start_z80_audio_frame(); // How short !
 }
 
 /*******************************************************/
@@ -648,7 +648,7 @@ struct SOUND_INFO taito_ym2151_sound[] =
 void Taito2151_Frame(void)
 {
    if(tc0140syt_want_nmi()) cpu_int_nmi(CPU_Z80_0);
-   execute_z80_audio_frame();
+   start_z80_audio_frame();
 }
 
 void Taito2151_FrameFast(void)
@@ -681,7 +681,7 @@ void Taito2151_Frame_xsystem(void)
 {
 /*     cpu_execute_cycles(CPU_Z80_0, CPU_FRAME_MHz(8,60));	// Z80 8MHz (60fps) */
 /*     cpu_interrupt(CPU_Z80_0, 0x38); */
-      execute_z80_audio_frame();
+      start_z80_audio_frame();
 }
 
 void AddTaitoYM2151(UINT32 p1, UINT32 p2, UINT32 romsize, UINT8 *adpcmA, UINT8 *adpcmB)
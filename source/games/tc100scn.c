@@ -312,6 +312,37 @@ static void scroll_512_bg0_lscroll(TC0100SCN_LAYER *tc_layer, int trans) {
   } // for y
 }
 
+/* BG0/BG1 through the generic tilemap : the layer is kept rendered and only
+   the tiles which change are drawn again. */
+
+static void bg0_tile_info(TILEMAP *tmap, UINT32 index, TILEMAP_TILE *tile)
+{
+   TC0100SCN_LAYER *tc_layer = (TC0100SCN_LAYER*)tmap->param;
+   UINT8 *RAM_BG = tc_layer->RAM + (index<<2);
+
+   tile->code = ReadWord(&RAM_BG[2]) & tc_layer->tile_mask;
+   tile->bank = RAM_BG[0];
+   tile->flip = ((RAM_BG[1] & 0x80) ? TILE_FLIPX : 0) |
+      ((RAM_BG[1] & 0x40) ? TILE_FLIPY : 0);
+}
+
+static int render_bg0_tilemap(TC0100SCN_LAYER *tc_layer, int trans, UINT32 scr_x, UINT32 scr_y)
+{
+   if (!tc_layer->tmap || tc_layer->tmap->gfx != tc_layer->GFX) {
+      if (tc_layer->tmap_failed == tc_layer->GFX)
+	 return 0; // don't try again at each frame
+      tilemap_destroy(tc_layer->tmap);
+      tc_layer->tmap = tilemap_create(bg0_tile_info, tc_layer, tc_layer->GFX,
+				      8, 8, 64, 64, 16, TILEMAP_TRANSPARENT);
+      if (!tc_layer->tmap)
+	 tc_layer->tmap_failed = tc_layer->GFX;
+   }
+
+   return tilemap_draw(tc_layer->tmap, scr_x, scr_y, tc_layer->bmp_x,
+		       tc_layer->bmp_y, tc_layer->bmp_w, tc_layer->bmp_h,
+		       NULL, NULL, trans, 0);
+}
+
 static void render_bg0_mapped(TC0100SCN_LAYER *tc_layer, int trans)
 {
    int x,y,x16,y16,zzzz,zzz,zz,ta;
@@ -344,6 +375,9 @@ static void render_bg0_mapped(TC0100SCN_LAYER *tc_layer, int trans)
 
    // fprintf(stderr,"bg %d,%d -> %d,%d flipped %d\n",ReadWord(RAM_SCR+0),ReadWord(RAM_SCR+6),scr_x,scr_y,ReadWord(tc0100scn[0].layer[0].SCR + 14) & 1);
 
+   if (render_bg0_tilemap(tc_layer, trans, scr_x, scr_y))
+      return;
+
    MAKE_SCROLL_512x512_4_8(
          scr_x,
          scr_y
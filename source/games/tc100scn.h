@@ -9,6 +9,7 @@ extern "C" {
 /******************************************************************************/
 
 #include "deftypes.h"
+#include "tilemap.h"
 
 #define MAX_CHIP		2		// F1-System has 2 chips
 
@@ -31,6 +32,8 @@ typedef struct TC0100SCN_LAYER			// Information about 1 layer
    UINT32 bmp_w,bmp_h;				// Game screen size (320,224)
    UINT32 tile_mask;				// mask for tile number
    UINT32 scr_x,scr_y;				// Scroll offset add (16,8)
+   TILEMAP *tmap;				// Cached layer (BG0/BG1), made on first draw
+   UINT8 *tmap_failed;				// GFX for which tilemap_create failed
 } TC0100SCN_LAYER;
 
 typedef struct TC0100SCN			// Information about 1 chip
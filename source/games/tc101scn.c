@@ -31,10 +31,19 @@ void tc0100scn_0_load_update(void);
 
 void init_tc0100scn(int chip)
 {
+   int n;
+
    GFX_FG[chip] = tc0100scn[chip].GFX_FG0;
    RAM_FG[chip] = tc0100scn[chip].RAM+0x6000;
 
    tc0100scn[chip].layer[2].MASK	= GFX_FG0_SOLID[chip];
+   // called again by the drivers when RefreshBuffers is set : the tilemaps
+   // are made again on the next draw (LoadDefault clears them for a new game)
+   for (n=0; n<2; n++) {
+      tilemap_destroy(tc0100scn[chip].layer[n].tmap);
+      tc0100scn[chip].layer[n].tmap = NULL;
+      tc0100scn[chip].layer[n].tmap_failed = NULL;
+   }
 
    gfx_fg0_dirty_count[chip] = 0;
    memset(GFX_FG0_DIRTY[chip],0x00,GFX_FG0_COUNT*4);
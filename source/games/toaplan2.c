@@ -6471,15 +6471,15 @@ static void execute_truxton2(void)
 
 static void DrawTileQueue(void)
 {
-   struct TILE_Q *tile_ptr;
-   UINT32 ta,pri;
+   UINT32 ta,pri,n,end,run;
+   UINT8 *map;
+   int x,y;
 
    TerminateTileQueue();
 
-   if(romset == 11){
-
    for(pri=0;pri<MAX_PRI;pri++){
-      tile_ptr = first_tile[pri];
+      n   = tq_first[pri];
+      end = tq_first[pri+1];
 
 #ifdef USE_CACHE
       clear_tile_cache();
@@ -6490,123 +6490,66 @@ static void DrawTileQueue(void)
       case 0x01:
       case 0x02:
 
-      while(tile_ptr->next){
-         ta = tile_ptr->tile;
-         ta = object_bank[ta>>15] | (ta & 0x7FFF);
+      for(; n<end; n++){
+         ta = tq.tile[n];
+         if(romset == 11)
+            ta = object_bank[ta>>15] | (ta & 0x7FFF);
          if(GFX_BG0_SOLID[ta]!=0){                      // No pixels; skip
-	   if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
-               Draw8x8_Trans_Mapped_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map);
+            x = tq.x[n]; y = tq.y[n]; map = tq.map[n];
+            if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
+               Draw8x8_Trans_Mapped_Rot(&GFX[ta<<6],x,y,map);
             else {                                        // all pixels; solid
 #ifdef USE_CACHE
-	      if ((tile_cache[ta]) && (cache_map[ta] == tile_ptr->map)) {
-		Move8x8_Rot(tile_cache[ta],tile_ptr->x,tile_ptr->y,NULL);
+	      if (tile_cache[ta] && cache_map[ta] == map) {
+		Move8x8_Rot(tile_cache[ta],x,y,NULL);
 	      } else {
 #endif
-		Draw8x8_Mapped_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map);
+		Draw8x8_Mapped_Rot(&GFX[ta<<6],x,y,map);
 #ifdef USE_CACHE
-		add_tile_cache_Rot(NULL,tile_ptr->x,tile_ptr->y,ta);
-		cache_map[ta] = tile_ptr->map;
+		add_tile_cache_Rot(NULL,x,y,ta);
+		cache_map[ta] = map;
 	      }
 #endif
 	    }
          }
-         tile_ptr = tile_ptr->next;
       }
 
       break;
       case 0x03:        // OBJECT: skip blank, check solid, *flipping*
 
-      while(tile_ptr->next){
-         ta = tile_ptr->tile;
-         ta = object_bank[ta>>15] | (ta & 0x7FFF);
-         if(GFX_BG0_SOLID[ta]!=0){                      // No pixels; skip
-            if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
-               Draw8x8_Trans_Mapped_flip_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map, tile_ptr->flip);
-            else {                                       // all pixels; solid
-#ifdef USE_CACHE
-	      if (tile_cache[ta] && (cache_map[ta] == tile_ptr->map)) {
-		Move8x8_Rot(tile_cache[ta],tile_ptr->x,tile_ptr->y,NULL);
-	      } else {
-#endif
-		Draw8x8_Mapped_flip_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map, tile_ptr->flip);
-#ifdef USE_CACHE
-		add_tile_cache_Rot(NULL,tile_ptr->x,tile_ptr->y,ta);
-		cache_map[ta] = tile_ptr->map;
-	    }
-#endif
-	    }
-         }
-         tile_ptr = tile_ptr->next;
-      }
-
-      break;
-      }
-
-   }
-
-   }
-   else{
-
-   for(pri=0;pri<MAX_PRI;pri++){
-      tile_ptr = first_tile[pri];
-
-#ifdef USE_CACHE
-      clear_tile_cache();
-#endif
-      switch(pri&3){
-
-      case 0x00:        // BG: skip blank, check solid
-      case 0x01:
-      case 0x02:
-
-      while(tile_ptr->next){
-         ta = tile_ptr->tile;
-         if(GFX_BG0_SOLID[ta]!=0){                      // No pixels; skip
-            if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
-               Draw8x8_Trans_Mapped_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map);
-            else {                                        // all pixels; solid
+      while(n<end){
+         // the flipped drawing functions are chosen once per run of tiles
+         // with the same flip
+         draw_mapped_func *draw_trans = Draw8x8_Trans_Mapped_Flip_Rot[tq.flip[n]];
+         draw_mapped_func *draw_solid = Draw8x8_Mapped_Flip_Rot[tq.flip[n]];
+         run = TileQueueRun(n,end);
+         for(; n<run; n++){
+            ta = tq.tile[n];
+            if(romset == 11)
+               ta = object_bank[ta>>15] | (ta & 0x7FFF);
+            if(GFX_BG0_SOLID[ta]!=0){                      // No pixels; skip
+               if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
+                  (*draw_trans)(&GFX[ta<<6],tq.x[n],tq.y[n],tq.map[n]);
+               else {                                       // all pixels; solid
+/* It's better NOT to use the cache for sprites, because some games are using
+ * a flip effect to draw 2 halves of a big sprite -> with the cache you loose
+ * the fliping effect ! Only romset 11 still uses it. */
 #ifdef USE_CACHE
-	      if (tile_cache[ta] && cache_map[ta] == tile_ptr->map) {
-		Move8x8_Rot(tile_cache[ta],tile_ptr->x,tile_ptr->y,NULL);
-	      } else {
+		  if (romset == 11 && tile_cache[ta] && cache_map[ta] == tq.map[n]) {
+		     Move8x8_Rot(tile_cache[ta],tq.x[n],tq.y[n],NULL);
+		     continue;
+		  }
 #endif
-		Draw8x8_Mapped_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map);
+                  (*draw_solid)(&GFX[ta<<6],tq.x[n],tq.y[n],tq.map[n]);
 #ifdef USE_CACHE
-		add_tile_cache_Rot(NULL,tile_ptr->x,tile_ptr->y,ta);
-		cache_map[ta] = tile_ptr->map;
-	      }
+		  if (romset == 11) {
+		     add_tile_cache_Rot(NULL,tq.x[n],tq.y[n],ta);
+		     cache_map[ta] = tq.map[n];
+		  }
 #endif
-	    }
+	       }
+            }
          }
-         tile_ptr = tile_ptr->next;
-      }
-
-      break;
-      case 0x03:        // OBJECT: skip blank, check solid, *flipping*
-
-      while(tile_ptr->next){
-         ta = tile_ptr->tile;
-         if(GFX_BG0_SOLID[ta]!=0){                      // No pixels; skip
-            if(GFX_BG0_SOLID[ta]==1)                    // Some pixels; trans
-               Draw8x8_Trans_Mapped_flip_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map, tile_ptr->flip);
-            else {                                       // all pixels; solid
-/* It's better NOT to use the cache for sprites, because some games are using
- * a flip effect to draw 2 halves of a big sprite -> with the cache you loose
- * the fliping effect ! */
-//#ifdef USE_CACHE
-//	      if (tile_cache[ta] && cache_map[ta] == tile_ptr->map) {
-//		Move8x8_Rot(tile_cache[ta],tile_ptr->x,tile_ptr->y,NULL);
-//	      } else {
-//#endif
-		Draw8x8_Mapped_flip_Rot(&GFX[ta<<6],tile_ptr->x,tile_ptr->y,tile_ptr->map, tile_ptr->flip);
-//#ifdef USE_CACHE
-//		add_tile_cache_Rot(NULL,tile_ptr->x,tile_ptr->y,ta);
-//		cache_map[ta] = tile_ptr->map;
-//	      }
-//#endif
-	    }
-	 }
-         tile_ptr = tile_ptr->next;
       }
 
       break;
@@ -6614,8 +6557,6 @@ static void DrawTileQueue(void)
 
    }
 
-   }
-
 }
 
 static const UINT16 scr_ofs[ROM_COUNT][8] =
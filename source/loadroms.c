@@ -17,6 +17,8 @@
 #include "6502/m6502hlp.h"
 #endif
 #include "7z.h"
+#include "video/gfxcache.h"
+#include "video/lazygfx.h"
 
 #undef _
 #define _(string) gettext(string)
@@ -628,13 +630,28 @@ static UINT32 load_rom_region(UINT32 region)
    return 1;
 }
 
+static int packed_layout_ok(const GFX_LAYOUT *layout)
+{
+   // the packed tiles follow the screen rotation through tile_list, which
+   // has no packed type for the other sizes (and there are no rotated 64x64
+   // packed sprites to draw them anyway)
+   return layout->width == layout->height &&
+     (layout->width == 8 || layout->width == 16 || layout->width == 32);
+}
+
 static UINT32 load_gfx_region(UINT32 region)
 {
    UINT32 reg_size = 0;
    const VIDEO_INFO *video;
    const GFX_LIST *gfx_list;
-   int nb = 0;
+   int nb = 0, cached;
    UINT8 *buffer;
+   struct {
+     GFX_LAYOUT layout;
+     UINT32 reg_size;
+     UINT32 flags;
+   } params;			// what decode_gfx depends on, for the gfx cache
+   char name[32];
 
    video = current_game->video;
    gfx_list = video->gfx_list;
@@ -669,13 +686,51 @@ static UINT32 load_gfx_region(UINT32 region)
 	exit(1);
       }
 
-      if((gfx[nb] = load_region[region] = decode_gfx(buffer, reg_size, gfx_list->layout,&region_size[region]))) {
+      if ((gfx_list->flags & GFX_PACKED) &&
+	  !packed_layout_ok(gfx_list->layout)) {
+	allegro_message("GFX_PACKED for %s : only 8x8, 16x16 and 32x32 packed tiles can be rotated\n",
+	  get_region_name(region));
+	exit(1);
+      }
+
+      if (gfx_list->flags & GFX_LAZY) {
+	// the rom data stay in the region, decoded by lazy_tile
+	if (!(lazy_gfx[nb] = lazy_gfx_create(buffer, reg_size, gfx_list->layout)))
+	  return 0;
+	gfx_solid[nb] = lazy_gfx[nb]->solid;
+	max_sprites[nb] = lazy_gfx[nb]->count;
+	gfx_list++;
+	nb++;
+	continue;
+      }
+
+      memset(&params,0,sizeof(params));
+      params.layout = *gfx_list->layout;
+      params.reg_size = reg_size;
+      params.flags = gfx_list->flags;
+      sprintf(name,"%s_%d",get_region_name(region),nb);
+      gfx[nb] = gfx_cache_load(name,&params,sizeof(params),&region_size[region],&gfx_solid[nb]);
+      cached = (gfx[nb] != NULL);
+      if (!cached) {
+	gfx_solid[nb] = NULL;
+	if (gfx_list->flags & GFX_PACKED)
+	  gfx[nb] = decode_gfx_packed(buffer, reg_size, gfx_list->layout,&region_size[region]);
+	else
+	  gfx[nb] = decode_gfx(buffer, reg_size, gfx_list->layout,&region_size[region]);
+      }
+
+      if((load_region[region] = gfx[nb])) {
 #if USE_TC005
 	if (buffer != tc0005rot.GFX_ROT)
 #endif
        	{ // if this buffer is used for tc005rot then
 	  // don't rotate !!!
-	  if (gfx_list->layout->width == 16 && gfx_list->layout->height == 16) {
+	  if (gfx_list->flags & GFX_PACKED) {
+	    const GFX_LAYOUT *layout = gfx_list->layout;
+	    max_sprites[nb] = get_region_size(region)*2/(layout->width*layout->height);
+	    gfx_solid[nb] = make_solid_mask_packed(gfx[nb],max_sprites[nb],
+	      layout->width,layout->height);
+	  } else if (gfx_list->layout->width == 16 && gfx_list->layout->height == 16) {
 	    gfx_solid[nb] = make_solid_region_16x16(region);
 	    max_sprites[nb] = get_region_size(region)/0x100;
 	  } else if (gfx_list->layout->width == 16 && gfx_list->layout->height == 8) {
@@ -686,6 +741,10 @@ static UINT32 load_gfx_region(UINT32 region)
 	    max_sprites[nb] = get_region_size(region)/0x40;
 	  }
 	}
+	// make_solid_mask returns gfx_solid[nb] when it comes from the cache
+	if (!cached && gfx_solid[nb])
+	  gfx_cache_save(name,&params,sizeof(params),gfx[nb],region_size[region],
+	    gfx_solid[nb],get_pad_size(max_sprites[nb]));
       } else
 	return 0;
       gfx_list++; // check if there is more than 1 layout for this region...
@@ -745,6 +804,7 @@ void load_game_rom_info(void)
       if (i < MAX_GFX) {
 	gfx[i] = NULL;
 	gfx_solid[i] = NULL;
+	lazy_gfx[i] = NULL;
       }
    }
 
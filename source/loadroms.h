@@ -59,8 +59,16 @@ typedef struct GFX_LIST
 {
    UINT32       region;
    gfx_layout *layout;
+   UINT32       flags;
 } GFX_LIST;
 
+// GFX_LIST flags
+
+#define GFX_PACKED       (0x0001)	// 4bpp packed : 2 pixels per byte, drawn
+					// with the *_Packed_Mapped functions
+					// (8x8, 16x16 and 32x32 tiles only)
+#define GFX_LAZY         (0x0002)	// decoded when drawn, see lazygfx.h
+
 enum region_type
 {
    REGION_NONE = 0,
@@ -131,6 +131,8 @@ int capture_new_pictures;
 static BITMAP *raster_bitmap;
 static void draw_neocd();
 static void draw_sprites(int start, int end, int start_line, int end_line);
+static void strips_dirty(int count);
+static void all_strips_dirty();
 static UINT8 dark_screen; // only neogeo ?
 static int fc;
 static int size_mcard;
@@ -845,6 +847,8 @@ static void write_videoreg(UINT32 offset, UINT32 data) {
 	  update_raster();
       }
       neogeo_vidram[video_pointer] = data;
+      if (video_pointer >= 0x8000 && video_pointer < 0x8600)
+	  strips_dirty(video_pointer & 0x1ff);
 
       video_pointer += video_modulo;
       // video_pointer = (video_pointer & 0x8000) | ((video_pointer + video_modulo) & 0x7fff);
@@ -1866,19 +1870,84 @@ static inline void alpha_sprite(UINT32 code, int x,int y,UINT8 *map,int zx,int z
 	Draw16x16_Trans_Mapped_ZoomXY_Alpha_flip_Rot(&GFX[code<<8],x,y,map,zx,zy,flip);
 }
 
-static void draw_sprites(int start, int end, int start_line, int end_line) {
-    if (!check_layer_enabled(layer_id_data[1])) return;
-    if (end_line > 223) end_line = 223;
-    if (capture_mode) return draw_sprites_capture(start,end,start_line,end_line);
+/* Sprite geometry : the position and zoom of each strip (column of tiles),
+ * which depend on the chaining with the previous strips, and the bands of
+ * 16 lines where the strip has tiles. It's computed once per frame and
+ * updated only when the sprite control words change, so that each raster
+ * segment walks only the strips crossing its lines instead of all of them. */
+
+#define NB_STRIPS 381
+#define NB_BANDS (224/16)
+
+typedef struct {
+    INT16 sx,oy;
+    UINT8 rows,rzx,rzy,zy,fullmode;
+    UINT16 bands; // bit n = has tiles between lines n*16 and n*16+15
+} SPR_STRIP;
+
+static SPR_STRIP spr_strip[NB_STRIPS];
+static UINT16 band_strips[NB_BANDS][NB_STRIPS];
+static int band_count[NB_BANDS];
+static int strips_dirty_min = 0, strips_dirty_max = NB_STRIPS-1,
+	   strips_raster_frame;
+
+static void strips_dirty(int count) {
+    if (count >= NB_STRIPS) // the 512 entries of the tables aren't all used
+	return;
+    if (count < strips_dirty_min) strips_dirty_min = count;
+    if (count > strips_dirty_max) strips_dirty_max = count;
+}
+
+static void all_strips_dirty() {
+    strips_dirty_min = 0;
+    strips_dirty_max = NB_STRIPS-1;
+}
+
+static int strip_row_y(SPR_STRIP *s, int y) {
+    // This is much more accurate for the zoomed bgs in aof/aof2
+    int sy = s->oy + (((s->rzy+1)*y)>>4);
+    if (s->fullmode == 2 || (s->fullmode == 1 && s->rzy == 0xff))
+    {
+	if (sy >= 248) {
+	    debug(DBG_SPRITES,"sy corr 1 old %d new %d\n",sy,sy-2*(s->rzy+1));
+	    sy -= 2 * (s->rzy + 1);
+	}
+    }
+    else if (s->fullmode == 1)
+    {
+	if (y >= 0x10) sy -= 2 * (s->rzy + 1);
+    }
+    else if (sy > 0x110) sy -= 0x200;
+    return sy;
+}
+
+static void update_strips() {
     int         sx =0,sy =0,oy =0,rows =0,zx = 1, rzy = 1;
-    int         offs,count,y;
-    int         tileatr,y_control,zoom_control;
-    UINT32 tileno;
+    int         count,y,start,end,b;
+    int         y_control,zoom_control;
     char         fullmode=0;
-    int         rzx=16,zy=0;
-    UINT8 *map;
+    SPR_STRIP *s;
+
+    if (strips_raster_frame != raster_frame) {
+	// raster_frame changes the sy correction below
+	strips_raster_frame = raster_frame;
+	all_strips_dirty();
+    }
+    if (strips_dirty_min > strips_dirty_max)
+	return;
+    // restart from the beginning of the chain, and go until its end
+    start = MIN(strips_dirty_min, NB_STRIPS-1);
+    while (start > 0 && (neogeo_vidram[0x8200 + start] & 0x40))
+	start--;
+    end = MIN(strips_dirty_max+1, NB_STRIPS);
+    while (end < NB_STRIPS && (neogeo_vidram[0x8200 + end] & 0x40))
+	end++;
+    strips_dirty_min = NB_STRIPS;
+    strips_dirty_max = -1;
 
     for (count=start; count<end;count++) {
+	s = &spr_strip[count];
+	s->bands = 0;
 
 	zoom_control = neogeo_vidram[0x8000 + count];
 	y_control = neogeo_vidram[0x8200 + count];
@@ -1886,7 +1955,7 @@ static void draw_sprites(int start, int end, int start_line, int end_line) {
 	// If this bit is set this new column is placed next to last one
 	if (y_control & 0x40) {
 	    if (rows == 0) continue; // chain on an erased 3d sprite
-	    sx += (rzx);
+	    sx += (zx+1);
 
 	    // Get new zoom for this column
 	    zx = (zoom_control >> 8)&0x0F;
@@ -1949,82 +2018,125 @@ static void draw_sprites(int start, int end, int start_line, int end_line) {
 	    if(rows>0x20) rows=0x20;
 	}
 
-	rzx = zx+1;
-
 	if ( sx >= 0x1F0 )
 	    sx -= 0x200;
 
-	// No point doing anything if tile strip is 0
-	if (sx < -offx || (sx>= maxx)) {
-	    continue;
-	}
-
-	offs = count<<6;
-
+	s->sx = sx;
+	s->oy = oy;
+	s->rows = rows;
+	s->rzx = zx+1;
+	s->rzy = rzy;
+	s->fullmode = fullmode;
 	// TODO : eventually find the precise correspondance between rzy ane zy, this
 	// here is just a guess...
 	if (rzy)
-	    zy = (rzy >> 4) + 1;
+	    s->zy = (rzy >> 4) + 1;
 	else
-	    zy = 0;
+	    s->zy = 0;
+
+	for (y=0; y < rows; y++) {
+	    int y1 = strip_row_y(s,y), y2 = y1 + s->zy;
+	    if (y1 > 223 || y2 < 0) continue;
+	    if (y1 < 0) y1 = 0;
+	    if (y2 > 223) y2 = 223;
+	    for (b=y1>>4; b<=y2>>4; b++)
+		s->bands |= 1<<b;
+	}
+    }
 
-	debug(DBG_SPRITES,"before row loop sy %d oy %d\n",sy,oy);
-	// rows holds the number of tiles in each vertical multisprite block
-	for (y=0; y < rows ;y++) {
-	    // 100% specific to neocd : maximum possible sprites $80000
-	    // super sidekicks 2 draws the playground with bit $8000 set
-	    // the only way to see the playground is to use and $7fff
-	    // Plus rasters must be enabled
-	    tileatr = neogeo_vidram[offs+1];
-	    /* So here is the tileatr format :
-	     * bits 0-3 : real attribute bits
-	     * bits 4-6 : high part of tile number in neogeo !
-	     * bits 8-15: color bank */
-	    if (is_neocd())
-		tileno = neogeo_vidram[offs] & sprites_mask;
-	    else {
-		tileno = neogeo_vidram[offs] | ((tileatr << 12) & 0x70000);
-		/* A sprite_mask is mandatory here, we must just keep the lower
-		 * bits, a division would be incorrect */
-		tileno &= sprites_mask;
-	    }
-	    offs += 2;
-	    if (y)
-		// This is much more accurate for the zoomed bgs in aof/aof2
-		sy = oy + (((rzy+1)*y)>>4);
+    for (b=0; b<NB_BANDS; b++) {
+	band_count[b] = 0;
+	for (count=0; count<NB_STRIPS; count++)
+	    if (spr_strip[count].bands & (1<<b))
+		band_strips[b][band_count[b]++] = count;
+    }
+}
 
-	    if (!(irq.control & IRQ1CTRL_AUTOANIM_STOP)) {
-		if (tileatr&0x8) {
-		    tileno = (tileno&~7)|(neogeo_frame_counter&7);
-		} else if (tileatr&0x4) {
-		    tileno = (tileno&~3)|(neogeo_frame_counter&3);
-		}
-	    }
+static void draw_strip(int count, int start_line, int end_line) {
+    SPR_STRIP *s = &spr_strip[count];
+    int         offs,y,sy;
+    int         tileatr;
+    UINT32 tileno;
+    UINT8 *map;
 
-	    if (fullmode == 2 || (fullmode == 1 && rzy == 0xff))
-	    {
-		if (sy >= 248) {
-		    debug(DBG_SPRITES,"sy corr 1 old %d new %d\n",sy,sy-2*(rzy+1));
-		    sy -= 2 * (rzy + 1);
-		}
-	    }
-	    else if (fullmode == 1)
-	    {
-		if (y >= 0x10) sy -= 2 * (rzy + 1);
-	    }
-	    else if (sy > 0x110) sy -= 0x200;
+    // No point doing anything if tile strip is 0
+    if (s->sx < -offx || (s->sx>= maxx)) {
+	return;
+    }
 
-	    if ((sy<=end_line && sy+zy>=start_line) && video_spr_usage[tileno])
-	    {
-		debug(DBG_SPRITES,"%d,%d,%x zoom %d,%d offs %x\n",sx,sy,tileno,rzx,zy,offs);
-		MAP_PALETTE_MAPPED_NEW(
-			(tileatr >> 8),
-			16,
-			map);
-		alpha_sprite(tileno,sx+offx,sy+16,map,rzx,zy,tileatr & 3);
+    offs = count<<6;
+
+    debug(DBG_SPRITES,"before row loop oy %d\n",s->oy);
+    // rows holds the number of tiles in each vertical multisprite block
+    for (y=0; y < s->rows ;y++) {
+	// 100% specific to neocd : maximum possible sprites $80000
+	// super sidekicks 2 draws the playground with bit $8000 set
+	// the only way to see the playground is to use and $7fff
+	// Plus rasters must be enabled
+	tileatr = neogeo_vidram[offs+1];
+	/* So here is the tileatr format :
+	 * bits 0-3 : real attribute bits
+	 * bits 4-6 : high part of tile number in neogeo !
+	 * bits 8-15: color bank */
+	if (is_neocd())
+	    tileno = neogeo_vidram[offs] & sprites_mask;
+	else {
+	    tileno = neogeo_vidram[offs] | ((tileatr << 12) & 0x70000);
+	    /* A sprite_mask is mandatory here, we must just keep the lower
+	     * bits, a division would be incorrect */
+	    tileno &= sprites_mask;
+	}
+	offs += 2;
+	sy = strip_row_y(s,y);
+
+	if (!(irq.control & IRQ1CTRL_AUTOANIM_STOP)) {
+	    if (tileatr&0x8) {
+		tileno = (tileno&~7)|(neogeo_frame_counter&7);
+	    } else if (tileatr&0x4) {
+		tileno = (tileno&~3)|(neogeo_frame_counter&3);
 	    }
-	}  // for y
-    }  // for count
+	}
+
+	if ((sy<=end_line && sy+s->zy>=start_line) && video_spr_usage[tileno])
+	{
+	    debug(DBG_SPRITES,"%d,%d,%x zoom %d,%d offs %x\n",s->sx,sy,tileno,s->rzx,s->zy,offs);
+	    MAP_PALETTE_MAPPED_NEW(
+		    (tileatr >> 8),
+		    16,
+		    map);
+	    alpha_sprite(tileno,s->sx+offx,sy+16,map,s->rzx,s->zy,tileatr & 3);
+	}
+    }  // for y
+}
+
+static void draw_sprites(int start, int end, int start_line, int end_line) {
+    int count,n,mask;
+    if (!check_layer_enabled(layer_id_data[1])) return;
+    if (end_line > 223) end_line = 223;
+    if (capture_mode) return draw_sprites_capture(start,end,start_line,end_line);
+    if (start_line < 0) start_line = 0;
+    if (start_line > end_line) return;
+
+    if (RefreshBuffers) // savegame...
+	all_strips_dirty();
+    update_strips();
+
+    if (start_line>>4 == end_line>>4) {
+	// the usual raster segment, 1 band
+	int b = start_line>>4;
+	for (n=0; n<band_count[b]; n++) {
+	    count = band_strips[b][n];
+	    if (count >= end) break;
+	    if (count >= start)
+		draw_strip(count,start_line,end_line);
+	}
+    } else {
+	mask = (2<<(end_line>>4)) - (1<<(start_line>>4));
+	if (end > NB_STRIPS) end = NB_STRIPS;
+	for (count=start; count<end; count++)
+	    if (spr_strip[count].bands & mask)
+		draw_strip(count,start_line,end_line);
+    }
     debug(DBG_SPRITES,"\n");
 }
 
@@ -4805,6 +4917,7 @@ void load_neocd() {
     }
 
     memset(neogeo_vidram,0,0x20000);
+    all_strips_dirty();
 
     InitPaletteMap(RAM_PAL,0x100,0x10,0x8000);
 
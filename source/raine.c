@@ -54,6 +54,9 @@
 #include "display.h" // setup_gfx_modes
 #include "blit.h"
 #include "cpuid.h"
+#include "speed_hack.h"
+#include "video/gfxcache.h"
+#include "video/lazygfx.h"
 
 struct RAINE_CFG raine_cfg;
 UINT8 *ingame_font; 	// Raw data for ingame font
@@ -394,6 +397,9 @@ int main(int argc,char *argv[])
    raine_cfg.save_game_screen_settings	  = raine_get_config_int(	"General",      "save_game_screen_settings",            0);
 
    raine_cfg.auto_save	= raine_get_config_int( "General", "auto_save", 0);
+   auto_idle_hacks	= raine_get_config_int( "General", "auto_idle_hacks", 0);
+   use_gfx_cache	= raine_get_config_int( "General", "gfx_cache", 0);
+   lazy_gfx_size	= raine_get_config_int( "General", "lazy_gfx_size", 32);
 
    if((use_rdtsc==0)&&(raine_cfg.show_fps_mode>2)) raine_cfg.show_fps_mode=0;
 
@@ -638,6 +644,9 @@ int main(int argc,char *argv[])
 
    raine_set_config_int(	"General",      "save_game_screen_settings", raine_cfg.save_game_screen_settings);
    raine_set_config_int(   "General",      "auto_save",                 raine_cfg.auto_save);
+   raine_set_config_int(   "General",      "auto_idle_hacks",           auto_idle_hacks);
+   raine_set_config_int(   "General",      "gfx_cache",                 use_gfx_cache);
+   raine_set_config_int(   "General",      "lazy_gfx_size",             lazy_gfx_size);
 
    // DISPLAY
 
@@ -341,6 +341,8 @@ typedef struct DISPLAY_CFG
    UINT32 user_flip;			// user preferred flipping {0,1,2,3}
    UINT32 no_rotate;			// ignore default rotation in game drivers
    UINT32 no_flip;			// ignore default rotation in game drivers
+   UINT32 rotate_at_blit;		// draw unrotated, rotate the whole screen at blit time
+   UINT32 rotated_at_blit;		// rotate/flip are done by the blit, not by the drawing
   UINT32 auto_mode_change; // Mode change allowed when loading a game ?
    UINT32 bpp;							// colour depth {8,15,16,24,32}
 #ifdef SDL
@@ -351,6 +353,10 @@ typedef struct DISPLAY_CFG
 
 extern struct DISPLAY_CFG display_cfg, game_display_cfg, prev_display_cfg;
 
+// rotation and flipping to use when drawing the game
+#define DRAW_ROTATE (display_cfg.rotated_at_blit ? 0 : display_cfg.rotate)
+#define DRAW_FLIP (display_cfg.rotated_at_blit ? 0 : display_cfg.flip)
+
 extern int use_custom_screen;
 
 /*
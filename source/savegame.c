@@ -361,6 +361,8 @@ void do_save_state(char *name) {
    gzFile fout;
    char str[256],*disp_str;
 
+   wait_z80_audio_frame(); // the sound thread can be in the audio frame
+
    if(RAMSize){
      if (strstr(name,SLASH)) // The name is already a path
        strcpy(str,name);
@@ -588,6 +590,8 @@ void do_load_state(char *name) {
   gzFile fin;
   char str[256],*disp_str;
 
+  wait_z80_audio_frame(); // the sound thread can be in the audio frame
+
    if(RAMSize){
      if (strstr(name,SLASH)) // The name is already a path
        strcpy(str,name);
@@ -6,7 +6,6 @@
 #include "compat.h"
 #include "ingame.h"
 #include "profile.h"
-#include "gen_conv.h"
 #include "video/res.h"
 #include "loadpng.h"
 #include "bezel.h"
@@ -21,12 +20,15 @@
 #include "emudx.h"
 #include "blit_x2.h"
 #include "blit_sdl.h"
-#include "hq2x.h"
+#include "video/hqx.h"
+#include "video/bands.h"
+#include "yuv.h"
 #include "newspr.h" // init_video_core
 #include "video/priorities.h"
 #include "neocd/neocd.h"
 #include "sdl/opengl.h"
 #include "demos.h"
+#include "video/rotbitmap.h"
 
 SDL_Surface *sdl_game_bitmap;
 extern int disp_screen_x, disp_screen_y;
@@ -38,6 +40,12 @@ int recording_video = 0,last_video_frame,video_fps;
 
 RAINEBITMAP GameScreen;
 
+// With display_cfg.rotate_at_blit, GameBitmap is drawn unrotated and
+// DrawNormal rotates it into ScreenBitmap, which has the size in GameScreen
+static BITMAP *ScreenBitmap, *ScreenViewBitmap;
+static SDL_Surface *sdl_screen_bitmap;
+static int blit_rotate, blit_flip;
+
 static int destx, desty, xxx, yyy, xoff2, yoff2;
 
 static void my_save_png(char *full_name) {
@@ -250,8 +258,7 @@ void ReClipScreen(void)
 	 print_debug("area overlay %d %d %d %d with xxx %d yyy %d display %d %d ratio1 %g ratio2 %g\n",destx2,desty2,xxx2,yyy2,xxx,yyy,display_cfg.screen_x,display_cfg.screen_y,ratio1,ratio2);
      } else {
 	 if (display_cfg.stretch >= 1 && !display_cfg.scanlines) {
-	     if (ratio1 >= 3.0 && ratio2 >= 3.0 && (display_cfg.stretch == 1 ||
-			 display_cfg.stretch == 3)) {
+	     if (ratio1 >= 3.0 && ratio2 >= 3.0 && display_cfg.stretch != 2) {
 		 if (use_scale2x != 2) {
 		     use_scale2x = 2;
 		     return SetupScreenBitmap();
@@ -402,6 +409,15 @@ static void SetScreenBitmap(int xfull, int yfull, int xtop, int ytop, int xview,
    break;
    }
 
+   blit_rotate = blit_flip = 0;
+   display_cfg.rotated_at_blit = 0;
+   if (display_cfg.rotate_at_blit && (display_cfg.rotate || display_cfg.flip)) {
+      // the game and its gfx stay unrotated, DrawNormal rotates the screen
+      blit_rotate = display_cfg.rotate;
+      blit_flip = display_cfg.flip;
+      display_cfg.rotated_at_blit = 1;
+   }
+
    check_tile_rotation();
 
    /*
@@ -418,10 +434,28 @@ static void SetScreenBitmap(int xfull, int yfull, int xtop, int ytop, int xview,
    ReClipScreen();
 }
 
+static BITMAP *create_view_bitmap(BITMAP *src, int x, int y, int w, int h)
+{
+  // like sdl_create_sub_bitmap without touching the overlay
+  int bpp = bytes_per_pixel(src), n;
+  BITMAP *bmp = malloc( sizeof(struct BITMAP) + sizeof(char*) * h);
+  if (!bmp)
+    return NULL;
+  bmp->dat = src->dat;
+  bmp->w = w; bmp->h = h;
+  bmp->x_ofs = x;
+  bmp->y_ofs = y;
+  for (n=0; n<h; n++)
+    bmp->line[n] = src->line[n+y] + bpp*x;
+  bmp->extra = src->extra;
+  bmp->id = src->id+1; // sub bitmap
+  return bmp;
+}
+
 void SetupScreenBitmap(void)
 {
  const VIDEO_INFO *vid_info;
- int oldbpp;
+ int oldbpp,xfull,yfull;
 
  if (!current_game)
    return;
@@ -437,7 +471,17 @@ void SetupScreenBitmap(void)
     vid_info->screen_y
  );
 
- if (!GameBitmap || (GameBitmap->w != GameScreen.xfull || GameBitmap->h != GameScreen.yfull || sdl_game_bitmap->format->BitsPerPixel != display_cfg.bpp) ||
+ // size of the bitmap the game draws to
+ if (blit_rotate & 1) {
+   xfull = GameScreen.yfull;
+   yfull = GameScreen.xfull;
+ } else {
+   xfull = GameScreen.xfull;
+   yfull = GameScreen.yfull;
+ }
+
+ if (!GameBitmap || (GameBitmap->w != xfull || GameBitmap->h != yfull || sdl_game_bitmap->format->BitsPerPixel != display_cfg.bpp) ||
+     (!ScreenBitmap != !(blit_rotate || blit_flip)) ||
 	 (display_cfg.video_mode == 0 && display_cfg.bpp != 16) ||
      (sdl_overlay && display_cfg.video_mode != 1) ||
      (!sdl_overlay && display_cfg.video_mode == 1)) {
@@ -457,6 +501,37 @@ void SetupScreenBitmap(void)
      // GameBitmap = create_system_bitmap( GameScreen.xfull, GameScreen.yfull);
      GameViewBitmap = sdl_create_sub_bitmap(GameBitmap, GameScreen.xtop, GameScreen.ytop, GameScreen.xview, GameScreen.yview);
    } while (oldbpp != display_cfg.bpp);
+   if (blit_rotate || blit_flip) {
+     // what was just created is the rotated screen, now the game bitmap
+     ScreenBitmap = GameBitmap;
+     ScreenViewBitmap = GameViewBitmap;
+     sdl_screen_bitmap = sdl_game_bitmap;
+     GameViewBitmap = NULL;
+     GameBitmap = sdl_create_bitmap_ex(internal_bpp(display_cfg.bpp), xfull, yfull);
+     if (GameBitmap) {
+       sdl_game_bitmap = get_surface_from_bmp(GameBitmap);
+       if (sdl_overlay)
+	 *sdl_game_bitmap->format = *sdl_screen_bitmap->format;
+       if (blit_rotate & 1)
+	 GameViewBitmap = create_view_bitmap(GameBitmap, GameScreen.ytop, GameScreen.xtop, GameScreen.yview, GameScreen.xview);
+       else
+	 GameViewBitmap = create_view_bitmap(GameBitmap, GameScreen.xtop, GameScreen.ytop, GameScreen.xview, GameScreen.yview);
+     }
+     if (!GameViewBitmap) {
+       // no memory : the game draws rotated to the screen bitmap as usual
+       print_debug("no bitmap to rotate at blit time, the game is drawn rotated\n");
+       destroy_bitmap(GameBitmap);
+       GameBitmap = ScreenBitmap;
+       GameViewBitmap = ScreenViewBitmap;
+       sdl_game_bitmap = sdl_screen_bitmap;
+       ScreenBitmap = ScreenViewBitmap = NULL;
+       blit_rotate = blit_flip = 0;
+       display_cfg.rotated_at_blit = 0;
+       check_tile_rotation();
+       if (pbitmap)
+	 init_pbitmap();
+     }
+   }
    init_video_core(); // GameBitmap just changed -> regen all the functions
    // which depend on it !
  }
@@ -469,233 +544,115 @@ void DestroyScreenBitmap(void)
   GameBitmap = NULL;
   GameViewBitmap = NULL;
   sdl_game_bitmap = NULL;
+  destroy_bitmap(ScreenBitmap);
+  destroy_bitmap(ScreenViewBitmap);
+  ScreenBitmap = NULL;
+  ScreenViewBitmap = NULL;
+  sdl_screen_bitmap = NULL;
 }
 
 extern void *old_draw; // dlg_sound
 
-#ifndef NO_ASM
-static void raine_blit_scale2x(BITMAP *src, BITMAP *dest, int s_x, int s_y, int d_x, int d_y, int w, int h)
+/* The scalers draw the lines in bands with the render threads, each line
+   of the source with the lines above and below it, the first and the last
+   lines are repeated */
+
+typedef struct SCALE_JOB
 {
-   UINT32 ta;
+   BITMAP *src, *dest;
+   int s_x, s_y, d_x, d_y, w, h;
+} SCALE_JOB;
 
-   ta = 0;
-   if (d_y >= dest->h) return;
-   h = MIN(h,(dest->h - d_y)/2);
+#define SCALE_LINE(DEPTH,N) (((UINT##DEPTH *)j->src->line[j->s_y+(N)])+j->s_x)
+#define DEST_LINE(DEPTH,N) (((UINT##DEPTH *)j->dest->line[j->d_y+(N)])+j->d_x)
+
+static void scale2x_band(int start, int end, void *param)
+{
+   SCALE_JOB *j = (SCALE_JOB*)param;
+   int y, prev, next;
 
 #define SCALE2X(DEPTH,TYPE)							\
-   scale2x_##DEPTH##_##TYPE(							\
-			  (((UINT##DEPTH *)dest->line[d_y])+d_x),		\
-			  (((UINT##DEPTH *)dest->line[d_y+1])+d_x),		\
-			  (((UINT##DEPTH *)src->line[s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[s_y+1])+s_x),		\
-			  (UINT16) w						\
-   );										\
-										\
-   for(ta=1;ta<(UINT32)(h-1);ta++){						\
-										\
-     scale2x_##DEPTH##_##TYPE(							\
-			    (((UINT##DEPTH *)dest->line[ta*2+d_y])+d_x),	\
-			    (((UINT##DEPTH *)dest->line[ta*2+d_y+1])+d_x),	\
-			    (((UINT##DEPTH *)src->line[ta+s_y-1])+s_x),		\
-			    (((UINT##DEPTH *)src->line[ta+s_y])+s_x),		\
-			    (((UINT##DEPTH *)src->line[ta+s_y+1])+s_x),		\
-			    (UINT16) w						\
-			    );							\
-										\
-   }										\
-										\
-   ta = (h-1);									\
-										\
-   scale2x_##DEPTH##_##TYPE(							\
-			  (((UINT##DEPTH *)dest->line[ta*2+d_y])+d_x),		\
-			  (((UINT##DEPTH *)dest->line[ta*2+d_y+1])+d_x),	\
-			  (((UINT##DEPTH *)src->line[ta+s_y-1])+s_x),		\
-			  (((UINT##DEPTH *)src->line[ta+s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[ta+s_y])+s_x),		\
-			  (UINT16) w						\
-			  );
+   for (y=start; y<end; y++) {							\
+     prev = (y > 0 ? y-1 : 0);							\
+     next = (y < j->h-1 ? y+1 : y);						\
+     scale2x_##DEPTH##_##TYPE(DEST_LINE(DEPTH,y*2), DEST_LINE(DEPTH,y*2+1), \
+			    SCALE_LINE(DEPTH,prev), SCALE_LINE(DEPTH,y),	\
+			    SCALE_LINE(DEPTH,next),				\
+			    j->w);						\
+   }
 
 #ifndef NO_ASM
-#ifdef RAINE_DOS
-   es = dest->seg;
-   asm(" mov %es,_oldes\n mov _es,%es");
-#endif
    if (raine_cpu_capabilities & CPU_MMX) {
      switch (display_cfg.bpp) {
      case 8:
        SCALE2X(8,mmx); break;
      case 15:
      case 16:
-       SCALE2X(16,mmx);
-       break;
+       SCALE2X(16,mmx); break;
      case 32:
        SCALE2X(32,mmx); break;
      }
-     __asm__ __volatile__("finit\n"); // restore fpu status after mmx code
-   } else {
-#endif
-     switch (display_cfg.bpp) {
-     case 8:
-       SCALE2X(8,def); break;
-     case 15:
-     case 16:
-       SCALE2X(16,def); break;
-     case 32:
-       SCALE2X(32,def); break;
-     }
-#ifndef NO_ASM
+     scale2x_mmx_emms(); // restore fpu status after mmx code
+     return;
    }
-#ifdef RAINE_DOS
-   asm("mov _oldes,%es");
-#endif
 #endif
+   switch (display_cfg.bpp) {
+   case 8:
+     SCALE2X(8,def); break;
+   case 15:
+   case 16:
+     SCALE2X(16,def); break;
+   case 32:
+     SCALE2X(32,def); break;
+   }
 }
 
-static void raine_blit_scale3x(BITMAP *src, BITMAP *dest, int s_x, int s_y, int d_x, int d_y, int w, int h)
-{
-   UINT32 ta;
+// No mmx version for scale3x !
 
-   ta = 0;
-   if (d_y >= dest->h) return;
-   h = MIN(h,(dest->h - d_y)/2);
+static void scale3x_band(int start, int end, void *param)
+{
+   SCALE_JOB *j = (SCALE_JOB*)param;
+   int y, prev, next;
 
 #define SCALE3X(DEPTH,TYPE)							\
-   scale3x_##DEPTH##_##TYPE(							\
-			  (((UINT##DEPTH *)dest->line[d_y])+d_x),		\
-			  (((UINT##DEPTH *)dest->line[d_y+1])+d_x),		\
-			  (((UINT##DEPTH *)dest->line[d_y+2])+d_x),		\
-			  (((UINT##DEPTH *)src->line[s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[s_y+1])+s_x),		\
-			  (UINT16) w						\
-   );										\
-										\
-   for(ta=1;ta<(UINT32)(h-2);ta++){						\
-										\
-     scale3x_##DEPTH##_##TYPE(							\
-			    (((UINT##DEPTH *)dest->line[ta*3+d_y])+d_x),	\
-			    (((UINT##DEPTH *)dest->line[ta*3+d_y+1])+d_x),	\
-			    (((UINT##DEPTH *)dest->line[ta*3+d_y+2])+d_x),	\
-			    (((UINT##DEPTH *)src->line[ta+s_y-1])+s_x),		\
-			    (((UINT##DEPTH *)src->line[ta+s_y])+s_x),		\
-			    (((UINT##DEPTH *)src->line[ta+s_y+1])+s_x),		\
-			    (UINT16) w						\
-			    );							\
-										\
-   }										\
-										\
-   ta = (h-2);									\
-										\
-   scale3x_##DEPTH##_##TYPE(							\
-			  (((UINT##DEPTH *)dest->line[ta*3+d_y])+d_x),		\
-			  (((UINT##DEPTH *)dest->line[ta*3+d_y+1])+d_x),	\
-			  (((UINT##DEPTH *)dest->line[ta*3+d_y+1])+d_x),	\
-			  (((UINT##DEPTH *)src->line[ta+s_y-1])+s_x),		\
-			  (((UINT##DEPTH *)src->line[ta+s_y])+s_x),		\
-			  (((UINT##DEPTH *)src->line[ta+s_y+1])+s_x),		\
-			  (UINT16) w						\
-			  );
-
-#ifdef RAINE_DOS
-   es = dest->seg;
-   asm(" mov %es,_oldes\n mov _es,%es");
-#endif
-/*
- * No mmx version for scale3x !
-   if (raine_cpu_capabilities & CPU_MMX) {
-     switch (display_cfg.bpp) {
-     case 8:
-       SCALE3X(8,mmx); break;
-     case 15:
-     case 16:
-       SCALE3X(16,mmx);
-       break;
-     case 32:
-       SCALE3X(32,mmx); break;
-     }
-     __asm__ __volatile__("finit\n"); // restore fpu status after mmx code
-   } else {
-     */
-     switch (display_cfg.bpp) {
-     case 8:
-       SCALE3X(8,def); break;
-     case 15:
-     case 16:
-       SCALE3X(16,def); break;
-     case 32:
-       SCALE3X(32,def); break;
-     }
-/*   } */
-#ifdef RAINE_DOS
-   asm("mov _oldes,%es");
-#endif
-}
-#endif
-
-#if 0
-static void RGBtoYUV(Uint8 *rgb, int *yuv, int monochrome, int luminance)
-{
-    if (monochrome)
-    {
-#if 1 /* these are the two formulas that I found on the FourCC site... */
-        yuv[0] = 0.299*rgb[2] + 0.587*rgb[1] + 0.114*rgb[0];
-        yuv[1] = 128;
-        yuv[2] = 128;
-#else
-        yuv[0] = (0.257 * rgb[0]) + (0.504 * rgb[1]) + (0.098 * rgb[2]) + 16;
-        yuv[1] = 128;
-        yuv[2] = 128;
-#endif
-    }
-    else
-    {
-#if 1 /* these are the two formulas that I found on the FourCC site... */
-        yuv[0] = 0.299*rgb[2] + 0.587*rgb[1] + 0.114*rgb[0];
-        yuv[1] = (rgb[0]-yuv[0])*0.565 + 128;
-        yuv[2] = (rgb[2]-yuv[0])*0.713 + 128;
-#else
-        yuv[0] = (0.257 * rgb[0]) + (0.504 * rgb[1]) + (0.098 * rgb[2]) + 16;
-        yuv[1] = 128 - (0.148 * rgb[0]) - (0.291 * rgb[1]) + (0.439 * rgb[2]);
-        yuv[2] = 128 + (0.439 * rgb[0]) - (0.368 * rgb[1]) - (0.071 * rgb[2]);
-#endif
-    }
+   for (y=start; y<end; y++) {							\
+     prev = (y > 0 ? y-1 : 0);							\
+     next = (y < j->h-1 ? y+1 : y);						\
+     scale3x_##DEPTH##_##TYPE(DEST_LINE(DEPTH,y*3), DEST_LINE(DEPTH,y*3+1), \
+			    DEST_LINE(DEPTH,y*3+2), SCALE_LINE(DEPTH,prev),	\
+			    SCALE_LINE(DEPTH,y), SCALE_LINE(DEPTH,next),	\
+			    j->w);						\
+   }
 
-    if (luminance!=100)
-    {
-        yuv[0]=yuv[0]*luminance/100;
-        if (yuv[0]>255)
-            yuv[0]=255;
-    }
+   switch (display_cfg.bpp) {
+   case 8:
+     SCALE3X(8,def); break;
+   case 15:
+   case 16:
+     SCALE3X(16,def); break;
+   case 32:
+     SCALE3X(32,def); break;
+   }
 }
 
-static void ConvertRGBtoYV12(SDL_Surface *s, SDL_Overlay *o, int monochrome, int luminance, int border)
+static void raine_blit_scale(int scale, BITMAP *src, BITMAP *dest, int s_x, int s_y, int d_x, int d_y, int w, int h)
 {
-	int x,y;
-	int yuv[3];
-	Uint8 *p,*op[3];
-
-	/* Convert */
-	for(y=0; y<s->h && y<o->h; y++)
-	{
-		p=((Uint8 *) s->pixels)+s->pitch*(y+border)+border*s->format->BytesPerPixel;
-		op[0]=o->pixels[0]+o->pitches[0]*y;
-		op[1]=o->pixels[1]+o->pitches[1]*(y/2);
-		op[2]=o->pixels[2]+o->pitches[2]*(y/2);
-		for(x=0; x<s->w && x<o->w; x++)
-		{
-			RGBtoYUV(p, yuv, monochrome, luminance);
-			*(op[0]++)=yuv[0];
-			if(x%2==0 && y%2==0)
-			{
-				*(op[1]++)=yuv[2];
-				*(op[2]++)=yuv[1];
-			}
-			p+=s->format->BytesPerPixel;
-		}
-	}
+   SCALE_JOB job;
+
+   if (d_y >= dest->h) return;
+   h = MIN(h,(dest->h - d_y)/scale);
+   if (h <= 0 || w < 2) return;
+
+   job.src = src;
+   job.dest = dest;
+   job.s_x = s_x;
+   job.s_y = s_y;
+   job.d_x = d_x;
+   job.d_y = d_y;
+   job.w = w;
+   job.h = h;
+   render_bands(scale == 2 ? scale2x_band : scale3x_band, &job, 0, h);
 }
-#endif
 
 static void raine_fast_blit(BITMAP *source, BITMAP *dest, UINT32 x1, UINT32 y1, UINT32 x2, UINT32 y2, UINT32 w, UINT32 h)
 {
@@ -703,29 +660,11 @@ static void raine_fast_blit(BITMAP *source, BITMAP *dest, UINT32 x1, UINT32 y1,
   int ret;
 
   if (sdl_overlay) {
-    // convert source to yuy2 format in the overlay
-    unsigned char *src,*dest;
     SDL_LockYUVOverlay(sdl_overlay);
-#ifndef NO_ASM
-    if (sdl_overlay->format == SDL_YUY2_OVERLAY) {
-      src = GameBitmap->line[GameScreen.ytop]+x1*2;
-      dest = sdl_overlay->pixels[0]; // +y*sdl_overlay->pitches[0];
-      /* Principle : when using an overlay, the color format is forced to
-       * overlay_format in compat.c so that we are able to use the rgb565_
-       * conversion functions everywhere.
-       * Of course if you switch to normal blits after having loaded an emudx
-       * game with an overlay enabled, don't complain if the red and blue get
-       * inverted. This is an extreme case, and it would be bothersome to work
-       * around it, so just don't do that ! */
-	mmx_rgb565_yuyv(dest, src, w, sdl_overlay->h, sdl_overlay->pitches[0], sdl_game_bitmap->pitch);
-    } else if (sdl_overlay->format == SDL_YV12_OVERLAY) {
-	src = GameBitmap->line[GameScreen.ytop /* +y */ ]+x1*2;
-	mmx_rgb565_yuv420(sdl_overlay->pixels[0], // +y*sdl_overlay->pitches[0],
-	    sdl_overlay->pixels[2], // +(y/2)*sdl_overlay->pitches[2],
-	    sdl_overlay->pixels[1], // +(y/2)*sdl_overlay->pitches[1],
-	    src, w, sdl_overlay->h, sdl_overlay->pitches[0], sdl_overlay->pitches[1], sdl_game_bitmap->pitch);
-    }
-#endif
+    /* When using an overlay, the game bitmap is in overlay_format (compat.c),
+     * 16bpp : half the memory to read compared to 32bpp. It's converted
+     * straight to the planes of the overlay. */
+    yuv_convert(sdl_game_bitmap, x1, GameScreen.ytop, w, sdl_overlay->h, sdl_overlay);
     SDL_UnlockYUVOverlay(sdl_overlay);
 
     SDL_DisplayYUVOverlay(sdl_overlay,&area_overlay);
@@ -750,16 +689,11 @@ static void raine_fast_blit(BITMAP *source, BITMAP *dest, UINT32 x1, UINT32 y1,
 
     if (display_cfg.stretch && use_scale2x) {
       // use_scale2x gives the factor : 1 = 2x, 2 = 3x, etc...
-#ifndef NO_ASM
       switch(display_cfg.stretch) {
 	case 1: // scale2x/3x
 	  locked = lock_surface(sdl_screen);
 	  if (locked > -1) {
-	    if (use_scale2x == 1) {
-	      raine_blit_scale2x(source, screen, x1, y1, x2, y2, w, h);
-	    } else if (use_scale2x == 2) {
-	      raine_blit_scale3x(source, screen, x1, y1, x2, y2, w, h);
-	    }
+	    raine_blit_scale(use_scale2x+1, source, screen, x1, y1, x2, y2, w, h);
 	    if (locked) SDL_UnlockSurface(sdl_screen);
 	  }
 	  break;
@@ -771,28 +705,22 @@ static void raine_fast_blit(BITMAP *source, BITMAP *dest, UINT32 x1, UINT32 y1,
 	  }
 	  break;
 	case 3: // hq2x,3x
-	  if (display_cfg.bpp == 8)
-	    display_cfg.stretch = 1; // hq2x doesn't work in 8bpp, use scale2x
+	case 4: // xbr
 	  locked = lock_surface(sdl_screen);
 	  if (locked > -1) {
-	    if (use_scale2x == 1)
-		switch(sdl_screen->format->BitsPerPixel) {
-		case 16: hq2x_16(source,screen,x1,y1,x2,y2,w,h); break;
-		case 32: hq2x_32(source,screen,x1,y1,x2,y2,w,h); break;
-			 // Notice : in 32bpp, this thing needs a 16bpp source, so we must
-			 // setup a special format for it in compat.c
-		}
-	    else if (use_scale2x == 2)
-		switch(sdl_screen->format->BitsPerPixel) {
-		case 16: hq3x_16(source,screen,x1,y1,x2,y2,w,h); break;
-		case 32: hq3x_32(source,screen,x1,y1,x2,y2,w,h); break;
-		}
-	    __asm__ __volatile__("finit\n"); // restore fpu status after mmx code
+	    SDL_PixelFormat *fmt = sdl_screen->format;
+	    if (display_cfg.bpp == 8) // they don't work in 8bpp, use scale2x
+	      raine_blit_scale(use_scale2x+1, source, screen, x1, y1, x2, y2, w, h);
+	    else {
+	      // the game bitmap has the format of the screen
+	      hqx_format(fmt->BitsPerPixel, fmt->Rmask, fmt->Gmask, fmt->Bmask);
+	      hqx_blit(display_cfg.stretch == 4 ? HQX_XBR : HQX_HQ, use_scale2x+1,
+		  source, screen, x1, y1, x2, y2, w, h);
+	    }
 	    if (locked) SDL_UnlockSurface(sdl_screen);
 	  }
 	  break;
       }
-#endif
     } else {
       area1.x = x1;
       area1.y = y1;
@@ -865,7 +793,7 @@ static void update_screen_palette(PALETTE palette)
 #endif
 }
 
-void DrawNormal(void)
+static void draw_normal(void)
 {
   int i,locked;
   SDL_Rect s1,s2;
@@ -1028,6 +956,38 @@ void DrawNormal(void)
    RefreshBuffers = 0;
 }
 
+static void swap_screen_bitmaps(void)
+{
+  BITMAP *bmp;
+  SDL_Surface *surf;
+
+  bmp = GameBitmap; GameBitmap = ScreenBitmap; ScreenBitmap = bmp;
+  bmp = GameViewBitmap; GameViewBitmap = ScreenViewBitmap; ScreenViewBitmap = bmp;
+  surf = sdl_game_bitmap; sdl_game_bitmap = sdl_screen_bitmap; sdl_screen_bitmap = surf;
+}
+
+void DrawNormal(void)
+{
+  if (!ScreenBitmap) {
+    draw_normal();
+    return;
+  }
+  if (old_draw) return;
+
+  /*
+
+  rotate the game screen, everything after that (interface, screenshots,
+  blits) sees the rotated screen in GameBitmap
+
+  */
+
+  rotate_bitmap(GameBitmap, ScreenBitmap, blit_rotate, blit_flip,
+    GameScreen.xtop, GameScreen.ytop, GameScreen.xview, GameScreen.yview);
+  swap_screen_bitmaps();
+  draw_normal();
+  swap_screen_bitmaps();
+}
+
 void clear_game_screen(int pen)
 {
   int x,y,len;
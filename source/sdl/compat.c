@@ -3,7 +3,6 @@
 #include <SDL.h>
 #include "raine.h"
 #include <sys/stat.h>
-#include "cpuid.h"
 #include "video/tilemod.h" // internal_bpp
 #include "blit.h" // ReClipScreen
 #include <SDL_ttf.h>
@@ -27,15 +26,6 @@ static SDL_PixelFormat overlay_format = {
   0, 5, 11, 0,
   0x1f, 0x7e0, 0xf800, 0 };
 
-// Just to be bothersome, they chose the other format for 16bpp !!!
-static SDL_PixelFormat hq2x_format = {
-  NULL,
-  16,
-  2,
-  3, 2, 3, 0,
-  11, 5, 0, 0,
-  0xf800, 0x7e0, 0x1f, 0 };
-
 struct BITMAP *sdl_create_bitmap_ex(int bpp, int w, int h) {
   // Init a fake bitmap to point to a newly created sdl_surface
   int r=0,g=0,b=0,a=0; // masks if necessary...
@@ -44,10 +34,8 @@ struct BITMAP *sdl_create_bitmap_ex(int bpp, int w, int h) {
   if (bpp > 8) {
     const SDL_VideoInfo *inf = SDL_GetVideoInfo();
     SDL_PixelFormat *fmt = inf->vfmt;
-    if (sdl_overlay) {
+    if (sdl_overlay)
       fmt = &overlay_format;
-    } else if (display_cfg.stretch == 3 && display_cfg.video_mode == 2) // hq2x
-      fmt = &hq2x_format;
 
     if (fmt->BitsPerPixel != bpp) {
       /* SDL interprets each pixel as a 32-bit number, so our masks must depend
@@ -252,10 +240,6 @@ void sdl_create_overlay( int w, int h) {
     sdl_overlay = NULL;
   }
 
-  if (!(raine_cpu_capabilities & CPU_MMX)) {
-    print_debug("no MMX support -> no overlay\n");
-    return;
-  }
   if (sdl_screen->format->BitsPerPixel == 8) {
       print_debug("no overlay in 8bpp\n");
     return;
@@ -266,8 +250,8 @@ void sdl_create_overlay( int w, int h) {
 	w,h,(prefered_yuv_format == 0 ? SDL_YUY2_OVERLAY : SDL_YV12_OVERLAY),
 	sdl_screen);
     if (sdl_overlay && !sdl_overlay->hw_overlay) {
-      // Try YUY2 1st, because my rgb -> yuv function seems more efficient
-      // with this one. Then try yv12 because it's the most common yuv format
+      // Try the prefered format 1st, then the other one. yv12 is the most
+      // common yuv format
       // especially with mpeg cards like the wintv pvr 350
       SDL_FreeYUVOverlay(sdl_overlay);
       sdl_overlay = SDL_CreateYUVOverlay( // these bitmaps are ALWAYS in ram
@@ -386,11 +370,8 @@ struct BITMAP *sdl_create_sub_bitmap(struct BITMAP *src, int x, int y, int w, in
      * screen to speed up blits */
     if (current_game->video->flags & VIDEO_NEEDS_8BPP)
       display_cfg.bpp = 8;
-    else {
+    else
       display_cfg.bpp = sdl_screen->format->BitsPerPixel;
-      if (display_cfg.stretch == 3) // hq2x is in 16bpp source only
-	display_cfg.bpp = 16;
-    }
     /*
        if (sdl_screen->flags & SDL_OPENGL)
        display_cfg.bpp = 16;
@@ -401,8 +382,8 @@ struct BITMAP *sdl_create_sub_bitmap(struct BITMAP *src, int x, int y, int w, in
       ResetPalette();
     }
   } else if ((sdl_overlay /* || sdl_screen->flags & SDL_OPENGL */) && bpp != 2) {
-    // Overlays are for 16bpp only (the mmx code knows only how to handle
-    // 16bpp)
+    // Overlays use a 16bpp game bitmap (overlay_format), it's the quickest
+    // to convert to yuv
     display_cfg.bpp = 16;
     if (current_colour_mapper) {
       set_colour_mapper(current_colour_mapper);
@@ -414,7 +395,6 @@ struct BITMAP *sdl_create_sub_bitmap(struct BITMAP *src, int x, int y, int w, in
     color_format = &overlay_format;
     *get_surface_from_bmp(GameBitmap)->format = overlay_format;
   }
-  InitLUTs();
   switch(display_cfg.bpp) {
     case 8: my_blit_x2_y1 = raine_blit_x2_y1;
       my_blit_x2_y2 = raine_blit_x2_y2;
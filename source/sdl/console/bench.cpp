@@ -0,0 +1,151 @@
+#include "raine.h"
+#include "games.h"
+#include "console.h"
+#include "parser.h"
+#include "cpumain.h"
+#include "starhelp.h"
+#include "demos.h"
+#include "profile.h"
+#include "bench.h"
+#ifdef HAS_CZ80
+#include "mz80help.h"
+#endif
+#ifdef HAVE_6502
+// m6502.h and m6502hlp.h define variables, they can't be included here
+extern "C" UINT32 m6502GetElapsedTicks(UINT32); // 6502 core
+extern "C" int M6502Engine; // m6502hlp.c
+#endif
+
+/* Emulation speed measurement : runs the cpus of the current game for a
+ * number of frames, without video or sound, and reports the 68000 cycles
+ * executed per second (and the z80 cycles with cz80, and the 6502 cycles).
+ * Load a demo first (inputs are then replayed) to get results which can be
+ * compared between 2 builds (starscream / C68000, cz80 switch / threaded
+ * dispatch, make6502 / c6502) or between 2 interleaves. */
+
+#ifdef HAS_C68000
+#define CORE_68000 "c68000"
+#else
+#define CORE_68000 "starscream"
+#endif
+
+#ifdef HAS_C6502
+#define CORE_6502 "c6502"
+#else
+#define CORE_6502 "make6502"
+#endif
+
+static UINT32 read_68000_odometers() {
+  UINT32 total = 0;
+  int n;
+  for (n=0; n<StarScreamEngine; n++) {
+    if ((UINT32)n == current_cpu_num[CPU_68K_0>>4])
+      total += s68000readOdometer();
+    else
+      total += M68000_context[n].odometer;
+  }
+  return total;
+}
+
+#ifdef HAS_CZ80
+static UINT32 read_z80_ticks() {
+  UINT32 total = 0;
+  int n;
+  for (n=0; n<MZ80Engine; n++)
+    total += Z80_context[n].dwElapsedTicks;
+  return total;
+}
+#endif
+
+static void run_bench(int frames) {
+  int n;
+  UINT64 cycles = 0;
+  UINT32 last = read_68000_odometers(), odo;
+#ifdef HAS_CZ80
+  UINT64 z80_cycles = 0;
+  UINT32 z80_last = read_z80_ticks(), ticks;
+#endif
+#ifdef HAVE_6502
+  // the elapsed ticks are shared by all the 6502s, and only cleared here
+  m6502GetElapsedTicks(1);
+#endif
+  double start = timer_get_time();
+  for (n=0; n<frames; n++) {
+    if (reading_demo)
+      write_demo_inputs();
+    current_game->exec();
+    cpu_frame_count++;
+    odo = read_68000_odometers();
+    if (odo >= last) // some drivers reset the odometer themselves
+      cycles += odo - last;
+    else
+      cycles += odo;
+    last = odo;
+#ifdef HAS_CZ80
+    ticks = read_z80_ticks();
+    if (ticks >= z80_last) // mz80ClearTimers resets them
+      z80_cycles += ticks - z80_last;
+    else
+      z80_cycles += ticks;
+    z80_last = ticks;
+#endif
+  }
+  double elapsed = timer_get_time() - start;
+#ifdef HAVE_6502
+  UINT32 m6502_cycles = m6502GetElapsedTicks(1);
+#endif
+
+  if (elapsed <= 0)
+    throw "timer resolution too low, try more frames";
+  cons->print("%d frames in %g s : %g fps%s", frames, elapsed, frames/elapsed,
+	  (reading_demo ? " (demo)" : ""));
+  if (StarScreamEngine)
+    cons->print("68000 (%s) : %g Mcycles/s", CORE_68000, cycles/elapsed/1e6);
+#ifdef HAS_CZ80
+  if (MZ80Engine)
+    cons->print("z80 (cz80) : %g Mcycles/s", z80_cycles/elapsed/1e6);
+#endif
+#ifdef HAVE_6502
+  if (M6502Engine)
+    cons->print("6502 (%s) : %g Mcycles/s", CORE_6502, m6502_cycles/elapsed/1e6);
+#endif
+}
+
+/* bench frames interleave1 interleave2... runs the bench once for each
+ * interleave (slices per frame of cpu_execute_interleaved) to see what a
+ * tighter synchronisation costs for the current game. */
+
+void do_bench(int argc, char **argv) {
+  int frames = 600, n;
+  if (argc > 1)
+    frames = parse(argv[1]);
+  if (frames <= 0)
+    throw "syntax : bench [frames] [interleave...]";
+  if (!current_game || !current_game->exec)
+    throw "no game loaded";
+  for (n=2; n<argc; n++)
+    if (parse(argv[n]) < 1)
+      throw "interleave must be at least 1";
+
+  int old_pause = raine_cfg.req_pause_game;
+  int old_interleave = cpu_interleave;
+  raine_cfg.req_pause_game = 0;
+  set_regs();
+  try {
+    if (argc <= 2)
+      run_bench(frames);
+    for (n=2; n<argc; n++) {
+      cpu_interleave = parse(argv[n]);
+      cons->print("interleave %d :", cpu_interleave);
+      run_bench(frames);
+    }
+  } catch (...) {
+    cpu_interleave = old_interleave;
+    get_regs();
+    raine_cfg.req_pause_game = old_pause;
+    throw;
+  }
+  cpu_interleave = old_interleave;
+  get_regs();
+  raine_cfg.req_pause_game = old_pause;
+}
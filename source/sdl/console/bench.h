@@ -0,0 +1,9 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void do_bench(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
@@ -9,6 +9,7 @@
 #include "68000/starcpu.h"
 #include "sdl/gui.h"
 #include "console/exec.h"
+#include "console/bench.h"
 #include "conf-cpu.h"
 #include "cpumain.h"
 #include "z80/mz80help.h"
@@ -588,6 +589,8 @@ static void do_poke(int argc, char **argv) {
   } else if (!strcasecmp(argv[0],"lpoke")) {
     WriteLongSc(&ptr[adr],val);
   }
+  if ((cpu_id >> 4) == 1) // the 68000 core can have translated this code
+      flush_68000_code();
   cons->print("ok");
 }
 
@@ -1227,6 +1230,7 @@ commands_t commands[] =
   { "break", &do_break, "break [adr]|break del nb : without parameter, lists breakpoints. With adr, set breakpoint at adr\nPass del and the breakpoint number to delete a breakpoint", },
   { "until", &do_until, "(u)ntil pc : executes cycles until pc reaches value given in parameter. Can be interrupted with ESC or Ctrl-C" },
   { "u", &do_until },
+  { "bench", &do_bench, "bench [frames] [interleave...] : run the emulation for some frames (600 by default) without video or sound and show its speed", "If a demo is being played, its inputs are used, which gives reproducible results to compare different cpu cores.\nWhen interleaves are given, the bench is run once for each of them (number of slices per frame for the drivers using cpu_execute_interleaved), the default interleave of the game can be changed in the <game>:cpu section of games.cfg.\n" },
   { "loaded", &do_loaded, "loaded [type] offset : neocd only, returns what is loaded at this offset", "type is 0 (PRG) if ommited\n"
       "Oterwise it can be :\n"
 "PRG 0\n"
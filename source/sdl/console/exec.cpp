@@ -63,6 +63,7 @@ void do_break(int argc, char **argv) {
     int adr = breakp[nb].adr;
     UINT8 *ptr = get_userdata(cpu_id,adr);
     WriteWord(&ptr[adr],breakp[nb].old); // restore
+    flush_68000_code();
     if (breakp[nb].cond)
       free(breakp[nb].cond);
     if (nb < used_break-1)
@@ -90,6 +91,7 @@ void do_break(int argc, char **argv) {
     breakp[used_break].old = ReadWord(&ptr[adr]);
     breakp[used_break].cond = NULL;
     WriteWord(&ptr[adr],0x4e70); // reset
+    flush_68000_code();
     breakp[used_break++].adr = adr;
     if (s68000context.resethandler != &exec_break) {
       resethandler = s68000context.resethandler;
@@ -129,6 +131,7 @@ int check_breakpoint() {
 	if (pc == breakp[n].adr || pc == breakp[n].adr+2) {
 	    UINT8 *ptr = get_userdata(cpu_id,breakp[n].adr);
 	    WriteWord(&ptr[breakp[n].adr],breakp[n].old);
+	    flush_68000_code();
 	    if (pc == breakp[n].adr+2) {
 		pc = breakp[n].adr;
 		set_regs(cpu_id);
@@ -197,6 +200,7 @@ void restore_breakpoints() {
       // 2 : restore it
       UINT32 adr = breakp[n].adr;
       WriteWord(&ptr[adr],0x4e70); // reset
+      flush_68000_code();
       printf("breakpoint restored, pc = %x\n",int(pc));
     }
   }
@@ -8,6 +8,7 @@
 #include "games.h"
 #include "sdl/dialogs/sound_commands.h"
 #include "sound/assoc.h"
+#include "timer.h" // sound_thread
 
 static TMenu *menu;
 
@@ -28,6 +29,7 @@ menu_item_t sound_menu[] =
   // 3 values is now considered to be an interval (start, end, step).
   { _("Sample rate"), NULL, &audio_sample_rate, 3, { 11025, 22050, 44100 },
       { "11025", "22050","44100" }} ,
+  { _("Audio cpu in its own thread"), NULL, &sound_thread, 2, { 0, 1 }, { _("No"), _("Yes") } },
 #if HAS_ES5506
   { _("ES5506 voice filters"), NULL, &es5506_voice_filters, 2, { 0, 1 }, { _("No"), _("Yes") } },
 #endif
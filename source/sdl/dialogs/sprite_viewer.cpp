@@ -47,6 +47,7 @@ static int draw_sprites(int sel) {
   get_sprite_layer_info(w,h,count,mask,gfx);
   int x = 0, y = 0;
   int n;
+  int packed = TILE_TYPE_PACKED(tile_list[layer].type); // GFX_PACKED region
   for (n=0; n<16; n++)
     map[n] = n; // direct mapping
   n = start_sprite;
@@ -59,7 +60,10 @@ static int draw_sprites(int sel) {
     // printf("%d,%d,%x\n",x,y,n);
     tabsprite[no_sprite++] = n;
     if (w == 16 && h == 16) {
-      Draw16x16_Trans_Mapped_8(&gfx[n<<8],x,y,map);
+      if (packed)
+	Draw16x16_Trans_Packed_Mapped_8(&gfx[n<<7],x,y,map);
+      else
+	Draw16x16_Trans_Mapped_8(&gfx[n<<8],x,y,map);
       x += 16;
       if (x+w > GameBitmap->w) {
 	x = 0;
@@ -67,7 +71,7 @@ static int draw_sprites(int sel) {
 	if (y+h > GameBitmap->h) break;
       }
     } else if (w == 8 && h == 8) {
-	if (is_neocd()) {
+	if (is_neocd() || packed) {
 	    // layer 0 is packed in neocd and apparently there is no way to store
 	    // this info in tile_list... maybe one day, but until then...
 	    Draw8x8_Trans_Packed_Mapped_8(&gfx[n<<5],x,y,map);
@@ -80,7 +84,10 @@ static int draw_sprites(int sel) {
 	if (y+h > GameBitmap->h) break;
       }
     } else if (w == 32 && h == 32) {
-      Draw32x32_Trans_Mapped_8(&gfx[n<<10],x,y,map);
+      if (packed)
+	Draw32x32_Trans_Packed_Mapped_8(&gfx[n<<9],x,y,map);
+      else
+	Draw32x32_Trans_Mapped_8(&gfx[n<<10],x,y,map);
       x += 32;
       if (x+w > GameBitmap->w) {
 	x = 0;
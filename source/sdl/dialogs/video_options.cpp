@@ -14,12 +14,15 @@
 #include "sdl/control_internal.h"
 #include "display.h"
 #include "sdl/display_sdl.h"
+#include "sdl/yuv.h"
 #ifdef MessageBox
 #undef MessageBox
 #endif
 #include "sdl/dialogs/messagebox.h"
 #include "sdl/dialogs/fsel.h"
 #include "bld.h"
+#include "video/bands.h"
+#include "video/pipeline.h"
 #include "files.h"
 
 class TVideo : public TMenu
@@ -62,6 +65,9 @@ static int update_scaler(int sel) {
 static menu_item_t overlays_options[] =
 {
     { _("Prefered YUV format"), NULL, &prefered_yuv_format, 2, { 0, 1 }, { _("YUY2"), _("YV12 (mpeg)") } },
+    { _("Monochrome"), NULL, &yuv_monochrome, 2, { 0, 1 }, { _("No"), _("Yes") } },
+    { _("Luminance % (100 default)"), NULL, &yuv_luminance, ITEM_INTEDIT,
+	{ 3, 0, 50, 0, 200},{""} },
     { _("Fix aspect ratio to 4:3"), NULL, (int*)&display_cfg.fix_aspect_ratio, 2, {0,1}, {_("No"), _("Yes") } },
 #ifdef DARWIN
     { _("Overlays workarounds"), NULL, &overlays_workarounds, 2, { 0, 1}, {_("No"),_("Yes")}},
@@ -74,8 +80,8 @@ static menu_item_t blits_options[] =
 {
     { _("Change video mode"), NULL, (int*)&display_cfg.auto_mode_change, 3, {0, 1, 2},
 	{ _("Never"), _("To match game resolution (low res most of the time)"), _("To match 2x game resolution") } },
-    { _("Scaler"), &update_scaler, (int*)&display_cfg.stretch, 4, { 0, 1, 2, 3 },
-	{ _("None"), _("Scale2x/3x"), _("Pixel double"), _("hq2x/3x") } },
+    { _("Scaler"), &update_scaler, (int*)&display_cfg.stretch, 5, { 0, 1, 2, 3, 4 },
+	{ _("None"), _("Scale2x/3x"), _("Pixel double"), _("hq2x/3x"), _("xBR 2x/3x") } },
     { _("Scanlines"), &update_scaler, (int*)&display_cfg.scanlines, 4, { 0, 1, 2, 3 },
 	{ _("Off"), _("Halfheight"), _("Fullheight"), _("Fullheight + Double width") } },
     {  NULL },
@@ -220,12 +226,14 @@ static menu_item_t video_items[] =
   { _("None"), "90", "180", "270" } },
 { _("Flip screen"), NULL, (int*)&display_cfg.user_flip, 4, {0, 1, 2, 3 },
   { _("None"), _("Flip X"), _("Flip Y"), _("Flip XY") } },
+{ _("Rotate the screen when blitting"), NULL, (int*)&display_cfg.rotate_at_blit, 2, {0, 1}, {_("No"), _("Yes")} },
+{ _("Render threads (line based layers)"), NULL, &render_threads, 4, {1, 2, 4, 8}, {"1", "2", "4", "8"} },
+{ _("Draw while emulating the next frame"), NULL, &render_pipeline, 2, {0, 1}, {_("No"), _("Yes")} },
 { _("Save per game screen settings"), NULL, (int*)&raine_cfg.save_game_screen_settings, 2, {0, 1}, _("No"),_("Yes")},
 {  NULL },
 };
 
 int do_video_options(int sel) {
-    int old_stretch = display_cfg.stretch;
 #ifdef RAINE_WIN32
     UINT32 old_driver = display_cfg.video_driver;
 #endif
@@ -251,11 +259,6 @@ int do_video_options(int sel) {
 	// explicitely clear scanlines when overlays are enabled
 	display_cfg.scanlines = 0;
     }
-    if (old_stretch != display_cfg.stretch && display_cfg.stretch == 3 &&
-	    sdl_game_bitmap) {
-	DestroyScreenBitmap(); // init hq2x/3x, switch gamebitmap to 16bpp
-	// + recall InitLUTs by recreating game_bitmap when enabling hq2x/3x
-    }
     return 0; // (oldx != display_cfg.screen_x || oldy != display_cfg.screen_y);
 }
 
@@ -11,6 +11,8 @@
 #include "palette.h"
 #include "compat.h"
 #include "video/res.h"
+#include "video/bands.h"
+#include "video/pipeline.h"
 #ifdef RAINE_UNIX
 #include <unistd.h>
 #endif
@@ -19,6 +21,7 @@
 #include "winpos.h"
 #include "sdl/opengl.h"
 #include "sdl/display_sdl.h"
+#include "sdl/yuv.h"
 #include "bld.h"
 
 togl_options ogl;
@@ -119,12 +122,17 @@ void display_read_config() {
    display_cfg.user_flip = raine_get_config_int( "Display", "flip", 0);
    display_cfg.no_rotate = raine_get_config_int( "Display", "no_rotate", 0);
    display_cfg.no_flip = raine_get_config_int( "Display", "no_flip", 0);
+   display_cfg.rotate_at_blit = raine_get_config_int( "Display", "rotate_at_blit", 0);
    display_cfg.auto_mode_change = raine_get_config_int( "Display", "auto_mode_change", 0);
+   render_threads = raine_get_config_int( "Display", "render_threads", 1);
+   render_pipeline = raine_get_config_int( "Display", "render_pipeline", 0);
    display_cfg.fix_aspect_ratio = raine_get_config_int("display", "fix_aspect_ratio", 1);
    display_cfg.fullscreen = raine_get_config_int("display", "fullscreen", 0);
    display_cfg.double_buffer = raine_get_config_int("display", "double_buffer", 1);
    use_bld = raine_get_config_int("display","use_bld",1);
    prefered_yuv_format = raine_get_config_int("display","prefered_yuv_format",0);
+   yuv_monochrome = raine_get_config_int("display","yuv_monochrome",0);
+   yuv_luminance = raine_get_config_int("display","yuv_luminance",100);
 #ifdef DARWIN
    overlays_workarounds = raine_get_config_int("display","overlays_workarounds",1);
 #endif
@@ -170,9 +178,14 @@ void display_write_config() {
    raine_set_config_int("Display", "flip", display_cfg.user_flip);
    raine_set_config_int("Display", "no_rotate", display_cfg.no_rotate);
    raine_set_config_int("Display", "no_flip", display_cfg.no_flip);
+   raine_set_config_int("Display", "rotate_at_blit", display_cfg.rotate_at_blit);
    raine_set_config_int("Display", "auto_mode_change", display_cfg.auto_mode_change);
+   raine_set_config_int("Display", "render_threads", render_threads);
+   raine_set_config_int("Display", "render_pipeline", render_pipeline);
    raine_set_config_int("display", "fix_aspect_ratio", display_cfg.fix_aspect_ratio);
    raine_set_config_int("display", "prefered_yuv_format", prefered_yuv_format);
+   raine_set_config_int("display", "yuv_monochrome", yuv_monochrome);
+   raine_set_config_int("display", "yuv_luminance", yuv_luminance);
    raine_set_config_int("display", "ogl_dbuf", ogl.dbuf);
    raine_set_config_int("display", "ogl_render", ogl.render);
    raine_set_config_int("display", "ogl_overlay", ogl.overlay);
@@ -132,6 +132,10 @@ void saUpdateSound( int nowclock )
      //int i;
      // This part is called for each frame, which *should* be 60
   // times/sec, but it can be less (if the game slows down)
+     if (streams_updated) { // already done by the sound thread (timer.c)
+       streams_updated = 0;
+       return;
+     }
       streams_sh_update();
    }
 }
@@ -494,6 +498,7 @@ void saDestroySound( int remove_all_resources )
 
 void sa_pause_sound(void)
 {
+   wait_z80_audio_frame();
    if (!pause_sound) {
      pause_sound	    = 1;
 
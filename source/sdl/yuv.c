@@ -0,0 +1,350 @@
+/******************************************************************************/
+/*                                                                            */
+/*                      RGB -> YUV CONVERSION FOR THE OVERLAYS                */
+/*                                                                            */
+/******************************************************************************/
+
+/*
+
+The game bitmap is converted straight to the planes of the overlay, in 1
+pass. The formulas are the ones of the mmx converters of zapping which were
+used before : bt601 with y in 16-235, the chroma of each pair
+of pixels (YUY2) or of each 2x2 block (YV12) is taken from their average.
+
+With sse2 the components go in 16 bits lanes, 16 pixels at a time, plain c
+does the rest of the lines and the cpus without sse2. The lines are split in
+bands converted by the render threads.
+
+*/
+
+#include "raine.h"
+#include "SDL.h"
+#include "yuv.h"
+#include "video/bands.h"
+#include "cpuid.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9) || defined(__clang__))
+#define RAINE_SIMD_YUV 1
+#include <emmintrin.h>
+#define SIMD __attribute__((target("sse2")))
+#endif
+
+int yuv_monochrome, yuv_luminance = 100;
+
+typedef struct YUV_JOB
+{
+   UINT8 *src;
+   int pitch,bpp;		// bpp in bytes
+   int shift[3],loss[3];	// r,g,b
+   int w,h;
+   int yuy2;
+   UINT8 *plane[3];		// y,u,v
+   int pitches[3];
+   int monochrome;
+   int lum;			// factor of the luminance, 9 bits of fraction
+   int sse2;
+} YUV_JOB;
+
+/******************************************************************************/
+/*                                                                            */
+/*                                   PLAIN C                                  */
+/*                                                                            */
+/******************************************************************************/
+
+// components on 8 bits, the high bits are repeated in the lost ones
+static inline void get_rgb(const YUV_JOB *j, const UINT8 *src, int x, int *c)
+{
+   UINT32 p = (j->bpp == 2 ? ((UINT16*)src)[x] : ((UINT32*)src)[x]);
+   int n;
+
+   for (n=0; n<3; n++) {
+      int v = (p >> j->shift[n]) & (0xff >> j->loss[n]);
+      c[n] = (v << j->loss[n]) | (v >> (8 - 2*j->loss[n]));
+   }
+}
+
+static inline UINT8 luma(const YUV_JOB *j, const int *c)
+{
+   int y = ((66*c[0] + 129*c[1] + 25*c[2] + 128) >> 8) + 16;
+
+   if (j->lum != 512) {
+      y = (y * j->lum) >> 9;
+      if (y > 255)
+	 y = 255;
+   }
+   return y;
+}
+
+static inline void chroma(const YUV_JOB *j, const int *c, UINT8 *u, UINT8 *v)
+{
+   if (j->monochrome) {
+      *u = *v = 128;
+      return;
+   }
+   *u = ((-38*c[0] - 74*c[1] + 112*c[2] + 128) >> 8) + 128;
+   *v = ((112*c[0] - 94*c[1] - 18*c[2] + 128) >> 8) + 128;
+}
+
+static void yuy2_row(const YUV_JOB *j, const UINT8 *src, UINT8 *dst, int x)
+{
+   int a[3],b[3],c[3],n;
+
+   for (; x<j->w; x+=2) {
+      get_rgb(j,src,x,a);
+      get_rgb(j,src,x+1,b);
+      for (n=0; n<3; n++)
+	 c[n] = (a[n] + b[n] + 1) >> 1;
+      dst[x*2] = luma(j,a);
+      dst[x*2+2] = luma(j,b);
+      chroma(j,c,&dst[x*2+1],&dst[x*2+3]);
+   }
+}
+
+// 2 lines of the source for 2 lines of y and 1 of u and v
+static void yv12_rows(const YUV_JOB *j, const UINT8 *s0, const UINT8 *s1,
+		      UINT8 *y0, UINT8 *y1, UINT8 *u, UINT8 *v, int x)
+{
+   int a0[3],b0[3],a1[3],b1[3],c[3],n;
+
+   for (; x<j->w; x+=2) {
+      get_rgb(j,s0,x,a0);
+      get_rgb(j,s0,x+1,b0);
+      get_rgb(j,s1,x,a1);
+      get_rgb(j,s1,x+1,b1);
+      for (n=0; n<3; n++)
+	 c[n] = (a0[n] + b0[n] + a1[n] + b1[n] + 2) >> 2;
+      y0[x] = luma(j,a0);
+      y0[x+1] = luma(j,b0);
+      y1[x] = luma(j,a1);
+      y1[x+1] = luma(j,b1);
+      chroma(j,c,&u[x/2],&v[x/2]);
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/*                                    SSE2                                    */
+/*                                                                            */
+/******************************************************************************/
+
+#ifdef RAINE_SIMD_YUV
+
+typedef struct YUV_SSE2
+{
+   __m128i sh[3];		// shifts
+   __m128i lo[3],hi[3];		// loss and 8 - 2*loss
+   __m128i mask[3];
+   __m128i lum;
+} YUV_SSE2;
+
+SIMD static void get_sse2(const YUV_JOB *j, YUV_SSE2 *m)
+{
+   int n;
+
+   for (n=0; n<3; n++) {
+      m->sh[n] = _mm_cvtsi32_si128(j->shift[n]);
+      m->lo[n] = _mm_cvtsi32_si128(j->loss[n]);
+      m->hi[n] = _mm_cvtsi32_si128(8 - 2*j->loss[n]);
+      m->mask[n] = _mm_set1_epi16(0xff >> j->loss[n]);
+   }
+   m->lum = _mm_set1_epi16((short)j->lum);
+}
+
+// 8 pixels -> their r,g,b in 16 bits lanes, like get_rgb
+SIMD static inline void load_8(const YUV_JOB *j, const YUV_SSE2 *m, const UINT8 *src, __m128i *c)
+{
+   int n;
+
+   if (j->bpp == 2) {
+      __m128i p = _mm_loadu_si128((const __m128i*)src);
+      for (n=0; n<3; n++) {
+	 __m128i v = _mm_and_si128(_mm_srl_epi16(p, m->sh[n]), m->mask[n]);
+	 c[n] = _mm_or_si128(_mm_sll_epi16(v, m->lo[n]), _mm_srl_epi16(v, m->hi[n]));
+      }
+   } else {
+      const __m128i ff = _mm_set1_epi32(0xff);
+      __m128i p0 = _mm_loadu_si128((const __m128i*)src);
+      __m128i p1 = _mm_loadu_si128((const __m128i*)(src + 16));
+      for (n=0; n<3; n++)
+	 c[n] = _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(p0, m->sh[n]), ff),
+				_mm_and_si128(_mm_srl_epi32(p1, m->sh[n]), ff));
+   }
+}
+
+// the sums fit in 16 bits without sign, the srli gives the same as luma
+SIMD static inline __m128i luma_8(const YUV_JOB *j, const YUV_SSE2 *m, const __m128i *c)
+{
+   __m128i y = _mm_add_epi16(_mm_mullo_epi16(c[0], _mm_set1_epi16(66)),
+			     _mm_mullo_epi16(c[1], _mm_set1_epi16(129)));
+   y = _mm_add_epi16(y, _mm_mullo_epi16(c[2], _mm_set1_epi16(25)));
+   y = _mm_add_epi16(_mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8),
+		     _mm_set1_epi16(16));
+   if (j->lum != 512) // (y << 7) * lum >> 16 = y * lum >> 9
+      y = _mm_mulhi_epu16(_mm_slli_epi16(y, 7), m->lum);
+   return y;
+}
+
+SIMD static inline __m128i chroma_8(const __m128i *c, short kr, short kg, short kb)
+{
+   const __m128i h = _mm_set1_epi16(128);
+   __m128i s = _mm_add_epi16(_mm_mullo_epi16(c[0], _mm_set1_epi16(kr)),
+			     _mm_mullo_epi16(c[1], _mm_set1_epi16(kg)));
+   s = _mm_add_epi16(s, _mm_mullo_epi16(c[2], _mm_set1_epi16(kb)));
+   s = _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(s, h), 8), h);
+   return _mm_packus_epi16(s, s);
+}
+
+// sums of the pairs of lanes of a and b -> 8 lanes
+SIMD static inline __m128i pairs(__m128i a, __m128i b)
+{
+   const __m128i lo = _mm_set1_epi32(0xffff);
+   return _mm_packs_epi32(_mm_add_epi32(_mm_and_si128(a, lo), _mm_srli_epi32(a, 16)),
+			  _mm_add_epi32(_mm_and_si128(b, lo), _mm_srli_epi32(b, 16)));
+}
+
+SIMD static int yuy2_row_sse2(const YUV_JOB *j, const YUV_SSE2 *m, const UINT8 *src, UINT8 *dst)
+{
+   const __m128i one = _mm_set1_epi16(1);
+   int x,n;
+
+   for (x=0; x+16<=j->w; x+=16) {
+      __m128i a[3],b[3],c[3],y,uv;
+      load_8(j,m,src + x*j->bpp,a);
+      load_8(j,m,src + (x+8)*j->bpp,b);
+      y = _mm_packus_epi16(luma_8(j,m,a), luma_8(j,m,b));
+      if (j->monochrome)
+	 uv = _mm_set1_epi8((char)128);
+      else {
+	 for (n=0; n<3; n++)
+	    c[n] = _mm_srli_epi16(_mm_add_epi16(pairs(a[n],b[n]), one), 1);
+	 uv = _mm_unpacklo_epi8(chroma_8(c,-38,-74,112), chroma_8(c,112,-94,-18));
+      }
+      // y0 u0 y1 v0 y2 u1...
+      _mm_storeu_si128((__m128i*)(dst + x*2), _mm_unpacklo_epi8(y, uv));
+      _mm_storeu_si128((__m128i*)(dst + x*2 + 16), _mm_unpackhi_epi8(y, uv));
+   }
+   return x;
+}
+
+SIMD static int yv12_rows_sse2(const YUV_JOB *j, const YUV_SSE2 *m, const UINT8 *s0, const UINT8 *s1,
+			       UINT8 *y0, UINT8 *y1, UINT8 *u, UINT8 *v)
+{
+   const __m128i two = _mm_set1_epi16(2);
+   int x,n;
+
+   for (x=0; x+16<=j->w; x+=16) {
+      __m128i a0[3],b0[3],a1[3],b1[3],c[3];
+      load_8(j,m,s0 + x*j->bpp,a0);
+      load_8(j,m,s0 + (x+8)*j->bpp,b0);
+      load_8(j,m,s1 + x*j->bpp,a1);
+      load_8(j,m,s1 + (x+8)*j->bpp,b1);
+      _mm_storeu_si128((__m128i*)(y0 + x), _mm_packus_epi16(luma_8(j,m,a0), luma_8(j,m,b0)));
+      _mm_storeu_si128((__m128i*)(y1 + x), _mm_packus_epi16(luma_8(j,m,a1), luma_8(j,m,b1)));
+      if (j->monochrome) {
+	 _mm_storel_epi64((__m128i*)(u + x/2), _mm_set1_epi8((char)128));
+	 _mm_storel_epi64((__m128i*)(v + x/2), _mm_set1_epi8((char)128));
+	 continue;
+      }
+      for (n=0; n<3; n++)
+	 c[n] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(pairs(a0[n],b0[n]),
+							   pairs(a1[n],b1[n])), two), 2);
+      _mm_storel_epi64((__m128i*)(u + x/2), chroma_8(c,-38,-74,112));
+      _mm_storel_epi64((__m128i*)(v + x/2), chroma_8(c,112,-94,-18));
+   }
+   return x;
+}
+
+#endif
+
+/******************************************************************************/
+
+// lines for YUY2, pairs of lines for YV12
+static void yuv_band(int start, int end, void *param)
+{
+   const YUV_JOB *j = (const YUV_JOB*)param;
+   int line,x;
+#ifdef RAINE_SIMD_YUV
+   YUV_SSE2 m = { { { 0 } } };
+
+   if (j->sse2)
+      get_sse2(j,&m);
+#endif
+
+   for (line=start; line<end; line++) {
+      if (j->yuy2) {
+	 const UINT8 *src = j->src + line*j->pitch;
+	 UINT8 *dst = j->plane[0] + line*j->pitches[0];
+	 x = 0;
+#ifdef RAINE_SIMD_YUV
+	 if (j->sse2)
+	    x = yuy2_row_sse2(j,&m,src,dst);
+#endif
+	 yuy2_row(j,src,dst,x);
+      } else {
+	 // an odd last line is paired with itself
+	 int l0 = line*2, l1 = MIN(l0+1, j->h-1);
+	 const UINT8 *s0 = j->src + l0*j->pitch;
+	 const UINT8 *s1 = j->src + l1*j->pitch;
+	 UINT8 *y0 = j->plane[0] + l0*j->pitches[0];
+	 UINT8 *y1 = j->plane[0] + l1*j->pitches[0];
+	 UINT8 *u = j->plane[1] + line*j->pitches[1];
+	 UINT8 *v = j->plane[2] + line*j->pitches[2];
+	 x = 0;
+#ifdef RAINE_SIMD_YUV
+	 if (j->sse2)
+	    x = yv12_rows_sse2(j,&m,s0,s1,y0,y1,u,v);
+#endif
+	 yv12_rows(j,s0,s1,y0,y1,u,v,x);
+      }
+   }
+}
+
+void yuv_convert(SDL_Surface *s, int x, int y, int w, int h, SDL_Overlay *o)
+{
+   SDL_PixelFormat *fmt = s->format;
+   YUV_JOB job;
+
+   w = MIN(w, o->w) & ~1;
+   h = MIN(h, o->h);
+   if (w <= 0 || h <= 0 || (fmt->BytesPerPixel != 2 && fmt->BytesPerPixel != 4))
+      return;
+
+   switch(o->format) {
+   case SDL_YUY2_OVERLAY:
+      job.yuy2 = 1;
+      break;
+   case SDL_YV12_OVERLAY: // planes y,v,u
+      job.yuy2 = 0;
+      job.plane[1] = o->pixels[2]; job.pitches[1] = o->pitches[2];
+      job.plane[2] = o->pixels[1]; job.pitches[2] = o->pitches[1];
+      break;
+   case SDL_IYUV_OVERLAY: // planes y,u,v
+      job.yuy2 = 0;
+      job.plane[1] = o->pixels[1]; job.pitches[1] = o->pitches[1];
+      job.plane[2] = o->pixels[2]; job.pitches[2] = o->pitches[2];
+      break;
+   default:
+      return;
+   }
+   job.plane[0] = o->pixels[0];
+   job.pitches[0] = o->pitches[0];
+
+   job.bpp = fmt->BytesPerPixel;
+   job.src = (UINT8*)s->pixels + y*s->pitch + x*job.bpp;
+   job.pitch = s->pitch;
+   job.shift[0] = fmt->Rshift; job.loss[0] = fmt->Rloss;
+   job.shift[1] = fmt->Gshift; job.loss[1] = fmt->Gloss;
+   job.shift[2] = fmt->Bshift; job.loss[2] = fmt->Bloss;
+   job.w = w;
+   job.h = h;
+   job.monochrome = yuv_monochrome;
+   job.lum = MAX(0, MIN(yuv_luminance, 200))*512/100;
+#ifdef RAINE_SIMD_YUV
+   job.sse2 = (raine_cpu_capabilities & CPU_SSE2) != 0;
+#else
+   job.sse2 = 0;
+#endif
+
+   render_bands(yuv_band, &job, 0, job.yuy2 ? h : (h+1)/2);
+}
@@ -0,0 +1,22 @@
+// rgb -> yuv conversion for the overlays (yuv.c)
+
+#ifndef YUV_H
+#define YUV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int yuv_monochrome;	// only the luminance, no colour
+extern int yuv_luminance;	// in %, 100 = normal
+
+/* Converts w x h pixels of s (15, 16 or 32bpp, any order of the components)
+   from x,y to the top left corner of the YUY2, YV12 or IYUV overlay o, which
+   must be locked. The width is rounded down to an even number of pixels. */
+void yuv_convert(SDL_Surface *s, int x, int y, int w, int h, SDL_Overlay *o);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
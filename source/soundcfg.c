@@ -2,6 +2,7 @@
 #include "sasound.h"
 #include "es5506.h"
 #include "3812intf.h"
+#include "timer.h" // sound_thread
 
 #ifdef ALLEGRO_SOUND
 int max_mixer_volume;
@@ -63,6 +64,7 @@ void sound_load_cfg() {
 #ifdef RAINE_WIN32
    smallest_sound_buffer = raine_get_config_int( "Sound",        "smallest_sound_buffer",0 );
 #endif
+   sound_thread = raine_get_config_int( "Sound",        "sound_thread",0 );
 #endif
 }
 
@@ -83,5 +85,6 @@ void sound_save_cfg() {
 #ifdef RAINE_WIN32
    raine_set_config_int(	"Sound",        "smallest_sound_buffer",         smallest_sound_buffer);
 #endif
+   raine_set_config_int(	"Sound",        "sound_thread",         sound_thread);
 #endif
 }
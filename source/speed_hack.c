@@ -1,5 +1,9 @@
 #include "raine.h"
 #include "ingame.h"
+#include "starhelp.h"
+#include "games.h"
+#include "files.h"
+#include "speed_hack.h"
 
 int speed_hack = 0; // speed hack detection (see execute_xxx_frame)
 
@@ -16,6 +20,7 @@ void undo_hack() {
     for (n=0; n<hack_length; n++)
       WriteWord(adr[n],wordval[n]);
     hack_length = 0;
+    flush_68000_code();
     speed_hack = 0; // Not found yet...
   }
 }
@@ -29,6 +34,7 @@ void pWriteWord(UINT8* myadr, UINT16 val) {
     hack_length--;
   }
   WriteWord(myadr,val);
+  flush_68000_code();
 }
 
 void apply_rom_hack(UINT8 *ROM, UINT32 pc, int kind) {
@@ -67,3 +73,218 @@ UINT8 *get_speed_hack_adr(int n) {
   return adr[n];
 }
 
+
+/* Automatic idle loops detection.
+ * Most games wait for the vbl by polling a ram flag or a hardware register in
+ * a tiny loop (tst.w $xxx / beq, btst #n,$xxx / bne...). When the 68000 ends
+ * its timeslice in the same loop for IDLE_SAMPLES slices in a row, the bcc
+ * closing the loop is passed to the cpu core which then stops for the rest
+ * of the slice each time it branches back. The rom is never patched, so rom
+ * checks still pass and there is nothing to undo. The loops found are saved
+ * in idle/<game>.idl and restored at the next boot.
+ * This needs the C 68000 core (C68000 in the makefile). It changes the
+ * timing of the games (a loop polling the scanline counter ends its slice
+ * too), so it's off until General/auto_idle_hacks is set in the config. */
+
+int auto_idle_hacks = 0;
+
+#define IDLE_SAMPLES 8
+#define IDLE_MAX_LOOPS 4
+#define IDLE_MAX_BYTES 32
+
+static struct {
+  UINT32 loop[IDLE_MAX_LOOPS]; // address of the bcc
+  int nb;
+  UINT32 candidate;
+  int hits;
+} idle[MAX_68000];
+static int idle_loaded;
+
+void reset_idle_hacks() {
+  memset(idle,0,sizeof(idle));
+  idle_loaded = 0;
+}
+
+/* Extension words of an effective address which can be read without side
+ * effect, -1 for (An)+, -(An) and the invalid modes */
+static int idle_ea_words(int mode, int reg, int size) {
+  switch(mode) {
+  case 0: case 1: case 2: return 0;
+  case 5: case 6: return 1;
+  case 7:
+    switch(reg) {
+    case 0: case 2: case 3: return 1;
+    case 1: return 2;
+    case 4: return (size == 4 ? 2 : 1);
+    }
+  }
+  return -1;
+}
+
+/* Length in bytes of an instruction which only reads memory, sets the flags
+ * or reloads a data register, 0 for anything else */
+static int idle_insn_len(UINT16 op) {
+  static const int sizes[4] = { 1, 2, 4, 0 };
+  int mode = (op >> 3) & 7, reg = op & 7, size = sizes[(op >> 6) & 3], ea;
+
+  if ((op & 0xff00) == 0x4a00 && size) // tst
+    ea = 1;
+  else if ((op & 0xff00) == 0x0c00 && size) // cmpi
+    ea = 1 + (size == 4 ? 2 : 1);
+  else if ((op & 0xffc0) == 0x0800) { // btst #n
+    ea = 2; size = 1;
+  } else if ((op & 0xf1c0) == 0x0100 && mode != 1) { // btst dn
+    ea = 1; size = 1;
+  } else if ((op & 0xf100) == 0xb000 && size) // cmp
+    ea = 1;
+  else if ((op & 0xf0c0) == 0xb0c0) { // cmpa
+    ea = 1; size = (op & 0x100 ? 4 : 2);
+  } else if ((op & 0xf100) == 0xc000 && size && mode != 1) // and <ea>,dn
+    ea = 1;
+  else if ((op & 0xff38) == 0x0200 && size) // andi #n,dn
+    return 2 + (size == 4 ? 4 : 2);
+  else if ((op & 0xf100) == 0x7000) // moveq
+    return 2;
+  else if ((op & 0xc1c0) == 0 && (op & 0x3000)) { // move <ea>,dn
+    ea = 1;
+    size = ((op >> 12) == 1 ? 1 : ((op >> 12) == 3 ? 2 : 4));
+  } else
+    return 0;
+  if (idle_ea_words(mode,reg,size) < 0)
+    return 0;
+  return (ea + idle_ea_words(mode,reg,size))*2;
+}
+
+/* Returns the target of a backward bcc at adr, or 1 if it's not one */
+static UINT32 idle_branch(UINT8 *base, UINT32 adr) {
+  UINT16 op = ReadWord(&base[adr]);
+  INT32 disp;
+  if ((op & 0xf000) != 0x6000 || (op & 0x0f00) == 0x0100) // bsr
+    return 1;
+  disp = (INT8)op;
+  if (!disp)
+    disp = (INT16)ReadWord(&base[adr+2]);
+  else if (disp == -1) // bcc.l (68020)
+    return 1;
+  if (disp >= 0 || disp < -IDLE_MAX_BYTES)
+    return 1;
+  return adr + 2 + disp;
+}
+
+/* Checks that the loop closed by the bcc at adr only contains instructions
+ * accepted by idle_insn_len. If pc is not -1, it must be one of them */
+static int idle_check_loop(UINT8 *base, UINT32 start, UINT32 adr, UINT32 pc) {
+  UINT32 target = idle_branch(base,adr), len;
+  int found = (pc == adr);
+  if (target & 1 || target < start)
+    return 0;
+  while (target < adr) {
+    if (target == pc)
+      found = 1;
+    len = idle_insn_len(ReadWord(&base[target]));
+    if (!len)
+      return 0;
+    target += len;
+  }
+  return target == adr && (found || pc == 0xffffffff);
+}
+
+/* Looks for a busy wait loop around pc, returns the address of its bcc or 1 */
+static UINT32 idle_find_loop(int cpu, UINT32 pc) {
+  UINT32 start,end,adr = pc,len;
+  UINT8 *base = s68k_get_code_range(cpu,pc,&start,&end);
+  if (!base || (pc & 1))
+    return 1;
+  while (adr + 4 <= end && adr < pc + IDLE_MAX_BYTES) {
+    if (!(idle_branch(base,adr) & 1))
+      return (idle_check_loop(base,start,adr,pc) ? adr : 1);
+    len = idle_insn_len(ReadWord(&base[adr]));
+    if (!len)
+      return 1;
+    adr += len;
+  }
+  return 1;
+}
+
+static char *idle_filename() {
+  static char str[FILENAME_MAX];
+  if (snprintf(str,FILENAME_MAX,"%sidle" SLASH "%s.idl", dir_cfg.exe_path,
+	current_game->main_name) >= FILENAME_MAX)
+    return NULL; // truncated, it would be another file
+  return str;
+}
+
+static void add_idle_loop(int cpu, UINT32 adr) {
+  if (add_68000_idle_loop(cpu,adr)) {
+    idle[cpu].loop[idle[cpu].nb++] = adr;
+    print_debug("idle loop for 68k%d at %x\n",cpu,adr);
+  }
+}
+
+static void load_idle_hacks() {
+  char *name = idle_filename();
+  FILE *f = (name ? fopen(name,"r") : NULL);
+  int cpu;
+  UINT32 adr,start,end;
+  UINT8 *base;
+  idle_loaded = 1;
+  if (!f)
+    return;
+  while (fscanf(f,"%d %x",&cpu,&adr) == 2) {
+    if (cpu < 0 || cpu >= MAX_68000 || idle[cpu].nb == IDLE_MAX_LOOPS)
+      continue;
+    // Don't trust the file blindly, the rom might have changed
+    base = s68k_get_code_range(cpu,adr,&start,&end);
+    if (base && !(adr & 1) && adr + 4 <= end &&
+	idle_check_loop(base,start,adr,0xffffffff))
+      add_idle_loop(cpu,adr);
+  }
+  fclose(f);
+}
+
+static void save_idle_hacks() {
+  char str[FILENAME_MAX], *name = idle_filename();
+  FILE *f;
+  int cpu,n;
+  if (!name)
+    return;
+  snprintf(str,FILENAME_MAX,"%sidle", dir_cfg.exe_path);
+  mkdir_rwx(str);
+  f = fopen(name,"w");
+  if (!f)
+    return;
+  for (cpu=0; cpu<MAX_68000; cpu++)
+    for (n=0; n<idle[cpu].nb; n++)
+      fprintf(f,"%d %x\n",cpu,idle[cpu].loop[n]);
+  fclose(f);
+}
+
+/* Called after each timeslice of a 68000, with its context still loaded */
+void detect_idle_68000(int cpu) {
+  UINT32 adr;
+  int n;
+  if (!auto_idle_hacks)
+    return;
+  if (!idle_loaded)
+    load_idle_hacks();
+  if (idle[cpu].nb == IDLE_MAX_LOOPS)
+    return;
+  adr = idle_find_loop(cpu,s68000context.pc);
+  if (adr & 1) {
+    idle[cpu].hits = 0;
+    return;
+  }
+  for (n=0; n<idle[cpu].nb; n++)
+    if (idle[cpu].loop[n] == adr)
+      return;
+  if (adr != idle[cpu].candidate) {
+    idle[cpu].candidate = adr;
+    idle[cpu].hits = 0;
+  }
+  if (++idle[cpu].hits == IDLE_SAMPLES) {
+    n = idle[cpu].nb;
+    add_idle_loop(cpu,adr);
+    if (idle[cpu].nb > n)
+      save_idle_hacks();
+  }
+}
@@ -9,6 +9,11 @@ void apply_rom_hack(UINT8 *ROM, UINT32 pc, int kind);
 void pWriteWord(UINT8* myadr, UINT16 val);
 UINT8 *get_speed_hack_adr(int n);
 
+// automatic idle loops detection (needs the C 68000 core)
+extern int auto_idle_hacks;
+void reset_idle_hacks();
+void detect_idle_68000(int cpu);
+
 #ifdef __cplusplus
 }
 #endif
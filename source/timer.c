@@ -7,6 +7,11 @@
 #include "mz80help.h"
 #include "sasound.h"
 #include "sdl/gui.h" // goto_debuger
+#include "savegame.h"
+#ifdef SDL
+#include "SDL_thread.h"
+#endif
+#include "newmem.h"
 
 // Number of cycles before reseting the cycles counter and the timers
 #define MAX_CYCLES 0x40000000
@@ -34,6 +39,10 @@
 /* cycles to triger a timer are executed. This slows a little down the */
 /* emulation (because the z80 frame is sliced), but it's more acurate */
 
+/* The timers are kept in a binary heap ordered by their expiration (in
+ * cycles of the audio cpu), so the next timer is always timer[0] and
+ * neither triger_timers nor get_min_cycles have to scan the whole list. */
+
 typedef struct {
   void (*handler)(int);
   int param;
@@ -44,25 +53,128 @@ typedef struct {
 
 UINT32 audio_cpu;
 
-#define MAX_TIMERS 20
+#define MAX_TIMERS 64
 
 static TimerStruct timer[MAX_TIMERS];
-static int free_timer = 0; // index of first availale timer
+static int free_timer = 0; // number of timers in the heap
 static size_t timer_id = 1;   // id of next allocated timer
+// timers taken out of the heap by triger_timers, waiting for their handler
+static TimerStruct due[MAX_TIMERS];
+static int nb_due;
 static int z80_frame;
 
+static void heap_up(int n) {
+  TimerStruct t = timer[n];
+  while (n > 0) {
+    int parent = (n-1)/2;
+    if (timer[parent].cycles <= t.cycles)
+      break;
+    timer[n] = timer[parent];
+    n = parent;
+  }
+  timer[n] = t;
+}
+
+static void heap_down(int n) {
+  TimerStruct t = timer[n];
+  int child;
+  while ((child = 2*n+1) < free_timer) {
+    if (child+1 < free_timer && timer[child+1].cycles < timer[child].cycles)
+      child++;
+    if (t.cycles <= timer[child].cycles)
+      break;
+    timer[n] = timer[child];
+    n = child;
+  }
+  timer[n] = t;
+}
+
+static void heap_remove(int n) {
+  if (--free_timer == n)
+    return;
+  timer[n] = timer[free_timer];
+  heap_up(n);
+  heap_down(n);
+}
+
+/* Savegames : the handlers are stored as an offset from timer_adjust, which
+ * doesn't change between 2 runs of the same executable. They are never
+ * called from the savegame though, the saved timers are only used to set
+ * the expiration of the timers which the sound chips have re-created with
+ * the same handler and parameter, which is safe even with a savegame from
+ * another build. */
+
+typedef struct {
+  INT32 handler;
+  INT32 param;
+  UINT32 cycles;
+  UINT32 period;
+} SavedTimer;
+
+#define TIMER_DYN_ID 4 // 0-3 are used by the neocd cache
+
+static SavedTimer saved_timer[MAX_TIMERS];
+static int nb_saved;
+
+void *timer_adjust(double duration, int param, double period, void (*callback)(int));
+
+static INT32 handler_offset(void (*handler)(int)) {
+  return (INT32)((char*)handler - (char*)&timer_adjust);
+}
+
+static void save_timers(UINT8 **buff, int *len) {
+  SavedTimer *st;
+  int n;
+  *len = free_timer*sizeof(SavedTimer);
+  if (!free_timer) {
+    *buff = NULL;
+    return;
+  }
+  *buff = AllocateMem(*len);
+  if (!*buff) {
+    *len = 0;
+    return;
+  }
+  st = (SavedTimer*)*buff;
+  for (n=0; n<free_timer; n++) {
+    st[n].handler = handler_offset(timer[n].handler);
+    st[n].param = timer[n].param;
+    st[n].cycles = timer[n].cycles;
+    st[n].period = timer[n].period;
+  }
+}
+
+static void load_timers(UINT8 *buff, int len) {
+  nb_saved = len/sizeof(SavedTimer);
+  if (nb_saved > MAX_TIMERS)
+    nb_saved = MAX_TIMERS;
+  memcpy(saved_timer,buff,nb_saved*sizeof(SavedTimer));
+}
+
 void update_timers() {
-  // Called after loading a game to try to recalibrate timers...
-  /* The best would probably be to save the timer array. The problem is */
-  /* how to find the callbacks ??? So for now I prefer to try to guess */
-  /* the correct timers... I know it's risky. */
-  int n,cpu = audio_cpu & 0xf;
-  int elapsed = Z80_context[cpu].dwElapsedTicks;
-  for (n=0; n<free_timer; n++)
-    if ((timer[n].cycles < elapsed) ||
+  // Called after loading a game. The timers which were saved get back
+  // their position, for the others (old savegames) we can only try to
+  // guess the correct timers...
+  int n,i,cpu = audio_cpu & 0xf;
+  UINT32 elapsed = Z80_context[cpu].dwElapsedTicks;
+  for (n=0; n<free_timer; n++) {
+    INT32 offset = handler_offset(timer[n].handler);
+    for (i=0; i<nb_saved; i++)
+      if (saved_timer[i].handler == offset &&
+	  saved_timer[i].param == timer[n].param)
+	break;
+    if (i < nb_saved) {
+      timer[n].cycles = saved_timer[i].cycles;
+      timer[n].period = saved_timer[i].period;
+      saved_timer[i] = saved_timer[--nb_saved];
+    } else if ((timer[n].cycles < elapsed) ||
 	(timer[n].cycles > elapsed + z80_frame)) {
       timer[n].cycles = elapsed + MIN_CYCLES;
     }
+  }
+  nb_saved = 0;
+  for (n=free_timer/2-1; n>=0; n--)
+    heap_down(n);
 }
 
 void z80_irq_handler(int irq) {
@@ -90,6 +202,7 @@ extern UINT32 pc_timer;
 
 void reset_timers() {
   free_timer = 0;
+  nb_saved = 0;
   timer_id = 1;
   mz80ClearTimers();
   render_frame_count = pc_timer = cpu_frame_count = 0;
@@ -118,25 +231,24 @@ double pos_in_frame() {
   return pos;
 }
 
-static int called_adjust;
-
 void *timer_adjust(double duration, int param, double period, void (*callback)(int))
 {
   UINT32 remaining = duration * fps * z80_frame;
   UINT32 cycles_period = period * fps * z80_frame;
   UINT32 elapsed = mz80GetCyclesDone();
 
-  called_adjust = 1;
   if (free_timer < MAX_TIMERS) {
 #if VERBOSE
       printf("timer_set %g cycles %d fps %d z80_frame %d cyclesremaining %d id %d param %d\n",duration,remaining,fps,z80_frame,cyclesRemaining,timer_id,param);
 #endif
+    if (!free_timer)
+      AddSaveDynCallbacks(TIMER_DYN_ID,load_timers,save_timers);
     timer[free_timer].handler = callback;
     timer[free_timer].param = param;
     timer[free_timer].cycles = elapsed + remaining;
     timer[free_timer].id = timer_id;
     timer[free_timer].period = cycles_period;
-    free_timer++;
+    heap_up(free_timer++);
   } else {
     printf("free timers overflow !!!\n");
     return NULL;
@@ -156,15 +268,22 @@ void timer_remove(void *the_timer) {
       break;
   }
   if (n<free_timer) { // found ?
-    if (n<free_timer-1) // Not the last one ?
-      memmove(&timer[n],&timer[n+1],sizeof(TimerStruct)*(free_timer-n-1));
-    free_timer--;
+    heap_remove(n);
   } else {
+    // a handler removing a timer which triger_timers already took out of
+    // the heap (usually itself)
+    for (n=0; n<nb_due; n++)
+      if (due[n].id == id)
+	break;
+    if (n<nb_due)
+      due[n].id = 0;
+    else {
 #ifdef RAINE_DEBUG
     // Not exactly sure how it happens, but it happens sometimes...
     printf("Timer not found %zd!\n",id);
 #endif
     // exit(1);
+    }
   }
 #if VERBOSE
   printf("after removal free %d\n",free_timer);
@@ -189,18 +308,28 @@ void triger_timers() {
   printf("elapsed %d free_timer %d\n",elapsed,free_timer);
 #endif
 
-  for (n=0; n<free_timer; n++) {
-    if (timer[n].cycles <= elapsed) { // Trigered !
+  // Take all the expired timers out of the heap before calling anything :
+  // each timer is trigered only once here even if its handler sets it
+  // again to expire right now (silentd does that at start).
+  nb_due = 0;
+  while (free_timer > 0 && timer[0].cycles <= elapsed) {
+    due[nb_due++] = timer[0];
+    heap_remove(0);
+  }
+
+  for (n=0; n<nb_due; n++) {
+    if (!due[n].id) // removed by a previous handler
+      continue;
 #if VERBOSE
-      printf("timer %d elapsed %d diff %d\n",n,elapsed,elapsed - timer[n].cycles);
-      count++;
+    printf("timer %d elapsed %d diff %d\n",n,elapsed,elapsed - due[n].cycles);
+    count++;
 #endif
 #ifndef HAS_CZ80
-      // if here, not while. silentd messes its timers at start and recovers
-      // after that, if there is a while here, it's an infinite loop
-      // (the logic of the driver might be wrong, but it works this way anyway)
-      // Only for mz80, to be tested in cz80 !
-      if (!_z80iff) {
+    // if here, not while. silentd messes its timers at start and recovers
+    // after that, if there is a while here, it's an infinite loop
+    // (the logic of the driver might be wrong, but it works this way anyway)
+    // Only for mz80, to be tested in cz80 !
+    if (!_z80iff) {
 	// Sometimes 2 timers trigger too close to each other and the z80
 	// needs time to handle the interrupt.
 	// I really wonder how the original hardware handled this.
@@ -216,27 +345,18 @@ void triger_timers() {
 	ExitOnEI = 0;
 	dwElapsedTicks = elapsed; // This frame must not count for the timers
 	cyclesRemaining=0;
-      }
+    }
 #endif
-      called_adjust = 0;
-      (*(timer[n].handler))(timer[n].param);
-      // Normally, I would call timer_remove here :
-      // timer_remove((void*)timer[n].id);
-      // but it is rather unefficient since it's looking for a timer
-      // when we know whcih one we want to delete...
-      // Also, it allows to handle periodic timers
-      if (!called_adjust) {
-	if (timer[n].period) {
-	  timer[n].cycles = elapsed + timer[n].period;
-	} else {
-	  if (n<free_timer-1) // not the last timer ?
-	    memmove(&timer[n],&timer[n+1],sizeof(TimerStruct)*(free_timer-n-1));
-	  free_timer--;
-	  n--;
-	}
-      }
+    (*(due[n].handler))(due[n].param);
+    // The handler usually calls timer_remove on its own timer, which clears
+    // its id. Otherwise a periodic timer goes back in the heap.
+    if (due[n].id && due[n].period && free_timer < MAX_TIMERS) {
+      due[n].cycles = elapsed + due[n].period;
+      timer[free_timer] = due[n];
+      heap_up(free_timer++);
     }
   }
+  nb_due = 0;
   if (elapsed > MAX_CYCLES) { // time to reset the cpu...
     for (n=0; n<free_timer; n++)
       timer[n].cycles -= MAX_CYCLES;
@@ -249,17 +369,12 @@ void triger_timers() {
 }
 
 INT32 get_min_cycles(UINT32 frame) {
-  int n;
   UINT32 elapsed;
   INT32 min_cycles;
 
   elapsed = mz80GetCyclesDone();
   if (free_timer > 0) {
-    min_cycles = timer[0].cycles;
-    for (n=1; n<free_timer; n++)
-      if (timer[n].cycles < min_cycles)
-	min_cycles = timer[n].cycles;
-    min_cycles -= elapsed;
+    min_cycles = timer[0].cycles - elapsed;
 
     if (min_cycles <= MIN_CYCLES) {
       min_cycles = MIN_CYCLES;
@@ -325,6 +440,86 @@ void execute_z80_audio_frame() {
   }
 }
 
+/* Sound thread : a driver which runs its audio cpu at the end of its frame
+ * can call start_z80_audio_frame instead of execute_z80_audio_frame. When
+ * sound_thread is set, the audio frame and the update of the streams are
+ * then done by a worker thread while the main thread draws the screen.
+ * The main cpu never runs at the same time : cpu_execute_cycles and the
+ * interrupt functions wait for the worker first, so the latches between the
+ * cpus behave exactly like before. */
+
+int sound_thread;
+#ifdef SDL
+int streams_updated;
+static SDL_Thread *audio_thread;
+static Uint32 audio_thread_id;
+static SDL_sem *audio_start, *audio_done;
+static volatile int audio_busy, audio_quit;
+
+static int audio_thread_func(void *unused) {
+  while (1) {
+    SDL_SemWait(audio_start);
+    if (audio_quit)
+      break;
+    execute_z80_audio_frame();
+    saUpdateSound(1);
+    streams_updated = 1;
+    SDL_SemPost(audio_done);
+  }
+  return 0;
+}
+
+void wait_z80_audio_frame() {
+  if (audio_busy && SDL_ThreadID() != audio_thread_id) {
+    SDL_SemWait(audio_done);
+    audio_busy = 0;
+  }
+}
+
+void start_z80_audio_frame() {
+  wait_z80_audio_frame();
+  if (sound_thread && !audio_thread) {
+    audio_start = SDL_CreateSemaphore(0);
+    audio_done = SDL_CreateSemaphore(0);
+    audio_thread = SDL_CreateThread(audio_thread_func,NULL);
+    if (audio_thread)
+      audio_thread_id = SDL_GetThreadID(audio_thread);
+    else {
+      printf("could not create the sound thread: %s\n",SDL_GetError());
+      sound_thread = 0;
+    }
+  }
+  if (!sound_thread || goto_debuger) {
+    execute_z80_audio_frame();
+    return;
+  }
+  streams_updated = 0;
+  audio_busy = 1;
+  SDL_SemPost(audio_start);
+}
+
+void stop_z80_audio_thread() {
+  wait_z80_audio_frame();
+  if (!audio_thread)
+    return;
+  audio_quit = 1;
+  SDL_SemPost(audio_start);
+  SDL_WaitThread(audio_thread,NULL);
+  audio_thread = NULL;
+  audio_quit = 0;
+  SDL_DestroySemaphore(audio_start);
+  SDL_DestroySemaphore(audio_done);
+  audio_start = audio_done = NULL;
+}
+#else
+void wait_z80_audio_frame() {}
+void stop_z80_audio_thread() {}
+
+void start_z80_audio_frame() {
+  execute_z80_audio_frame();
+}
+#endif
+
 // For now this thing always runs the 68k at 4 times the speed of the z80.
 void execute_z80_audio_frame_with_nmi(int nb) {
   INT32 frame = z80_frame;
@@ -31,6 +31,15 @@ double pos_in_frame();
 INT32 get_min_cycles(UINT32 frame);
 void execute_z80_audio_frame_with_nmi(int nb);
 
+extern int sound_thread;
+#ifdef SDL
+extern int streams_updated;
+#endif
+void start_z80_audio_frame();
+void wait_z80_audio_frame();
+// waits for the audio frame and ends the sound thread, when leaving the game
+void stop_z80_audio_thread();
+
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,99 @@
+/******************************************************************************/
+/*                                                                            */
+/*                 BANDS: draw a loop over lines with threads                 */
+/*                                                                            */
+/******************************************************************************/
+
+#include "raine.h"
+#include "bands.h"
+#ifdef SDL
+#include "SDL_thread.h"
+#endif
+
+int render_threads = 1;
+
+#ifdef SDL
+
+/* The main thread draws the first band itself, the workers are started
+   only when they are needed for the first time, and never stopped. */
+
+typedef struct BAND
+{
+   SDL_Thread *thread;
+   SDL_sem *start, *done;
+   band_func *func;
+   void *param;
+   int y1, y2;
+} BAND;
+
+static BAND band[MAX_RENDER_THREADS];
+static int nb_workers;
+static int max_workers = MAX_RENDER_THREADS-1; // less if a thread can't be made
+
+static int band_thread_func(void *data)
+{
+   BAND *b = (BAND*)data;
+
+   while (1) {
+      SDL_SemWait(b->start);
+      b->func(b->y1, b->y2, b->param);
+      SDL_SemPost(b->done);
+   }
+   return 0;
+}
+
+static int start_workers(int nb)
+{
+   while (nb_workers < nb && nb_workers < max_workers) {
+      BAND *b = &band[nb_workers+1];
+      b->start = SDL_CreateSemaphore(0);
+      b->done = SDL_CreateSemaphore(0);
+      if (b->start && b->done)
+	 b->thread = SDL_CreateThread(band_thread_func,b);
+      if (!b->thread) {
+	 print_debug("could not create a render thread: %s\n",SDL_GetError());
+	 if (b->start) SDL_DestroySemaphore(b->start);
+	 if (b->done) SDL_DestroySemaphore(b->done);
+	 b->start = b->done = NULL;
+	 max_workers = nb_workers; // don't try again at each frame
+	 break;
+      }
+      nb_workers++;
+   }
+   return nb_workers;
+}
+
+void render_bands(band_func *func, void *param, int start, int end)
+{
+   int n = render_threads, h = end - start, i;
+
+   if (n > MAX_RENDER_THREADS) n = MAX_RENDER_THREADS;
+   if (n > h/8) n = h/8; // not worth it for a few lines
+   if (n > 1)
+      n = start_workers(n-1) + 1;
+   if (n <= 1) {
+      func(start, end, param);
+      return;
+   }
+
+   for (i=1; i<n; i++) {
+      BAND *b = &band[i];
+      b->func = func;
+      b->param = param;
+      b->y1 = start + h*i/n;
+      b->y2 = start + h*(i+1)/n;
+      SDL_SemPost(b->start);
+   }
+   func(start, start + h/n, param);
+   for (i=1; i<n; i++)
+      SDL_SemWait(band[i].done);
+}
+
+#else
+
+void render_bands(band_func *func, void *param, int start, int end)
+{
+   func(start, end, param);
+}
+
+#endif
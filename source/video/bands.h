@@ -0,0 +1,33 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_BANDS_H
+#define VIDEO_BANDS_H
+
+/*
+  Band rendering : split a drawing loop over the lines of GameBitmap in
+  render_threads horizontal bands, drawn at the same time by a pool of
+  threads.
+
+  Only for drawing functions where each destination line depends only on
+  data which is not modified during the draw (layer bitmaps, ram...) : none
+  of the sprite functions clip, so an ordinary draw_game can't be split this
+  way, a sprite crossing 2 bands would be drawn twice in a random order.
+  func is called with [start,end) line ranges, and render_bands returns when
+  all the bands are done.
+*/
+
+typedef void band_func(int start, int end, void *param);
+
+extern int render_threads;	// 1 = no threads
+
+#define MAX_RENDER_THREADS 8
+
+void render_bands(band_func *func, void *param, int start, int end);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+/******************************************************************************/
+/*                                                                            */
+/*              4BPP PACKED TILE DRAWING FOR THE ASM VIDEO CORE               */
+/*                                                                            */
+/******************************************************************************/
+
+/* The asm core only has the transparent 8x8 packed sprites (i386/packed),
+   the other ones are taken from the c core. */
+
+#include "deftypes.h"
+#include "raine.h"
+#include "blit.h"
+#include "sprites_simd.h"
+#include "packed.h"
+
+packed(8,8);
+packed(8,16);
+packed(8,32);
+
+packed(16,8);
+packed(16,16);
+packed(16,32);
+packed_trans(16,8);
+packed_trans(16,16);
+packed_trans(16,32);
+
+packed(32,8);
+packed(32,16);
+packed(32,32);
+packed_trans(32,8);
+packed_trans(32,16);
+packed_trans(32,32);
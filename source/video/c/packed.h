@@ -0,0 +1,138 @@
+
+/* ##SIZE##x##SIZE## sprites, 4bpp packed data : 2 pixels per byte, the high
+   nibble is the left pixel [10325476]. Used by sprites.c for the c core and
+   by packed.c for the sizes the asm core doesn't have. */
+
+#ifndef ARG_MAP
+#define ARG_MAP UINT8 *SPR, int x, int y, UINT8 *cmap
+#endif
+
+#define packed(SIZE,BPP)                                               \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP(ARG_MAP)                \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP);             \
+   for(yy=0; yy<SIZE; yy++){                                           \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
+         line[xx]   = ((UINT##BPP *)cmap)[ *SPR >> 4 ];                \
+         line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];                \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipX(ARG_MAP)        \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipX);     \
+   for(yy=SIZE-1; yy>=0; yy--){                                        \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
+         line[xx]   = ((UINT##BPP *)cmap)[ *SPR >> 4 ];                \
+         line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];                \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipY(ARG_MAP)        \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipY);     \
+   for(yy=0; yy<SIZE; yy++){                                           \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
+         line[xx]   = ((UINT##BPP *)cmap)[ *SPR & 15 ];                \
+         line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];                \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipXY(ARG_MAP)       \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipXY);    \
+   for(yy=SIZE-1; yy>=0; yy--){                                        \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
+         line[xx]   = ((UINT##BPP *)cmap)[ *SPR & 15 ];                \
+         line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];                \
+      }                                                                \
+   }                                                                   \
+}
+
+#define packed_trans(SIZE,BPP)                                         \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP(ARG_MAP)          \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP);       \
+   for(yy=0; yy<SIZE; yy++){                                           \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
+         if(*SPR & 15)                                                 \
+            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];             \
+         if(*SPR >> 4)                                                 \
+            line[xx] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];               \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX(ARG_MAP)  \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX); \
+   for(yy=SIZE-1; yy>=0; yy--){                                        \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
+         if(*SPR & 15)                                                 \
+            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];             \
+         if(*SPR >> 4)                                                 \
+            line[xx] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];               \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY(ARG_MAP)  \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY); \
+   for(yy=0; yy<SIZE; yy++){                                           \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
+         if(*SPR & 15)                                                 \
+            line[xx] = ((UINT##BPP *)cmap)[ *SPR & 15 ];               \
+         if(*SPR >> 4)                                                 \
+            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];             \
+      }                                                                \
+   }                                                                   \
+}                                                                      \
+                                                                       \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY(ARG_MAP) \
+{                                                                      \
+   UINT##BPP *line;                                                    \
+   int xx,yy;                                                          \
+                                                                       \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY); \
+   for(yy=SIZE-1; yy>=0; yy--){                                        \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
+      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
+         if(*SPR & 15)                                                 \
+            line[xx] = ((UINT##BPP *)cmap)[ *SPR & 15 ];               \
+         if(*SPR >> 4)                                                 \
+            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];             \
+      }                                                                \
+   }                                                                   \
+}
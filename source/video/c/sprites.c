@@ -9,6 +9,7 @@
 #include "emudx.h"
 #include "blit.h"
 #include "alpha.h"
+#include "sprites_simd.h"
 
 /*
 
@@ -49,6 +50,7 @@ void Draw##SIZE##x##SIZE##_Mapped_##BPP(ARG_MAP)                       \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Mapped_##BPP);                    \
    for(yy=0; yy<SIZE; yy++){                                           \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy]))+ x;               \
       for(xx=0; xx<SIZE; xx++){                                        \
@@ -62,6 +64,7 @@ void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipX(ARG_MAP)               \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipX);            \
    for(yy=SIZE-1; yy>=0; yy--){                                        \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy]))+ x;               \
       for(xx=0; xx<SIZE; xx++){                                        \
@@ -75,8 +78,9 @@ void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipY(ARG_MAP)               \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipY);            \
    for(yy=0; yy<SIZE; yy++){                                           \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x + 15;         \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x + SIZE-1;     \
       for(xx=0; xx<SIZE; xx++){                                        \
          *line-- = ((UINT##BPP *)cmap)[ *SPR++ ];                      \
       }                                                                \
@@ -88,8 +92,9 @@ void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipXY(ARG_MAP)              \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipXY);           \
    for(yy=SIZE-1; yy>=0; yy--){                                        \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x + 15;         \
+      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x + SIZE-1;     \
       for(xx=0; xx<SIZE; xx++){                                        \
          *line-- = ((UINT##BPP *)cmap)[ *SPR++ ];                      \
       }                                                                \
@@ -102,6 +107,7 @@ void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP(ARG_MAP)                 \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP);              \
    for(yy=0; yy<SIZE; yy++){                                           \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
       for(xx=0; xx<SIZE; xx++, SPR++){                                 \
@@ -116,6 +122,7 @@ void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipX(ARG_MAP)         \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipX);      \
    for(yy=SIZE-1; yy>=0; yy--){                                        \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
       for(xx=0; xx<SIZE; xx++, SPR++){                                 \
@@ -130,6 +137,7 @@ void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipY(ARG_MAP)         \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipY);      \
    for(yy=0; yy<SIZE; yy++){                                           \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
       for(xx=SIZE-1; xx>=0; xx--, SPR++){                              \
@@ -144,6 +152,7 @@ void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipXY(ARG_MAP)        \
    UINT##BPP *line;                                                    \
    int xx,yy;                                                          \
                                                                        \
+   SIMD_SPRITE(Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipXY);     \
    for(yy=SIZE-1; yy>=0; yy--){                                        \
       line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
       for(xx=SIZE-1; xx>=0; xx--, SPR++){                              \
@@ -153,71 +162,7 @@ void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipXY(ARG_MAP)        \
    }                                                                   \
 }                                                                      \
                                                                        \
-/* packed version - transparent only */                                \
-                                                                       \
-void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP(ARG_MAP)          \
-{                                                                      \
-   UINT##BPP *line;                                                    \
-   int xx,yy;                                                          \
-                                                                       \
-   for(yy=0; yy<SIZE; yy++){                                           \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
-      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
-         if(*SPR & 15)                                                 \
-            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];             \
-         if(*SPR >> 4)                                                 \
-            line[xx] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];               \
-      }                                                                \
-   }                                                                   \
-}                                                                      \
-                                                                       \
-void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX(ARG_MAP)  \
-{                                                                      \
-   UINT##BPP *line;                                                    \
-   int xx,yy;                                                          \
-                                                                       \
-   for(yy=SIZE-1; yy>=0; yy--){                                        \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
-      for(xx=0; xx<SIZE; xx+=2, SPR++){                                \
-         if(*SPR & 15)                                                 \
-            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR & 15 ];             \
-         if(*SPR >> 4)                                                 \
-            line[xx] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];               \
-      }                                                                \
-   }                                                                   \
-}                                                                      \
-                                                                       \
-void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY(ARG_MAP)  \
-{                                                                      \
-   UINT##BPP *line;                                                    \
-   int xx,yy;                                                          \
-                                                                       \
-   for(yy=0; yy<SIZE; yy++){                                           \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
-      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
-         if(*SPR & 15)                                                 \
-            line[xx] = ((UINT##BPP *)cmap)[ *SPR & 15 ];               \
-         if(*SPR >> 4)                                                 \
-            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];             \
-      }                                                                \
-   }                                                                   \
-}                                                                      \
-                                                                       \
-void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY(ARG_MAP) \
-{                                                                      \
-   UINT##BPP *line;                                                    \
-   int xx,yy;                                                          \
-                                                                       \
-   for(yy=SIZE-1; yy>=0; yy--){                                        \
-      line = ((UINT##BPP *)(GameBitmap->line[y+yy])) + x;              \
-      for(xx=SIZE-2; xx>=0; xx-=2, SPR++){                             \
-         if(*SPR & 15)                                                 \
-            line[xx] = ((UINT##BPP *)cmap)[ *SPR & 15 ];               \
-         if(*SPR >> 4)                                                 \
-            line[xx+1] = ((UINT##BPP *)cmap)[ *SPR >> 4 ];             \
-      }                                                                \
-   }                                                                   \
-}                                                                      \
+/* packed version - the SIZExSIZE ones are in packed.h */              \
                                                                        \
 void Draw##SIZE##xH_Trans_Packed_Mapped_##BPP                          \
 (UINT8 *SPR, int x, int y, int height, UINT8 *cmap)                    \
@@ -431,6 +376,36 @@ render(64,8);
 render(64,16);
 render(64,32);
 
+#include "packed.h"
+
+packed(8,8);
+packed(8,16);
+packed(8,32);
+packed_trans(8,8);
+packed_trans(8,16);
+packed_trans(8,32);
+
+packed(16,8);
+packed(16,16);
+packed(16,32);
+packed_trans(16,8);
+packed_trans(16,16);
+packed_trans(16,32);
+
+packed(32,8);
+packed(32,16);
+packed(32,32);
+packed_trans(32,8);
+packed_trans(32,16);
+packed_trans(32,32);
+
+packed(64,8);
+packed(64,16);
+packed(64,32);
+packed_trans(64,8);
+packed_trans(64,16);
+packed_trans(64,32);
+
 #include "unmapped.h"
 
 unmapped(8,8);
@@ -0,0 +1,311 @@
+/******************************************************************************/
+/*                                                                            */
+/*                    SSSE3 MAPPED SPRITES FOR THE C VIDEO CORE               */
+/*                                                                            */
+/******************************************************************************/
+
+/*
+
+The asm video core is 32 bits only, so the 64 bits builds use the c core
+which maps 1 pixel at a time through cmap.
+
+Most sprites are 16 colours, and then the whole bank fits in a register :
+the colours are split in 1 register per byte of the colour (1 for 8bpp,
+2 for 16bpp, 4 for 32bpp) and pshufb maps 16 pixels at once for each of
+these bytes, which are then interleaved back to pixels. Transparent pixels
+are merged with what is already on screen before the store.
+
+The 4bpp packed sprites always fit this : each byte is split in its 2
+nibbles which are interleaved to get the indexes, then mapped the same way.
+
+A row with a pixel >= 16 (256 colours sprites) is drawn the usual way, so
+these functions are correct for any sprite. The bank is always read as 16
+colours, InitPaletteMap keeps some room after the last bank for this.
+
+*/
+
+#include "deftypes.h"
+#include "raine.h"
+#include "blit.h"
+#include "sprites_simd.h"
+
+#ifdef RAINE_SIMD_SPRITES
+
+#include <tmmintrin.h>
+
+#define SIMD __attribute__((target("ssse3")))
+
+// Split the 16 first colours of cmap in 1 register per byte
+
+SIMD static inline void load_colours_8(UINT8 *cmap, __m128i *t)
+{
+   t[0] = _mm_loadu_si128((__m128i*)cmap);
+}
+
+SIMD static inline void load_colours_16(UINT8 *cmap, __m128i *t)
+{
+   const __m128i split = _mm_setr_epi8(0,2,4,6,8,10,12,14, 1,3,5,7,9,11,13,15);
+   __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)cmap), split);
+   __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(cmap+16)), split);
+
+   t[0] = _mm_unpacklo_epi64(a,b);
+   t[1] = _mm_unpackhi_epi64(a,b);
+}
+
+SIMD static inline void load_colours_32(UINT8 *cmap, __m128i *t)
+{
+   const __m128i split = _mm_setr_epi8(0,4,8,12, 1,5,9,13, 2,6,10,14, 3,7,11,15);
+   __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)cmap), split);
+   __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(cmap+16)), split);
+   __m128i c = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(cmap+32)), split);
+   __m128i d = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(cmap+48)), split);
+   __m128i ab_lo = _mm_unpacklo_epi32(a,b);
+   __m128i ab_hi = _mm_unpackhi_epi32(a,b);
+   __m128i cd_lo = _mm_unpacklo_epi32(c,d);
+   __m128i cd_hi = _mm_unpackhi_epi32(c,d);
+
+   t[0] = _mm_unpacklo_epi64(ab_lo,cd_lo);
+   t[1] = _mm_unpackhi_epi64(ab_lo,cd_lo);
+   t[2] = _mm_unpacklo_epi64(ab_hi,cd_hi);
+   t[3] = _mm_unpackhi_epi64(ab_hi,cd_hi);
+}
+
+// store a register of pixels, keeping the screen where mask is set
+
+SIMD static inline void store_pixels(void *dst, __m128i px, __m128i mask, int trans)
+{
+   if (trans) {
+      int m = _mm_movemask_epi8(mask);
+      if (m == 0xffff)
+	 return;
+      if (m)
+	 px = _mm_or_si128(_mm_and_si128(mask,_mm_loadu_si128((__m128i*)dst)),
+			   _mm_andnot_si128(mask,px));
+   }
+   _mm_storeu_si128((__m128i*)dst,px);
+}
+
+SIMD static inline void store_pixels_64(void *dst, __m128i px, __m128i mask, int trans)
+{
+   if (trans) {
+      int m = _mm_movemask_epi8(mask) & 0xff;
+      if (m == 0xff)
+	 return;
+      if (m)
+	 px = _mm_or_si128(_mm_and_si128(mask,_mm_loadl_epi64((__m128i*)dst)),
+			   _mm_andnot_si128(mask,px));
+   }
+   _mm_storel_epi64((__m128i*)dst,px);
+}
+
+/* Map n (8 or 16) pixels of idx to dst */
+
+SIMD static inline void map_pixels_8(UINT8 *dst, __m128i idx, __m128i *t, int n, int trans)
+{
+   __m128i px = _mm_shuffle_epi8(t[0],idx);
+   __m128i mask = _mm_cmpeq_epi8(idx,_mm_setzero_si128());
+
+   if (n == 8)
+      store_pixels_64(dst,px,mask,trans);
+   else
+      store_pixels(dst,px,mask,trans);
+}
+
+SIMD static inline void map_pixels_16(UINT16 *dst, __m128i idx, __m128i *t, int n, int trans)
+{
+   __m128i b0 = _mm_shuffle_epi8(t[0],idx);
+   __m128i b1 = _mm_shuffle_epi8(t[1],idx);
+   __m128i mask = _mm_cmpeq_epi8(idx,_mm_setzero_si128());
+
+   store_pixels(dst,_mm_unpacklo_epi8(b0,b1),_mm_unpacklo_epi8(mask,mask),trans);
+   if (n == 16)
+      store_pixels(dst+8,_mm_unpackhi_epi8(b0,b1),_mm_unpackhi_epi8(mask,mask),trans);
+}
+
+SIMD static inline void map_pixels_32(UINT32 *dst, __m128i idx, __m128i *t, int n, int trans)
+{
+   __m128i b0 = _mm_shuffle_epi8(t[0],idx);
+   __m128i b1 = _mm_shuffle_epi8(t[1],idx);
+   __m128i b2 = _mm_shuffle_epi8(t[2],idx);
+   __m128i b3 = _mm_shuffle_epi8(t[3],idx);
+   __m128i mask = _mm_cmpeq_epi8(idx,_mm_setzero_si128());
+   __m128i lo01 = _mm_unpacklo_epi8(b0,b1), lo23 = _mm_unpacklo_epi8(b2,b3);
+   __m128i mlo = _mm_unpacklo_epi8(mask,mask);
+
+   store_pixels(dst,_mm_unpacklo_epi16(lo01,lo23),_mm_unpacklo_epi16(mlo,mlo),trans);
+   store_pixels(dst+4,_mm_unpackhi_epi16(lo01,lo23),_mm_unpackhi_epi16(mlo,mlo),trans);
+   if (n == 16) {
+      __m128i hi01 = _mm_unpackhi_epi8(b0,b1), hi23 = _mm_unpackhi_epi8(b2,b3);
+      __m128i mhi = _mm_unpackhi_epi8(mask,mask);
+      store_pixels(dst+8,_mm_unpacklo_epi16(hi01,hi23),_mm_unpacklo_epi16(mhi,mhi),trans);
+      store_pixels(dst+12,_mm_unpackhi_epi16(hi01,hi23),_mm_unpackhi_epi16(mhi,mhi),trans);
+   }
+}
+
+/* Generic sprite : flipx mirrors the rows, flipy the columns, as for the
+   other Draw functions. The flags are constants in the callers, so the
+   compiler makes 1 specialised loop for each of them. */
+
+#define kernel(SIZE,BPP)                                                      \
+SIMD static inline void draw_##SIZE##_##BPP(UINT8 *SPR, int x, int y,         \
+					    UINT8 *cmap, int flipx,           \
+					    int flipy, int trans)             \
+{                                                                             \
+   const int n = (SIZE < 16 ? 8 : 16);                                        \
+   const __m128i rev = (n == 8 ?                                              \
+      _mm_setr_epi8(7,6,5,4,3,2,1,0,-1,-1,-1,-1,-1,-1,-1,-1) :                \
+      _mm_setr_epi8(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0));                  \
+   const __m128i high = _mm_set1_epi8((char)0xf0);                            \
+   __m128i t[BPP/8];                                                          \
+   int xx,yy;                                                                 \
+                                                                              \
+   load_colours_##BPP(cmap,t);                                                \
+                                                                              \
+   for(yy=0; yy<SIZE; yy++, SPR+=SIZE){                                       \
+      UINT##BPP *line = ((UINT##BPP *)(GameBitmap->line[y +                   \
+	 (flipx ? SIZE-1-yy : yy)])) + x;                                     \
+      __m128i big = _mm_setzero_si128();                                      \
+                                                                              \
+      for(xx=0; xx<SIZE; xx+=n)                                               \
+	 big = _mm_or_si128(big, (n == 8 ? _mm_loadl_epi64((__m128i*)(SPR+xx)) : \
+				  _mm_loadu_si128((__m128i*)(SPR+xx))));      \
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(big,high),           \
+					   _mm_setzero_si128())) != 0xffff) { \
+	 /* more than 16 colours : 1 pixel at a time */                       \
+	 for(xx=0; xx<SIZE; xx++){                                            \
+	    UINT8 pix = SPR[flipy ? SIZE-1-xx : xx];                          \
+	    if (!trans || pix)                                                \
+	       line[xx] = ((UINT##BPP *)cmap)[pix];                           \
+	 }                                                                    \
+	 continue;                                                            \
+      }                                                                       \
+                                                                              \
+      for(xx=0; xx<SIZE; xx+=n){                                              \
+	 __m128i idx;                                                         \
+	 if (flipy) {                                                         \
+	    UINT8 *src = SPR + SIZE - n - xx;                                 \
+	    idx = (n == 8 ? _mm_loadl_epi64((__m128i*)src) :                  \
+		   _mm_loadu_si128((__m128i*)src));                           \
+	    idx = _mm_shuffle_epi8(idx,rev);                                  \
+	 } else                                                               \
+	    idx = (n == 8 ? _mm_loadl_epi64((__m128i*)(SPR+xx)) :             \
+		   _mm_loadu_si128((__m128i*)(SPR+xx)));                      \
+	 map_pixels_##BPP(line+xx,idx,t,n,trans);                             \
+      }                                                                       \
+   }                                                                          \
+}                                                                             \
+                                                                              \
+SIMD void Draw##SIZE##x##SIZE##_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)        \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,0,0,0); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,1,0,0); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,0,1,0); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap) \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,1,1,0); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)        \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,0,0,1); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,1,0,1); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,0,1,1); }                                  \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap) \
+{ draw_##SIZE##_##BPP(SPR,x,y,cmap,1,1,1); }
+
+kernel(8,8)
+kernel(8,16)
+kernel(8,32)
+
+kernel(16,8)
+kernel(16,16)
+kernel(16,32)
+
+kernel(32,8)
+kernel(32,16)
+kernel(32,32)
+
+kernel(64,8)
+kernel(64,16)
+kernel(64,32)
+
+/* 4bpp packed sprites : n pixels come from n/2 bytes, the high nibble is the
+   left pixel */
+
+SIMD static inline __m128i unpack_nibbles(UINT8 *src, int n)
+{
+   const __m128i low = _mm_set1_epi8(15);
+   __m128i b;
+
+   if (n == 8) {
+      UINT32 v;
+      memcpy(&v,src,4);
+      b = _mm_cvtsi32_si128(v);
+   } else
+      b = _mm_loadl_epi64((__m128i*)src);
+   return _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(b,4),low),
+			    _mm_and_si128(b,low));
+}
+
+#define kernel_packed(SIZE,BPP)                                               \
+SIMD static inline void draw_packed_##SIZE##_##BPP(UINT8 *SPR, int x, int y,  \
+						   UINT8 *cmap, int flipx,    \
+						   int flipy, int trans)      \
+{                                                                             \
+   const int n = (SIZE < 16 ? 8 : 16);                                        \
+   const __m128i rev = (n == 8 ?                                              \
+      _mm_setr_epi8(7,6,5,4,3,2,1,0,-1,-1,-1,-1,-1,-1,-1,-1) :                \
+      _mm_setr_epi8(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0));                  \
+   __m128i t[BPP/8];                                                          \
+   int xx,yy;                                                                 \
+                                                                              \
+   load_colours_##BPP(cmap,t);                                                \
+                                                                              \
+   for(yy=0; yy<SIZE; yy++, SPR+=SIZE/2){                                     \
+      UINT##BPP *line = ((UINT##BPP *)(GameBitmap->line[y +                   \
+	 (flipx ? SIZE-1-yy : yy)])) + x;                                     \
+                                                                              \
+      for(xx=0; xx<SIZE; xx+=n){                                              \
+	 __m128i idx;                                                         \
+	 if (flipy)                                                           \
+	    idx = _mm_shuffle_epi8(unpack_nibbles(SPR+(SIZE-n-xx)/2,n),rev);  \
+	 else                                                                 \
+	    idx = unpack_nibbles(SPR+xx/2,n);                                 \
+	 map_pixels_##BPP(line+xx,idx,t,n,trans);                             \
+      }                                                                       \
+   }                                                                          \
+}                                                                             \
+                                                                              \
+SIMD void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)        \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,0,0,0); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,1,0,0); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,0,1,0); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap) \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,1,1,0); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)        \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,0,0,1); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,1,0,1); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap)  \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,0,1,1); }                           \
+SIMD void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap) \
+{ draw_packed_##SIZE##_##BPP(SPR,x,y,cmap,1,1,1); }
+
+kernel_packed(8,8)
+kernel_packed(8,16)
+kernel_packed(8,32)
+
+kernel_packed(16,8)
+kernel_packed(16,16)
+kernel_packed(16,32)
+
+kernel_packed(32,8)
+kernel_packed(32,16)
+kernel_packed(32,32)
+
+kernel_packed(64,8)
+kernel_packed(64,16)
+kernel_packed(64,32)
+
+#endif
@@ -0,0 +1,61 @@
+
+#ifndef VIDEO_C_SPRITES_SIMD_H
+#define VIDEO_C_SPRITES_SIMD_H
+
+/* SSSE3 versions of the mapped sprites of the c video core (sprites_simd.c),
+   normal and 4bpp packed. The c functions call them when the cpu has ssse3,
+   see SIMD_SPRITE. */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9) || defined(__clang__))
+#define RAINE_SIMD_SPRITES 1
+#endif
+
+#ifdef RAINE_SIMD_SPRITES
+
+#include "cpuid.h"
+
+#define SIMD_SPRITE(func)                                  \
+   if (raine_cpu_ext_capabilities & CPU_SSSE3) {           \
+      func##_ssse3(SPR, x, y, cmap);                       \
+      return;                                              \
+   }                                                       \
+
+#define declare_simd(SIZE,BPP)                                                   \
+void Draw##SIZE##x##SIZE##_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap); \
+void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap); \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap); \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY_ssse3(UINT8 *SPR, int x, int y, UINT8 *cmap);
+
+declare_simd(8,8)
+declare_simd(8,16)
+declare_simd(8,32)
+declare_simd(16,8)
+declare_simd(16,16)
+declare_simd(16,32)
+declare_simd(32,8)
+declare_simd(32,16)
+declare_simd(32,32)
+declare_simd(64,8)
+declare_simd(64,16)
+declare_simd(64,32)
+
+#else
+
+#define SIMD_SPRITE(func)
+
+#endif
+
+#endif
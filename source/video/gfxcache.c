@@ -0,0 +1,205 @@
+/******************************************************************************/
+/*                                                                            */
+/*                  GFXCACHE: decoded gfx kept on the disk                    */
+/*                                                                            */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <zlib.h>
+#include "raine.h"
+#include "games.h"
+#include "files.h"
+#include "loadroms.h"
+#include "gfxcache.h"
+#ifndef RAINE_WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+int use_gfx_cache = 0;
+
+#define GFX_CACHE_VERSION 1	// change it when the format of the gfx changes
+#define MAX_MAPS 16
+
+typedef struct GFX_CACHE_HEADER
+{
+   char magic[8];		// "RAINEGFX"
+   UINT32 version;
+   UINT32 key;			// crc of the roms and of the params
+   UINT32 size;			// size of the data
+   UINT32 solid_size;		// size of the solid mask after the data, can be 0
+   UINT32 pad[10];		// the data start at 64 bytes
+} GFX_CACHE_HEADER;
+
+#ifndef RAINE_WIN32
+static struct {
+   void *base;
+   size_t len;
+} maps[MAX_MAPS];
+static int nb_maps;
+#endif
+
+static UINT32 cache_key(const char *name, const void *params, int params_size)
+{
+   const ROM_INFO *rom = current_game->rom_list;
+   uLong crc = crc32(0L, Z_NULL, 0);
+   UINT32 ver = GFX_CACHE_VERSION;
+
+   crc = crc32(crc, (const Bytef*)&ver, sizeof(ver));
+   crc = crc32(crc, (const Bytef*)name, strlen(name));
+   crc = crc32(crc, (const Bytef*)params, params_size);
+   for (; rom->name; rom++) {
+      crc = crc32(crc, (const Bytef*)&rom->crc32, sizeof(rom->crc32));
+      crc = crc32(crc, (const Bytef*)&rom->size, sizeof(rom->size));
+   }
+   return crc;
+}
+
+// Returns 0 if the path doesn't fit in FILENAME_MAX, it would be another file
+static int cache_name(char *path, const char *name)
+{
+   return snprintf(path,FILENAME_MAX,"%sgfxcache" SLASH "%s_%s.gfx",
+     dir_cfg.exe_path,current_game->main_name,name) < FILENAME_MAX;
+}
+
+static int check_header(GFX_CACHE_HEADER *hdr, UINT32 key, long file_size)
+{
+   return !memcmp(hdr->magic,"RAINEGFX",8) && hdr->version == GFX_CACHE_VERSION &&
+      hdr->key == key &&
+      file_size == sizeof(GFX_CACHE_HEADER) + (long)hdr->size + hdr->solid_size;
+}
+
+#ifndef RAINE_WIN32
+
+UINT8 *gfx_cache_load(const char *name, const void *params, int params_size,
+		      UINT32 *size, UINT8 **solid)
+{
+   char path[FILENAME_MAX];
+   GFX_CACHE_HEADER *hdr;
+   struct stat st;
+   UINT8 *base;
+   int fd;
+
+   if (!use_gfx_cache || nb_maps == MAX_MAPS)
+      return NULL;
+   if (!cache_name(path,name) || (fd = open(path,O_RDONLY)) < 0)
+      return NULL;
+   if (fstat(fd,&st) || st.st_size < (off_t)sizeof(GFX_CACHE_HEADER)) {
+      close(fd);
+      return NULL;
+   }
+   // private and writable : the drivers and the tile rotation can change
+   // the gfx, the file stays as it is
+   base = mmap(NULL,st.st_size,PROT_READ|PROT_WRITE,MAP_PRIVATE,fd,0);
+   close(fd);
+   if (base == MAP_FAILED)
+      return NULL;
+   hdr = (GFX_CACHE_HEADER*)base;
+   if (!check_header(hdr,cache_key(name,params,params_size),st.st_size) ||
+       (solid && !hdr->solid_size)) {
+      munmap(base,st.st_size);
+      return NULL;
+   }
+   maps[nb_maps].base = base;
+   maps[nb_maps++].len = st.st_size;
+   print_debug("gfx_cache_load: %s mapped\n",path);
+   *size = hdr->size;
+   if (solid)
+      *solid = base + sizeof(GFX_CACHE_HEADER) + hdr->size;
+   return base + sizeof(GFX_CACHE_HEADER);
+}
+
+void gfx_cache_close(void)
+{
+   while (nb_maps) {
+      nb_maps--;
+      munmap(maps[nb_maps].base,maps[nb_maps].len);
+   }
+}
+
+#else
+
+UINT8 *gfx_cache_load(const char *name, const void *params, int params_size,
+		      UINT32 *size, UINT8 **solid)
+{
+   char path[FILENAME_MAX];
+   GFX_CACHE_HEADER hdr;
+   UINT8 *data = NULL, *mask = NULL;
+   long file_size;
+   FILE *f;
+
+   if (!use_gfx_cache)
+      return NULL;
+   if (!cache_name(path,name) || !(f = fopen(path,"rb")))
+      return NULL;
+   fseek(f,0,SEEK_END);
+   file_size = ftell(f);
+   fseek(f,0,SEEK_SET);
+   if (fread(&hdr,sizeof(hdr),1,f) != 1 ||
+       !check_header(&hdr,cache_key(name,params,params_size),file_size) ||
+       (solid && !hdr.solid_size) ||
+       !(data = AllocateMem(hdr.size)) ||
+       fread(data,1,hdr.size,f) != hdr.size ||
+       (solid && (!(mask = AllocateMem(hdr.solid_size)) ||
+		  fread(mask,1,hdr.solid_size,f) != hdr.solid_size))) {
+      fclose(f);
+      if (data) FreeMem(data);
+      if (mask) FreeMem(mask);
+      return NULL;
+   }
+   fclose(f);
+   *size = hdr.size;
+   if (solid)
+      *solid = mask;
+   return data;
+}
+
+void gfx_cache_close(void)
+{
+   // everything is in the memory pool
+}
+
+#endif
+
+void gfx_cache_save(const char *name, const void *params, int params_size,
+		    UINT8 *data, UINT32 size, UINT8 *solid, UINT32 solid_size)
+{
+   char path[FILENAME_MAX], tmp[FILENAME_MAX];
+   GFX_CACHE_HEADER hdr;
+   FILE *f;
+   int ok;
+
+   if (!use_gfx_cache)
+      return;
+   snprintf(path,FILENAME_MAX,"%sgfxcache",dir_cfg.exe_path);
+   mkdir_rwx(path);
+   // written under another name and renamed, so that another instance
+   // never maps a file being written
+   if (!cache_name(path,name) ||
+       snprintf(tmp,FILENAME_MAX,"%s.tmp",path) >= FILENAME_MAX)
+      return;
+   if (!(f = fopen(tmp,"wb")))
+      return;
+   memset(&hdr,0,sizeof(hdr));
+   memcpy(hdr.magic,"RAINEGFX",8);
+   hdr.version = GFX_CACHE_VERSION;
+   hdr.key = cache_key(name,params,params_size);
+   hdr.size = size;
+   hdr.solid_size = (solid ? solid_size : 0);
+   ok = fwrite(&hdr,sizeof(hdr),1,f) == 1 &&
+      fwrite(data,1,size,f) == size &&
+      (!solid || fwrite(solid,1,solid_size,f) == solid_size);
+   ok &= !fclose(f);
+   if (ok) {
+#ifdef RAINE_WIN32
+      remove(path); // rename doesn't overwrite in windows
+#endif
+      ok = !rename(tmp,path);
+   }
+   if (!ok) {
+      print_debug("gfx_cache_save: could not write %s\n",path);
+      remove(tmp);
+   }
+}
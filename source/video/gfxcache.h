@@ -0,0 +1,38 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_GFXCACHE_H
+#define VIDEO_GFXCACHE_H
+
+/*
+  Disk cache of the decoded gfx : the result of the decoding done when a
+  game is loaded is saved in gfxcache/<game>_<name>.gfx, and the next time
+  the game is loaded the file is mapped instead of decoding the roms again.
+  The mapping is private so the pages are shared by all the instances
+  running the same game until someone writes to them (tile rotation).
+
+  A file is used only if it was made from the same roms (crcs of the rom
+  list of the game) and the same params, which must contain everything else
+  the decoding depends on (layout, size of the source...).
+*/
+
+extern int use_gfx_cache;	// config : General/gfx_cache
+
+// Returns the cached data and sets *size, and *solid to the solid mask if
+// solid is not NULL, or returns NULL if the cache can't be used.
+UINT8 *gfx_cache_load(const char *name, const void *params, int params_size,
+		      UINT32 *size, UINT8 **solid);
+
+// solid can be NULL if there is no solid mask
+void gfx_cache_save(const char *name, const void *params, int params_size,
+		    UINT8 *data, UINT32 size, UINT8 *solid, UINT32 solid_size);
+
+// Unmaps the files, called when the driver is unloaded
+void gfx_cache_close(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,671 @@
+/******************************************************************************/
+/*                                                                            */
+/*                 HQX: PORTABLE HQ2X/HQ3X AND XBR SCALERS                    */
+/*                                                                            */
+/******************************************************************************/
+
+/*
+
+The asm hq2x/hq3x are 32 bits only, this is the same filter in c : each
+source pixel gets a pattern of the neighbours which are different from it
+(in yuv, with the thresholds of the asm), and the rules of the asm for this
+pattern give the output pixels (hqx_rules.h). xBR looks at a 5x5
+neighbourhood, and blends the corners of the output along the edges it
+finds.
+
+The source lines are converted once to 8 bits components (rgb) and yuv, in
+buffers with the borders repeated, and the filters work from there. The
+conversions and the patterns of hq2x/hq3x are done with sse2 when the cpu
+has it. Each band of lines converts what it needs, so the bands are
+independant and they are drawn by the render threads.
+
+*/
+
+#include "raine.h"
+#include "hqx.h"
+#include "bands.h"
+#include "cpuid.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9) || defined(__clang__))
+#define RAINE_SIMD_HQX 1
+#include <emmintrin.h>
+#define SIMD __attribute__((target("sse2")))
+#endif
+
+typedef struct HQX_OP
+{
+   UINT8 w[3];			// weights, total 16
+   UINT8 n[3];			// of these pixels (w1..w9)
+} HQX_OP;
+
+typedef struct HQX_RULE
+{
+   UINT8 cond;			// 0 or a pair of hq_cond
+   UINT8 diff,same;		// op when the pair is different / the same
+} HQX_RULE;
+
+#include "hqx_rules.h"
+
+static const UINT8 hq_cond[5][2] = { { 5,5 }, { 2,6 }, { 6,8 }, { 8,4 }, { 4,2 } };
+
+typedef struct HQX_JOB
+{
+   int filter,scale;
+   BITMAP *src,*dest;
+   int s_x,s_y,d_x,d_y,w,h;
+} HQX_JOB;
+
+// The internal pixels have the 3 components in bytes 0-2, from the lowest
+// one in the format. For 16bpp each one is at shift[n] with loss[n] bits
+// less than 8, for 32bpp they are bytes from the bit base.
+
+static int fmt_bpp;
+static int shift[3],loss[3],base;
+static int red;			// byte of red in the internal pixels
+static int sse2;
+
+/******************************************************************************/
+/*                                                                            */
+/*                                 CONVERSIONS                                */
+/*                                                                            */
+/******************************************************************************/
+
+static int mask_shift(UINT32 mask)
+{
+   int n = 0;
+   while (mask && !(mask & 1)) {
+      mask >>= 1;
+      n++;
+   }
+   return n;
+}
+
+static int mask_bits(UINT32 mask)
+{
+   int n = 0;
+   mask >>= mask_shift(mask);
+   while (mask & 1) {
+      mask >>= 1;
+      n++;
+   }
+   return n;
+}
+
+static void init_xbr_maps(void);
+
+void hqx_format(int bpp, UINT32 rmask, UINT32 gmask, UINT32 bmask)
+{
+   static UINT32 old[4];
+   UINT32 mask[3];
+   int n;
+
+   if (old[0] == (UINT32)bpp && old[1] == rmask && old[2] == gmask && old[3] == bmask)
+      return;
+   old[0] = bpp; old[1] = rmask; old[2] = gmask; old[3] = bmask;
+   if (rmask < bmask) {
+      mask[0] = rmask; mask[2] = bmask; red = 0;
+   } else {
+      mask[0] = bmask; mask[2] = rmask; red = 2;
+   }
+   mask[1] = gmask;
+   for (n=0; n<3; n++) {
+      shift[n] = mask_shift(mask[n]);
+      loss[n] = 8 - mask_bits(mask[n]);
+      if (loss[n] < 0) loss[n] = 0;
+   }
+   base = shift[0];
+   fmt_bpp = (bpp == 15 ? 16 : bpp);
+   if (fmt_bpp != 16 && fmt_bpp != 32)
+      fmt_bpp = 0;
+#ifdef RAINE_SIMD_HQX
+   sse2 = (raine_cpu_capabilities & CPU_SSE2) != 0;
+#endif
+   init_xbr_maps();
+}
+
+static inline UINT32 to_rgb(UINT32 p)
+{
+   if (fmt_bpp == 32)
+      return (p >> base) & 0xffffff;
+   return (((p >> shift[0]) << loss[0]) & 0xff) |
+      ((((p >> shift[1]) << loss[1]) & 0xff) << 8) |
+      ((((p >> shift[2]) << loss[2]) & 0xff) << 16);
+}
+
+static inline UINT32 from_rgb(UINT32 c)
+{
+   if (fmt_bpp == 32)
+      return c << base;
+   return (((c & 0xff) >> loss[0]) << shift[0]) |
+      ((((c >> 8) & 0xff) >> loss[1]) << shift[1]) |
+      (((c >> 16) >> loss[2]) << shift[2]);
+}
+
+static inline UINT32 to_yuv(int filter, UINT32 c)
+{
+   int b0 = c & 0xff, g = (c >> 8) & 0xff, b2 = c >> 16;
+   int r,b,y,u,v;
+
+   if (filter == HQX_HQ) {
+      // RGBtoYUV of the asm, the differences don't depend on the order
+      y = (b0 + g + b2) >> 2;
+      u = 128 + ((b2 - b0) >> 2);
+      v = 128 + ((-b2 + 2*g - b0) >> 3);
+   } else {
+      r = (red ? b2 : b0);
+      b = (red ? b0 : b2);
+      y = (77*r + 150*g + 29*b) >> 8;
+      u = ((-43*r - 85*g + 128*b) >> 8) + 128;
+      v = ((128*r - 107*g - 21*b) >> 8) + 128;
+   }
+   return (y << 16) | (u << 8) | v;
+}
+
+#ifdef RAINE_SIMD_HQX
+
+// components of 8 pixels in 16 bits lanes -> internal pixels
+
+SIMD static inline void store_rgb(__m128i c0, __m128i c1, __m128i c2, UINT32 *dst)
+{
+   __m128i lo = _mm_or_si128(c0, _mm_slli_epi16(c1, 8));
+   _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(lo, c2));
+   _mm_storeu_si128((__m128i*)(dst+4), _mm_unpackhi_epi16(lo, c2));
+}
+
+SIMD static int convert_row_sse2(int filter, const UINT8 *src, UINT32 *rgb, UINT32 *yuv, int w)
+{
+   const __m128i ff = _mm_set1_epi16(0xff);
+   const __m128i ff32 = _mm_set1_epi32(0xff);
+   const __m128i c128 = _mm_set1_epi16(128);
+   __m128i c0,c1,c2,y,u,v,r,b;
+   int x;
+
+   for (x=0; x+8 <= w; x+=8) {
+      if (fmt_bpp == 16) {
+	 __m128i p = _mm_loadu_si128((const __m128i*)(src + x*2));
+	 c0 = _mm_and_si128(_mm_sll_epi16(_mm_srl_epi16(p, _mm_cvtsi32_si128(shift[0])), _mm_cvtsi32_si128(loss[0])), ff);
+	 c1 = _mm_and_si128(_mm_sll_epi16(_mm_srl_epi16(p, _mm_cvtsi32_si128(shift[1])), _mm_cvtsi32_si128(loss[1])), ff);
+	 c2 = _mm_and_si128(_mm_sll_epi16(_mm_srl_epi16(p, _mm_cvtsi32_si128(shift[2])), _mm_cvtsi32_si128(loss[2])), ff);
+      } else {
+	 const __m128i sh = _mm_cvtsi32_si128(base);
+	 __m128i p0 = _mm_srl_epi32(_mm_loadu_si128((const __m128i*)(src + x*4)), sh);
+	 __m128i p1 = _mm_srl_epi32(_mm_loadu_si128((const __m128i*)(src + x*4 + 16)), sh);
+	 c0 = _mm_packs_epi32(_mm_and_si128(p0, ff32), _mm_and_si128(p1, ff32));
+	 c1 = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), ff32),
+			      _mm_and_si128(_mm_srli_epi32(p1, 8), ff32));
+	 c2 = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), ff32),
+			      _mm_and_si128(_mm_srli_epi32(p1, 16), ff32));
+      }
+      store_rgb(c0, c1, c2, rgb + x);
+
+      if (filter == HQX_HQ) {
+	 y = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(c0, c1), c2), 2);
+	 u = _mm_add_epi16(_mm_srai_epi16(_mm_sub_epi16(c2, c0), 2), c128);
+	 v = _mm_add_epi16(_mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(_mm_slli_epi16(c1, 1), c2), c0), 3), c128);
+      } else {
+	 r = (red ? c2 : c0);
+	 b = (red ? c0 : c2);
+	 y = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(
+	    _mm_mullo_epi16(r, _mm_set1_epi16(77)), _mm_mullo_epi16(c1, _mm_set1_epi16(150))),
+	    _mm_mullo_epi16(b, _mm_set1_epi16(29))), 8);
+	 u = _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(_mm_add_epi16(
+	    _mm_mullo_epi16(r, _mm_set1_epi16(-43)), _mm_mullo_epi16(c1, _mm_set1_epi16(-85))),
+	    _mm_slli_epi16(b, 7)), 8), c128);
+	 v = _mm_add_epi16(_mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(
+	    _mm_slli_epi16(r, 7), _mm_mullo_epi16(c1, _mm_set1_epi16(107))),
+	    _mm_mullo_epi16(b, _mm_set1_epi16(21))), 8), c128);
+      }
+      store_rgb(v, u, y, yuv + x);
+   }
+   return x;
+}
+
+SIMD static int store_row_sse2(const UINT32 *rgb, UINT8 *dst, int w)
+{
+   const __m128i ff32 = _mm_set1_epi32(0xff);
+   __m128i c0,c1,c2,p0,p1;
+   int x;
+
+   if (fmt_bpp == 32) {
+      const __m128i sh = _mm_cvtsi32_si128(base);
+      for (x=0; x+4 <= w; x+=4)
+	 _mm_storeu_si128((__m128i*)(dst + x*4),
+			  _mm_sll_epi32(_mm_loadu_si128((const __m128i*)(rgb + x)), sh));
+      return x;
+   }
+   for (x=0; x+8 <= w; x+=8) {
+      p0 = _mm_loadu_si128((const __m128i*)(rgb + x));
+      p1 = _mm_loadu_si128((const __m128i*)(rgb + x + 4));
+      c0 = _mm_packs_epi32(_mm_and_si128(p0, ff32), _mm_and_si128(p1, ff32));
+      c1 = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), ff32),
+			   _mm_and_si128(_mm_srli_epi32(p1, 8), ff32));
+      c2 = _mm_packs_epi32(_mm_srli_epi32(p0, 16), _mm_srli_epi32(p1, 16));
+      c0 = _mm_sll_epi16(_mm_srl_epi16(c0, _mm_cvtsi32_si128(loss[0])), _mm_cvtsi32_si128(shift[0]));
+      c1 = _mm_sll_epi16(_mm_srl_epi16(c1, _mm_cvtsi32_si128(loss[1])), _mm_cvtsi32_si128(shift[1]));
+      c2 = _mm_sll_epi16(_mm_srl_epi16(c2, _mm_cvtsi32_si128(loss[2])), _mm_cvtsi32_si128(shift[2]));
+      _mm_storeu_si128((__m128i*)(dst + x*2), _mm_or_si128(_mm_or_si128(c0, c1), c2));
+   }
+   return x;
+}
+
+#endif
+
+// Line sy of the source (clamped to the area) in rgb and yuv, from -r to w+r
+
+static void convert_row(const HQX_JOB *job, int sy, int r, UINT32 *rgb, UINT32 *yuv)
+{
+   const UINT8 *src;
+   int x = 0, w = job->w;
+
+   if (sy < 0) sy = 0;
+   if (sy >= job->h) sy = job->h - 1;
+   src = job->src->line[job->s_y + sy] + job->s_x * (fmt_bpp/8);
+
+#ifdef RAINE_SIMD_HQX
+   if (sse2)
+      x = convert_row_sse2(job->filter, src, rgb, yuv, w);
+#endif
+   for (; x<w; x++) {
+      rgb[x] = to_rgb(fmt_bpp == 16 ? ((const UINT16*)src)[x] : ((const UINT32*)src)[x]);
+      yuv[x] = to_yuv(job->filter, rgb[x]);
+   }
+   for (x=1; x<=r; x++) {
+      rgb[-x] = rgb[0];
+      yuv[-x] = yuv[0];
+      rgb[w-1+x] = rgb[w-1];
+      yuv[w-1+x] = yuv[w-1];
+   }
+}
+
+static void store_row(const UINT32 *rgb, UINT8 *dst, int w)
+{
+   int x = 0;
+
+#ifdef RAINE_SIMD_HQX
+   if (sse2)
+      x = store_row_sse2(rgb, dst, w);
+#endif
+   if (fmt_bpp == 16)
+      for (; x<w; x++)
+	 ((UINT16*)dst)[x] = from_rgb(rgb[x]);
+   else
+      for (; x<w; x++)
+	 ((UINT32*)dst)[x] = from_rgb(rgb[x]);
+}
+
+/******************************************************************************/
+/*                                                                            */
+/*                                   BLENDS                                   */
+/*                                                                            */
+/******************************************************************************/
+
+static inline UINT32 blend3(UINT32 a, int wa, UINT32 b, int wb, UINT32 c, int wc)
+{
+   return ((((a & 0xff00ff)*wa + (b & 0xff00ff)*wb + (c & 0xff00ff)*wc) >> 4) & 0xff00ff) |
+      ((((a & 0x00ff00)*wa + (b & 0x00ff00)*wb + (c & 0x00ff00)*wc) >> 4) & 0x00ff00);
+}
+
+// a moved by k/16 towards b
+static inline UINT32 blend(UINT32 a, UINT32 b, int k)
+{
+   return blend3(a, 16-k, b, k, 0, 0);
+}
+
+static inline int yuv_diff(UINT32 a, UINT32 b)
+{
+   return abs((int)(a >> 16) - (int)(b >> 16)) > 0x30 ||
+      abs((int)((a >> 8) & 0xff) - (int)((b >> 8) & 0xff)) > 7 ||
+      abs((int)(a & 0xff) - (int)(b & 0xff)) > 6;
+}
+
+static inline int yuv_dist(UINT32 a, UINT32 b)
+{
+   return abs((int)(a >> 16) - (int)(b >> 16)) +
+      abs((int)((a >> 8) & 0xff) - (int)((b >> 8) & 0xff)) +
+      abs((int)(a & 0xff) - (int)(b & 0xff));
+}
+
+/******************************************************************************/
+/*                                                                            */
+/*                                  HQ2X/HQ3X                                 */
+/*                                                                            */
+/******************************************************************************/
+
+/* Pattern of each pixel of the line : bit n-1 (n-2 after w5) set when wn is
+   different from w5. yuv are the lines y-1, y, y+1 */
+
+#ifdef RAINE_SIMD_HQX
+
+SIMD static inline int same_mask(__m128i v, __m128i c, __m128i thr)
+{
+   __m128i d = _mm_or_si128(_mm_subs_epu8(v, c), _mm_subs_epu8(c, v));
+   d = _mm_subs_epu8(d, thr);
+   return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(d, _mm_setzero_si128())));
+}
+
+SIMD static void hq_patterns_sse2(UINT32 **yuv, UINT8 *pat, int w)
+{
+   const __m128i thr = _mm_set1_epi32(0x00300706);
+   int x, a, m, b;
+
+   for (x=0; x<w; x++) {
+      // w1 w2 w3 / w4 w5 w6 / w7 w8 w9 in the 3 lowest lanes
+      __m128i c = _mm_set1_epi32(yuv[1][x]);
+      a = ~same_mask(_mm_loadu_si128((const __m128i*)(yuv[0]+x-1)), c, thr);
+      m = ~same_mask(_mm_loadu_si128((const __m128i*)(yuv[1]+x-1)), c, thr);
+      b = ~same_mask(_mm_loadu_si128((const __m128i*)(yuv[2]+x-1)), c, thr);
+      pat[x] = (a & 7) | ((m & 1) << 3) | ((m & 4) << 2) | ((b & 7) << 5);
+   }
+}
+
+#endif
+
+static void hq_patterns(UINT32 **yuv, UINT8 *pat, int w)
+{
+   int x, n, bit, p;
+
+#ifdef RAINE_SIMD_HQX
+   if (sse2) {
+      hq_patterns_sse2(yuv, pat, w);
+      return;
+   }
+#endif
+   for (x=0; x<w; x++) {
+      p = 0;
+      for (n=0, bit=1; n<9; n++) {
+	 if (n == 4) continue;
+	 if (yuv_diff(yuv[n/3][x+n%3-1], yuv[1][x]))
+	    p |= bit;
+	 bit <<= 1;
+      }
+      pat[x] = p;
+   }
+}
+
+static void hq_line(const HQX_JOB *job, UINT32 **rgb, UINT32 **yuv, UINT8 *pat, UINT32 *out)
+{
+   const int scale = job->scale, ow = job->w * scale, nb = scale*scale;
+   const HQX_RULE *rules = (scale == 2 ? hq2x_rules[0] : hq3x_rules[0]);
+   UINT32 w[10],wy[10],*dst;
+   int x,n,k;
+
+   hq_patterns(yuv, pat, job->w);
+   for (x=0; x<job->w; x++) {
+      dst = out + x*scale;
+      for (n=0; n<9; n++)
+	 w[n+1] = rgb[n/3][x+n%3-1];
+      if (w[2] == w[5] && w[4] == w[5] && w[6] == w[5] && w[8] == w[5]) {
+	 // the usual case : only w5 is used
+	 for (k=0; k<nb; k++)
+	    dst[(k/scale)*ow + k%scale] = w[5];
+	 continue;
+      }
+      for (n=0; n<9; n++)
+	 wy[n+1] = yuv[n/3][x+n%3-1];
+      for (k=0; k<nb; k++) {
+	 const HQX_RULE *rule = &rules[pat[x]*nb + k];
+	 const HQX_OP *op = &hqx_ops[rule->same];
+	 if (rule->cond && yuv_diff(wy[hq_cond[rule->cond][0]], wy[hq_cond[rule->cond][1]]))
+	    op = &hqx_ops[rule->diff];
+	 dst[(k/scale)*ow + k%scale] = (op->w[0] == 16 ? w[op->n[0]] :
+	    blend3(w[op->n[0]], op->w[0], w[op->n[1]], op->w[1], w[op->n[2]], op->w[2]));
+      }
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/*                                  2XBR/3XBR                                 */
+/*                                                                            */
+/******************************************************************************/
+
+/* The neighbourhood, 5x5 without the corners, by its usual names :
+
+      A1 B1 C1
+   A0 A  B  C  C4
+   D0 D  E  F  F4
+   G0 G  H  I  I4
+      G5 H5 I5
+
+   The edge is tested for the bottom right corner of E, and the 4 corners are
+   done by rotating the neighbourhood by 90 degrees. */
+
+enum { A1=1,B1,C1, A0=5,PA,PB,PC,C4, D0,PD,PE,PF,F4, G0,PG,PH,PI,I4, G5=21,H5,I5 };
+
+static UINT8 xbr_map[4][25];	// neighbour of each rotation
+static UINT8 xbr2_out[4][3];	// corner, next one on the line, on the column
+static UINT8 xbr3_out[4][5];	// corner, line (2), column (2)
+
+static void rotate(int r, int *x, int *y)
+{
+   int t;
+   while (r--) {
+      t = *x;
+      *x = *y;
+      *y = -t;
+   }
+}
+
+static int out_index(int r, int x, int y, int scale)
+{
+   rotate(r, &x, &y);
+   if (scale == 2)
+      return (y+1)/2*2 + (x+1)/2;
+   return (y+1)*3 + x+1;
+}
+
+static void init_xbr_maps(void)
+{
+   static const int pos3[5][2] = { { 1,1 }, { 0,1 }, { -1,1 }, { 1,0 }, { 1,-1 } };
+   int r,n,x,y;
+
+   for (r=0; r<4; r++) {
+      for (n=0; n<25; n++) {
+	 x = n%5 - 2;
+	 y = n/5 - 2;
+	 rotate(r, &x, &y);
+	 xbr_map[r][n] = (y+2)*5 + x+2;
+      }
+      xbr2_out[r][0] = out_index(r, 1, 1, 2);
+      xbr2_out[r][1] = out_index(r, -1, 1, 2);
+      xbr2_out[r][2] = out_index(r, 1, -1, 2);
+      for (n=0; n<5; n++)
+	 xbr3_out[r][n] = out_index(r, pos3[n][0], pos3[n][1], 3);
+   }
+}
+
+enum { XBR_NONE, XBR_HALF, XBR_DIAG, XBR_LEFT, XBR_UP, XBR_LEFT_UP };
+
+// the edge at the bottom right corner, and the colour to blend in px
+
+static int xbr_edge(int scale, const UINT32 *p, const UINT32 *y, const UINT8 *m, UINT32 *px)
+{
+#define P(n) p[m[n]]
+#define DF(a,b) yuv_dist(y[m[a]], y[m[b]])
+#define EQ(a,b) (DF(a,b) < 155)
+   int e,i,ke,ki,left,up;
+
+   if (P(PE) == P(PH) || P(PE) == P(PF))
+      return XBR_NONE;
+   e = DF(PE,PC) + DF(PE,PG) + DF(PI,H5) + DF(PI,F4) + (DF(PH,PF) << 2);
+   i = DF(PH,PD) + DF(PH,I5) + DF(PF,I4) + DF(PF,PB) + (DF(PE,PI) << 2);
+   if (e > i)
+      return XBR_NONE;
+   *px = (DF(PE,PF) <= DF(PE,PH) ? P(PF) : P(PH));
+   if (e == i)
+      return XBR_HALF;
+   if (scale == 2) {
+      if (!((!EQ(PF,PB) && !EQ(PH,PD)) ||
+	    (EQ(PE,PI) && !EQ(PF,I4) && !EQ(PH,I5)) ||
+	    EQ(PE,PG) || EQ(PE,PC)))
+	 return XBR_HALF;
+   } else {
+      if (!((!EQ(PF,PB) && !EQ(PF,PC)) || (!EQ(PH,PD) && !EQ(PH,PG)) ||
+	    (EQ(PE,PI) && ((!EQ(PF,F4) && !EQ(PF,I4)) || (!EQ(PH,H5) && !EQ(PH,I5)))) ||
+	    EQ(PE,PG) || EQ(PE,PC)))
+	 return XBR_HALF;
+   }
+   ke = DF(PF,PG);
+   ki = DF(PH,PC);
+   left = (ke << 1) <= ki && P(PE) != P(PG) && P(PD) != P(PG);
+   up = ke >= (ki << 1) && P(PE) != P(PC) && P(PB) != P(PC);
+   if (left && up)
+      return XBR_LEFT_UP;
+   if (left)
+      return XBR_LEFT;
+   if (up)
+      return XBR_UP;
+   return XBR_DIAG;
+#undef P
+#undef DF
+#undef EQ
+}
+
+static void xbr_line(const HQX_JOB *job, UINT32 **rgb, UINT32 **yuv, UINT32 *out)
+{
+   const int scale = job->scale, ow = job->w * scale, nb = scale*scale;
+   UINT32 p[25],y[25],e[9],px,*dst;
+   int x,n,r,k;
+
+   for (x=0; x<job->w; x++) {
+      dst = out + x*scale;
+      for (n=0; n<25; n++)
+	 p[n] = rgb[n/5][x+n%5-2];
+      for (k=0; k<nb; k++)
+	 e[k] = p[PE];
+      if (p[PB] != p[PE] || p[PD] != p[PE] || p[PF] != p[PE] || p[PH] != p[PE]) {
+	 for (n=0; n<25; n++)
+	    y[n] = yuv[n/5][x+n%5-2];
+	 for (r=0; r<4; r++) {
+	    int edge = xbr_edge(scale, p, y, xbr_map[r], &px);
+	    if (edge == XBR_NONE)
+	       continue;
+	    if (scale == 2) {
+	       const UINT8 *o = xbr2_out[r];
+	       switch(edge) {
+	       case XBR_LEFT_UP:
+		  e[o[0]] = blend(e[o[0]], px, 14);
+		  e[o[1]] = blend(e[o[1]], px, 4);
+		  e[o[2]] = e[o[1]];
+		  break;
+	       case XBR_LEFT:
+		  e[o[0]] = blend(e[o[0]], px, 12);
+		  e[o[1]] = blend(e[o[1]], px, 4);
+		  break;
+	       case XBR_UP:
+		  e[o[0]] = blend(e[o[0]], px, 12);
+		  e[o[2]] = blend(e[o[2]], px, 4);
+		  break;
+	       default: // diagonal or half
+		  e[o[0]] = blend(e[o[0]], px, 8);
+	       }
+	    } else {
+	       // corner, then left 1 & 2, up 1 & 2
+	       const UINT8 *o = xbr3_out[r];
+	       switch(edge) {
+	       case XBR_LEFT_UP:
+		  e[o[1]] = blend(e[o[1]], px, 12);
+		  e[o[2]] = blend(e[o[2]], px, 4);
+		  e[o[3]] = e[o[1]];
+		  e[o[4]] = e[o[2]];
+		  e[o[0]] = px;
+		  break;
+	       case XBR_LEFT:
+		  e[o[1]] = blend(e[o[1]], px, 12);
+		  e[o[3]] = blend(e[o[3]], px, 4);
+		  e[o[2]] = blend(e[o[2]], px, 4);
+		  e[o[0]] = px;
+		  break;
+	       case XBR_UP:
+		  e[o[3]] = blend(e[o[3]], px, 12);
+		  e[o[1]] = blend(e[o[1]], px, 4);
+		  e[o[4]] = blend(e[o[4]], px, 4);
+		  e[o[0]] = px;
+		  break;
+	       case XBR_DIAG:
+		  e[o[0]] = blend(e[o[0]], px, 14);
+		  e[o[3]] = blend(e[o[3]], px, 2);
+		  e[o[1]] = blend(e[o[1]], px, 2);
+		  break;
+	       default:
+		  e[o[0]] = blend(e[o[0]], px, 8);
+	       }
+	    }
+	 }
+      }
+      for (k=0; k<nb; k++)
+	 dst[(k/scale)*ow + k%scale] = e[k];
+   }
+}
+
+/******************************************************************************/
+/*                                                                            */
+/*                                    BANDS                                   */
+/*                                                                            */
+/******************************************************************************/
+
+#define MAX_ROWS 5
+
+static void hqx_band(int start, int end, void *param)
+{
+   const HQX_JOB *job = (const HQX_JOB*)param;
+   const int r = (job->filter == HQX_XBR ? 2 : 1), rows = 2*r+1;
+   const int stride = job->w + 2*r + 4; // sse2 reads a few pixels after w+r
+   const int ow = job->w * job->scale, bpp = fmt_bpp/8;
+   UINT32 *buf,*rgb[MAX_ROWS],*yuv[MAX_ROWS],*out;
+   int line[MAX_ROWS],y,k,l;
+   UINT8 *pat;
+
+   buf = malloc((stride*rows*2 + ow*job->scale)*sizeof(UINT32) + job->w);
+   if (!buf)
+      return;
+   out = buf + stride*rows*2;
+   pat = (UINT8*)(out + ow*job->scale);
+   for (k=0; k<rows; k++)
+      line[k] = -1;		// nothing converted
+
+   for (y=start; y<end; y++) {
+      // the slots are by line modulo rows, each line is converted once
+      for (k=0; k<rows; k++) {
+	 l = y - r + k;
+	 if (l < 0) l = 0;
+	 if (l >= job->h) l = job->h - 1;
+	 rgb[k] = buf + (l % rows)*stride + r;
+	 yuv[k] = rgb[k] + stride*rows;
+	 if (line[l % rows] != l) {
+	    convert_row(job, l, r, rgb[k], yuv[k]);
+	    line[l % rows] = l;
+	 }
+      }
+      if (job->filter == HQX_XBR)
+	 xbr_line(job, rgb, yuv, out);
+      else
+	 hq_line(job, rgb, yuv, pat, out);
+      for (k=0; k<job->scale; k++)
+	 store_row(out + k*ow,
+		   job->dest->line[job->d_y + y*job->scale + k] + job->d_x*bpp, ow);
+   }
+   free(buf);
+}
+
+void hqx_blit(int filter, int scale, BITMAP *src, BITMAP *dest, int s_x, int s_y, int d_x, int d_y, int w, int h)
+{
+   HQX_JOB job;
+
+   if (!fmt_bpp || d_y >= dest->h) return;
+   h = MIN(h,(dest->h - d_y)/scale);
+   if (w <= 0 || h <= 0) return;
+
+   job.filter = filter;
+   job.scale = scale;
+   job.src = src;
+   job.dest = dest;
+   job.s_x = s_x;
+   job.s_y = s_y;
+   job.d_x = d_x;
+   job.d_y = d_y;
+   job.w = w;
+   job.h = h;
+   render_bands(hqx_band, &job, 0, h);
+}
@@ -0,0 +1,34 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_HQX_H
+#define VIDEO_HQX_H
+
+#include "raine.h"
+
+/*
+  Portable hq2x/hq3x and xBR scalers (hqx.c), for 15, 16 and 32bpp bitmaps
+  with the same format for the source and the destination.
+
+  hq2x/hq3x use the rules of MaxSt's asm filters (hq2x16.asm, hq3x16.asm)
+  turned into tables, xBR is the 2xBR/3xBR filter of Hyllian. The pixels are
+  blended with 8 bits per component, the differences of colour are tested
+  in yuv, with sse2 when the cpu has it. The lines are split in bands drawn
+  by the render threads (bands.h).
+*/
+
+#define HQX_HQ 0		// hq2x/hq3x
+#define HQX_XBR 1		// 2xBR/3xBR
+
+// Format of the bitmaps : bpp and the masks of the components
+void hqx_format(int bpp, UINT32 rmask, UINT32 gmask, UINT32 bmask);
+
+// scale : 2 or 3
+void hqx_blit(int filter, int scale, BITMAP *src, BITMAP *dest, int s_x, int s_y, int d_x, int d_y, int w, int h);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
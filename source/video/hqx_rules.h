@@ -0,0 +1,582 @@
+/* Generated by bonus/hqx_rules.pl from hq2x16.asm and hq3x16.asm */
+
+static const HQX_OP hqx_ops[57] =
+{
+   { { 16, 0, 0 }, { 5,5,5 } },
+   { { 12, 4, 0 }, { 5,1,5 } },
+   { { 12, 4, 0 }, { 5,4,5 } },
+   { { 12, 4, 0 }, { 5,2,5 } },
+   { {  8, 4, 4 }, { 5,4,2 } },
+   { {  8, 4, 4 }, { 5,1,2 } },
+   { {  8, 4, 4 }, { 5,1,4 } },
+   { { 10, 4, 2 }, { 5,2,4 } },
+   { { 10, 4, 2 }, { 5,4,2 } },
+   { { 12, 2, 2 }, { 5,4,2 } },
+   { {  4, 6, 6 }, { 5,4,2 } },
+   { { 14, 1, 1 }, { 5,4,2 } },
+   { { 12, 4, 0 }, { 5,3,5 } },
+   { { 12, 4, 0 }, { 5,6,5 } },
+   { {  8, 4, 4 }, { 5,2,6 } },
+   { {  8, 4, 4 }, { 5,3,6 } },
+   { {  8, 4, 4 }, { 5,3,2 } },
+   { { 10, 4, 2 }, { 5,6,2 } },
+   { { 10, 4, 2 }, { 5,2,6 } },
+   { { 12, 2, 2 }, { 5,2,6 } },
+   { {  4, 6, 6 }, { 5,2,6 } },
+   { { 14, 1, 1 }, { 5,2,6 } },
+   { { 12, 4, 0 }, { 5,7,5 } },
+   { { 12, 4, 0 }, { 5,8,5 } },
+   { {  8, 4, 4 }, { 5,8,4 } },
+   { {  8, 4, 4 }, { 5,7,4 } },
+   { {  8, 4, 4 }, { 5,7,8 } },
+   { { 10, 4, 2 }, { 5,4,8 } },
+   { { 10, 4, 2 }, { 5,8,4 } },
+   { { 12, 2, 2 }, { 5,8,4 } },
+   { {  4, 6, 6 }, { 5,8,4 } },
+   { { 14, 1, 1 }, { 5,8,4 } },
+   { { 12, 4, 0 }, { 5,9,5 } },
+   { {  8, 4, 4 }, { 5,6,8 } },
+   { {  8, 4, 4 }, { 5,9,8 } },
+   { {  8, 4, 4 }, { 5,9,6 } },
+   { { 10, 4, 2 }, { 5,8,6 } },
+   { { 10, 4, 2 }, { 5,6,8 } },
+   { { 12, 2, 2 }, { 5,6,8 } },
+   { {  4, 6, 6 }, { 5,6,8 } },
+   { { 14, 1, 1 }, { 5,6,8 } },
+   { {  2, 7, 7 }, { 5,4,2 } },
+   { {  8, 8, 0 }, { 4,2,5 } },
+   { { 14, 2, 0 }, { 5,2,5 } },
+   { { 12, 4, 0 }, { 2,5,5 } },
+   { {  2, 7, 7 }, { 5,2,6 } },
+   { {  8, 8, 0 }, { 2,6,5 } },
+   { { 14, 2, 0 }, { 5,4,5 } },
+   { { 12, 4, 0 }, { 4,5,5 } },
+   { { 14, 2, 0 }, { 5,6,5 } },
+   { { 12, 4, 0 }, { 6,5,5 } },
+   { {  2, 7, 7 }, { 5,8,4 } },
+   { {  8, 8, 0 }, { 8,4,5 } },
+   { { 14, 2, 0 }, { 5,8,5 } },
+   { { 12, 4, 0 }, { 8,5,5 } },
+   { {  2, 7, 7 }, { 5,6,8 } },
+   { {  8, 8, 0 }, { 6,8,5 } },
+};
+
+static const HQX_RULE hq2x_rules[256][4] =
+{
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 0
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 1
+   { {0,6,6}, {0,15,15}, {0,24,24}, {0,33,33} }, // 2
+   { {0,2,2}, {0,15,15}, {0,24,24}, {0,33,33} }, // 3
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 4
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 5
+   { {0,6,6}, {0,13,13}, {0,24,24}, {0,33,33} }, // 6
+   { {0,2,2}, {0,13,13}, {0,24,24}, {0,33,33} }, // 7
+   { {0,5,5}, {0,14,14}, {0,26,26}, {0,33,33} }, // 8
+   { {0,3,3}, {0,14,14}, {0,26,26}, {0,33,33} }, // 9
+   { {4,1,4}, {0,15,15}, {0,26,26}, {0,33,33} }, // 10
+   { {4,0,4}, {0,15,15}, {0,26,26}, {0,33,33} }, // 11
+   { {0,5,5}, {0,14,14}, {0,26,26}, {0,33,33} }, // 12
+   { {0,3,3}, {0,14,14}, {0,26,26}, {0,33,33} }, // 13
+   { {4,1,10}, {4,13,18}, {0,26,26}, {0,33,33} }, // 14
+   { {4,0,10}, {4,13,18}, {0,26,26}, {0,33,33} }, // 15
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,34,34} }, // 16
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,34,34} }, // 17
+   { {0,6,6}, {1,12,14}, {0,24,24}, {0,34,34} }, // 18
+   { {1,2,7}, {1,12,20}, {0,24,24}, {0,34,34} }, // 19
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,34,34} }, // 20
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,34,34} }, // 21
+   { {0,6,6}, {1,0,14}, {0,24,24}, {0,34,34} }, // 22
+   { {1,2,7}, {1,0,20}, {0,24,24}, {0,34,34} }, // 23
+   { {0,5,5}, {0,16,16}, {0,26,26}, {0,34,34} }, // 24
+   { {0,3,3}, {0,16,16}, {0,26,26}, {0,34,34} }, // 25
+   { {4,0,4}, {1,0,14}, {0,26,26}, {0,34,34} }, // 26
+   { {4,0,4}, {0,12,12}, {0,26,26}, {0,34,34} }, // 27
+   { {0,5,5}, {0,3,3}, {0,26,26}, {0,34,34} }, // 28
+   { {0,3,3}, {0,3,3}, {0,26,26}, {0,34,34} }, // 29
+   { {0,1,1}, {1,0,14}, {0,26,26}, {0,34,34} }, // 30
+   { {4,0,4}, {1,0,14}, {0,26,26}, {0,34,34} }, // 31
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 32
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 33
+   { {0,6,6}, {0,15,15}, {0,24,24}, {0,33,33} }, // 34
+   { {0,2,2}, {0,15,15}, {0,24,24}, {0,33,33} }, // 35
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 36
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 37
+   { {0,6,6}, {0,13,13}, {0,24,24}, {0,33,33} }, // 38
+   { {0,2,2}, {0,13,13}, {0,24,24}, {0,33,33} }, // 39
+   { {0,5,5}, {0,14,14}, {0,23,23}, {0,33,33} }, // 40
+   { {0,3,3}, {0,14,14}, {0,23,23}, {0,33,33} }, // 41
+   { {4,1,10}, {0,15,15}, {4,23,27}, {0,33,33} }, // 42
+   { {4,0,10}, {0,15,15}, {4,23,27}, {0,33,33} }, // 43
+   { {0,5,5}, {0,14,14}, {0,23,23}, {0,33,33} }, // 44
+   { {0,3,3}, {0,14,14}, {0,23,23}, {0,33,33} }, // 45
+   { {4,1,9}, {0,13,13}, {0,23,23}, {0,33,33} }, // 46
+   { {4,0,11}, {0,13,13}, {0,23,23}, {0,33,33} }, // 47
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,34,34} }, // 48
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,34,34} }, // 49
+   { {0,6,6}, {1,12,14}, {0,24,24}, {0,34,34} }, // 50
+   { {1,2,7}, {1,12,20}, {0,24,24}, {0,34,34} }, // 51
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,34,34} }, // 52
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,34,34} }, // 53
+   { {0,6,6}, {1,0,14}, {0,24,24}, {0,34,34} }, // 54
+   { {1,2,7}, {1,0,20}, {0,24,24}, {0,34,34} }, // 55
+   { {0,5,5}, {0,16,16}, {0,23,23}, {0,34,34} }, // 56
+   { {0,3,3}, {0,16,16}, {0,23,23}, {0,34,34} }, // 57
+   { {4,1,9}, {1,12,19}, {0,23,23}, {0,34,34} }, // 58
+   { {4,0,4}, {1,12,19}, {0,23,23}, {0,34,34} }, // 59
+   { {0,5,5}, {0,3,3}, {0,23,23}, {0,34,34} }, // 60
+   { {0,3,3}, {0,3,3}, {0,23,23}, {0,34,34} }, // 61
+   { {0,1,1}, {1,0,14}, {0,23,23}, {0,34,34} }, // 62
+   { {4,0,11}, {1,0,14}, {0,23,23}, {0,34,34} }, // 63
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,35,35} }, // 64
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,35,35} }, // 65
+   { {0,6,6}, {0,15,15}, {0,25,25}, {0,35,35} }, // 66
+   { {0,2,2}, {0,15,15}, {0,25,25}, {0,35,35} }, // 67
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,35,35} }, // 68
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,35,35} }, // 69
+   { {0,6,6}, {0,13,13}, {0,25,25}, {0,35,35} }, // 70
+   { {0,2,2}, {0,13,13}, {0,25,25}, {0,35,35} }, // 71
+   { {0,5,5}, {0,14,14}, {3,22,24}, {0,35,35} }, // 72
+   { {3,3,8}, {0,14,14}, {3,22,30}, {0,35,35} }, // 73
+   { {4,0,4}, {0,15,15}, {3,0,24}, {0,35,35} }, // 74
+   { {4,0,4}, {0,15,15}, {0,22,22}, {0,35,35} }, // 75
+   { {0,5,5}, {0,14,14}, {3,22,24}, {0,35,35} }, // 76
+   { {3,3,8}, {0,14,14}, {3,22,30}, {0,35,35} }, // 77
+   { {4,1,9}, {0,13,13}, {3,22,29}, {0,35,35} }, // 78
+   { {4,0,4}, {0,13,13}, {3,22,29}, {0,35,35} }, // 79
+   { {0,4,4}, {0,16,16}, {0,25,25}, {2,32,33} }, // 80
+   { {0,4,4}, {0,16,16}, {0,25,25}, {2,32,33} }, // 81
+   { {0,6,6}, {1,0,14}, {0,25,25}, {2,0,33} }, // 82
+   { {0,2,2}, {1,12,19}, {0,25,25}, {2,32,38} }, // 83
+   { {0,4,4}, {2,3,17}, {0,25,25}, {2,32,39} }, // 84
+   { {0,4,4}, {2,3,17}, {0,25,25}, {2,32,39} }, // 85
+   { {0,6,6}, {1,0,14}, {0,25,25}, {0,32,32} }, // 86
+   { {0,2,2}, {1,0,14}, {0,25,25}, {2,32,38} }, // 87
+   { {0,5,5}, {0,16,16}, {3,0,24}, {2,0,33} }, // 88
+   { {0,3,3}, {0,16,16}, {3,22,29}, {2,32,38} }, // 89
+   { {4,1,9}, {1,12,19}, {3,22,29}, {2,32,38} }, // 90
+   { {4,0,4}, {1,12,19}, {3,22,29}, {2,32,38} }, // 91
+   { {0,5,5}, {0,3,3}, {3,22,29}, {2,32,38} }, // 92
+   { {0,3,3}, {0,3,3}, {3,22,29}, {2,32,38} }, // 93
+   { {4,1,9}, {1,0,14}, {3,22,29}, {2,32,38} }, // 94
+   { {4,0,4}, {1,0,14}, {0,22,22}, {0,32,32} }, // 95
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,35,35} }, // 96
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,35,35} }, // 97
+   { {0,6,6}, {0,15,15}, {0,2,2}, {0,35,35} }, // 98
+   { {0,2,2}, {0,15,15}, {0,2,2}, {0,35,35} }, // 99
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,35,35} }, // 100
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,35,35} }, // 101
+   { {0,6,6}, {0,13,13}, {0,2,2}, {0,35,35} }, // 102
+   { {0,2,2}, {0,13,13}, {0,2,2}, {0,35,35} }, // 103
+   { {0,5,5}, {0,14,14}, {3,0,24}, {0,35,35} }, // 104
+   { {3,3,8}, {0,14,14}, {3,0,30}, {0,35,35} }, // 105
+   { {0,1,1}, {0,15,15}, {3,0,24}, {0,35,35} }, // 106
+   { {4,0,4}, {0,15,15}, {3,0,24}, {0,35,35} }, // 107
+   { {0,5,5}, {0,14,14}, {3,0,24}, {0,35,35} }, // 108
+   { {3,3,8}, {0,14,14}, {3,0,30}, {0,35,35} }, // 109
+   { {0,1,1}, {0,13,13}, {3,0,24}, {0,35,35} }, // 110
+   { {4,0,11}, {0,13,13}, {3,0,24}, {0,35,35} }, // 111
+   { {0,4,4}, {0,16,16}, {2,2,28}, {2,32,39} }, // 112
+   { {0,4,4}, {0,16,16}, {2,2,28}, {2,32,39} }, // 113
+   { {0,6,6}, {1,12,19}, {0,2,2}, {2,32,38} }, // 114
+   { {0,2,2}, {1,12,19}, {0,2,2}, {2,32,38} }, // 115
+   { {0,4,4}, {0,3,3}, {0,2,2}, {2,32,38} }, // 116
+   { {0,4,4}, {0,3,3}, {0,2,2}, {2,32,38} }, // 117
+   { {0,6,6}, {1,0,14}, {0,2,2}, {0,32,32} }, // 118
+   { {1,2,7}, {1,0,20}, {0,2,2}, {0,32,32} }, // 119
+   { {0,5,5}, {0,16,16}, {3,0,24}, {0,32,32} }, // 120
+   { {0,3,3}, {0,16,16}, {3,0,24}, {2,32,38} }, // 121
+   { {4,1,9}, {1,12,19}, {3,0,24}, {2,32,38} }, // 122
+   { {4,0,4}, {0,12,12}, {3,0,24}, {0,32,32} }, // 123
+   { {0,5,5}, {0,3,3}, {3,0,24}, {0,32,32} }, // 124
+   { {3,3,8}, {0,3,3}, {3,0,30}, {0,32,32} }, // 125
+   { {0,1,1}, {1,0,14}, {3,0,24}, {0,32,32} }, // 126
+   { {4,0,11}, {1,0,14}, {3,0,24}, {0,32,32} }, // 127
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 128
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 129
+   { {0,6,6}, {0,15,15}, {0,24,24}, {0,33,33} }, // 130
+   { {0,2,2}, {0,15,15}, {0,24,24}, {0,33,33} }, // 131
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 132
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 133
+   { {0,6,6}, {0,13,13}, {0,24,24}, {0,33,33} }, // 134
+   { {0,2,2}, {0,13,13}, {0,24,24}, {0,33,33} }, // 135
+   { {0,5,5}, {0,14,14}, {0,26,26}, {0,33,33} }, // 136
+   { {0,3,3}, {0,14,14}, {0,26,26}, {0,33,33} }, // 137
+   { {4,1,4}, {0,15,15}, {0,26,26}, {0,33,33} }, // 138
+   { {4,0,4}, {0,15,15}, {0,26,26}, {0,33,33} }, // 139
+   { {0,5,5}, {0,14,14}, {0,26,26}, {0,33,33} }, // 140
+   { {0,3,3}, {0,14,14}, {0,26,26}, {0,33,33} }, // 141
+   { {4,1,10}, {4,13,18}, {0,26,26}, {0,33,33} }, // 142
+   { {4,0,10}, {4,13,18}, {0,26,26}, {0,33,33} }, // 143
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,23,23} }, // 144
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,23,23} }, // 145
+   { {0,6,6}, {1,12,20}, {0,24,24}, {1,23,37} }, // 146
+   { {0,2,2}, {1,12,19}, {0,24,24}, {0,23,23} }, // 147
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,23,23} }, // 148
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,23,23} }, // 149
+   { {0,6,6}, {1,0,20}, {0,24,24}, {1,23,37} }, // 150
+   { {0,2,2}, {1,0,21}, {0,24,24}, {0,23,23} }, // 151
+   { {0,5,5}, {0,16,16}, {0,26,26}, {0,23,23} }, // 152
+   { {0,3,3}, {0,16,16}, {0,26,26}, {0,23,23} }, // 153
+   { {4,1,9}, {1,12,19}, {0,26,26}, {0,23,23} }, // 154
+   { {4,0,4}, {0,12,12}, {0,26,26}, {0,23,23} }, // 155
+   { {0,5,5}, {0,3,3}, {0,26,26}, {0,23,23} }, // 156
+   { {0,3,3}, {0,3,3}, {0,26,26}, {0,23,23} }, // 157
+   { {4,1,9}, {1,0,14}, {0,26,26}, {0,23,23} }, // 158
+   { {4,0,4}, {1,0,21}, {0,26,26}, {0,23,23} }, // 159
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 160
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 161
+   { {0,6,6}, {0,15,15}, {0,24,24}, {0,33,33} }, // 162
+   { {0,2,2}, {0,15,15}, {0,24,24}, {0,33,33} }, // 163
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 164
+   { {0,4,4}, {0,14,14}, {0,24,24}, {0,33,33} }, // 165
+   { {0,6,6}, {0,13,13}, {0,24,24}, {0,33,33} }, // 166
+   { {0,2,2}, {0,13,13}, {0,24,24}, {0,33,33} }, // 167
+   { {0,5,5}, {0,14,14}, {0,23,23}, {0,33,33} }, // 168
+   { {0,3,3}, {0,14,14}, {0,23,23}, {0,33,33} }, // 169
+   { {4,1,10}, {0,15,15}, {4,23,27}, {0,33,33} }, // 170
+   { {4,0,10}, {0,15,15}, {4,23,27}, {0,33,33} }, // 171
+   { {0,5,5}, {0,14,14}, {0,23,23}, {0,33,33} }, // 172
+   { {0,3,3}, {0,14,14}, {0,23,23}, {0,33,33} }, // 173
+   { {4,1,9}, {0,13,13}, {0,23,23}, {0,33,33} }, // 174
+   { {4,0,11}, {0,13,13}, {0,23,23}, {0,33,33} }, // 175
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,23,23} }, // 176
+   { {0,4,4}, {0,16,16}, {0,24,24}, {0,23,23} }, // 177
+   { {0,6,6}, {1,12,20}, {0,24,24}, {1,23,37} }, // 178
+   { {0,2,2}, {1,12,19}, {0,24,24}, {0,23,23} }, // 179
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,23,23} }, // 180
+   { {0,4,4}, {0,3,3}, {0,24,24}, {0,23,23} }, // 181
+   { {0,6,6}, {1,0,20}, {0,24,24}, {1,23,37} }, // 182
+   { {0,2,2}, {1,0,21}, {0,24,24}, {0,23,23} }, // 183
+   { {0,5,5}, {0,16,16}, {0,23,23}, {0,23,23} }, // 184
+   { {0,3,3}, {0,16,16}, {0,23,23}, {0,23,23} }, // 185
+   { {4,1,9}, {1,12,19}, {0,23,23}, {0,23,23} }, // 186
+   { {4,0,10}, {0,12,12}, {4,23,27}, {0,23,23} }, // 187
+   { {0,5,5}, {0,3,3}, {0,23,23}, {0,23,23} }, // 188
+   { {0,3,3}, {0,3,3}, {0,23,23}, {0,23,23} }, // 189
+   { {0,1,1}, {1,0,20}, {0,23,23}, {1,23,37} }, // 190
+   { {4,0,11}, {1,0,21}, {0,23,23}, {0,23,23} }, // 191
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,13,13} }, // 192
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,13,13} }, // 193
+   { {0,6,6}, {0,15,15}, {0,25,25}, {0,13,13} }, // 194
+   { {0,2,2}, {0,15,15}, {0,25,25}, {0,13,13} }, // 195
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,13,13} }, // 196
+   { {0,4,4}, {0,14,14}, {0,25,25}, {0,13,13} }, // 197
+   { {0,6,6}, {0,13,13}, {0,25,25}, {0,13,13} }, // 198
+   { {0,2,2}, {0,13,13}, {0,25,25}, {0,13,13} }, // 199
+   { {0,5,5}, {0,14,14}, {3,22,30}, {3,13,36} }, // 200
+   { {0,3,3}, {0,14,14}, {3,22,29}, {0,13,13} }, // 201
+   { {4,1,9}, {0,15,15}, {3,22,29}, {0,13,13} }, // 202
+   { {4,0,4}, {0,15,15}, {0,22,22}, {0,13,13} }, // 203
+   { {0,5,5}, {0,14,14}, {3,22,30}, {3,13,36} }, // 204
+   { {0,3,3}, {0,14,14}, {3,22,29}, {0,13,13} }, // 205
+   { {4,1,9}, {0,13,13}, {3,22,29}, {0,13,13} }, // 206
+   { {4,0,10}, {4,13,18}, {0,22,22}, {0,13,13} }, // 207
+   { {0,4,4}, {0,16,16}, {0,25,25}, {2,0,33} }, // 208
+   { {0,4,4}, {0,16,16}, {0,25,25}, {2,0,33} }, // 209
+   { {0,6,6}, {0,12,12}, {0,25,25}, {2,0,33} }, // 210
+   { {0,2,2}, {0,12,12}, {0,25,25}, {2,0,33} }, // 211
+   { {0,4,4}, {2,3,17}, {0,25,25}, {2,0,39} }, // 212
+   { {0,4,4}, {2,3,17}, {0,25,25}, {2,0,39} }, // 213
+   { {0,6,6}, {1,0,14}, {0,25,25}, {2,0,33} }, // 214
+   { {0,2,2}, {1,0,21}, {0,25,25}, {2,0,33} }, // 215
+   { {0,5,5}, {0,16,16}, {0,22,22}, {2,0,33} }, // 216
+   { {0,3,3}, {0,16,16}, {0,22,22}, {2,0,33} }, // 217
+   { {4,1,9}, {1,12,19}, {3,22,29}, {2,0,33} }, // 218
+   { {4,0,4}, {0,12,12}, {0,22,22}, {2,0,33} }, // 219
+   { {0,5,5}, {0,3,3}, {3,22,29}, {2,0,33} }, // 220
+   { {0,3,3}, {2,3,17}, {0,22,22}, {2,0,39} }, // 221
+   { {0,1,1}, {1,0,14}, {0,22,22}, {2,0,33} }, // 222
+   { {4,0,4}, {1,0,21}, {0,22,22}, {2,0,33} }, // 223
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,13,13} }, // 224
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,13,13} }, // 225
+   { {0,6,6}, {0,15,15}, {0,2,2}, {0,13,13} }, // 226
+   { {0,2,2}, {0,15,15}, {0,2,2}, {0,13,13} }, // 227
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,13,13} }, // 228
+   { {0,4,4}, {0,14,14}, {0,2,2}, {0,13,13} }, // 229
+   { {0,6,6}, {0,13,13}, {0,2,2}, {0,13,13} }, // 230
+   { {0,2,2}, {0,13,13}, {0,2,2}, {0,13,13} }, // 231
+   { {0,5,5}, {0,14,14}, {3,0,30}, {3,13,36} }, // 232
+   { {0,3,3}, {0,14,14}, {3,0,31}, {0,13,13} }, // 233
+   { {4,1,9}, {0,15,15}, {3,0,24}, {0,13,13} }, // 234
+   { {4,0,4}, {0,15,15}, {3,0,31}, {0,13,13} }, // 235
+   { {0,5,5}, {0,14,14}, {3,0,30}, {3,13,36} }, // 236
+   { {0,3,3}, {0,14,14}, {3,0,31}, {0,13,13} }, // 237
+   { {0,1,1}, {0,13,13}, {3,0,30}, {3,13,36} }, // 238
+   { {4,0,11}, {0,13,13}, {3,0,31}, {0,13,13} }, // 239
+   { {0,4,4}, {0,16,16}, {2,2,28}, {2,0,39} }, // 240
+   { {0,4,4}, {0,16,16}, {2,2,28}, {2,0,39} }, // 241
+   { {0,6,6}, {1,12,19}, {0,2,2}, {2,0,33} }, // 242
+   { {0,2,2}, {0,12,12}, {2,2,28}, {2,0,39} }, // 243
+   { {0,4,4}, {0,3,3}, {0,2,2}, {2,0,40} }, // 244
+   { {0,4,4}, {0,3,3}, {0,2,2}, {2,0,40} }, // 245
+   { {0,6,6}, {1,0,14}, {0,2,2}, {2,0,40} }, // 246
+   { {0,2,2}, {1,0,21}, {0,2,2}, {2,0,40} }, // 247
+   { {0,5,5}, {0,16,16}, {3,0,24}, {2,0,33} }, // 248
+   { {0,3,3}, {0,16,16}, {3,0,31}, {2,0,33} }, // 249
+   { {0,1,1}, {0,12,12}, {3,0,24}, {2,0,33} }, // 250
+   { {4,0,4}, {0,12,12}, {3,0,31}, {2,0,33} }, // 251
+   { {0,5,5}, {0,3,3}, {3,0,24}, {2,0,40} }, // 252
+   { {0,3,3}, {0,3,3}, {3,0,31}, {2,0,40} }, // 253
+   { {0,1,1}, {1,0,14}, {3,0,24}, {2,0,40} }, // 254
+   { {4,0,11}, {1,0,21}, {3,0,31}, {2,0,40} }, // 255
+};
+
+static const HQX_RULE hq3x_rules[256][9] =
+{
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 0
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 1
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 2
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 3
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 4
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 5
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 6
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 7
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 8
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 9
+   { {4,1,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 10
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 11
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 12
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 13
+   { {4,1,42}, {4,0,44}, {4,13,14}, {4,0,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 14
+   { {4,0,42}, {4,0,44}, {4,13,14}, {4,0,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 15
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 16
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 17
+   { {0,1,1}, {1,0,43}, {1,12,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,24,24}, {0,23,23}, {0,32,32} }, // 18
+   { {1,2,4}, {1,0,44}, {1,12,46}, {0,2,2}, {0,0,0}, {1,0,13}, {0,24,24}, {0,23,23}, {0,32,32} }, // 19
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 20
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 21
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,24,24}, {0,23,23}, {0,32,32} }, // 22
+   { {1,2,4}, {1,0,44}, {1,0,46}, {0,2,2}, {0,0,0}, {1,0,13}, {0,24,24}, {0,23,23}, {0,32,32} }, // 23
+   { {0,1,1}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,32,32} }, // 24
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,32,32} }, // 25
+   { {4,0,41}, {0,0,0}, {1,0,45}, {4,0,47}, {0,0,0}, {1,0,49}, {0,22,22}, {0,23,23}, {0,32,32} }, // 26
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,32,32} }, // 27
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,32,32} }, // 28
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,32,32} }, // 29
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,0,0}, {0,0,0}, {1,0,49}, {0,22,22}, {0,23,23}, {0,32,32} }, // 30
+   { {4,0,41}, {0,0,0}, {1,0,45}, {4,0,47}, {0,0,0}, {1,0,49}, {0,22,22}, {0,23,23}, {0,32,32} }, // 31
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 32
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 33
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 34
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 35
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 36
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 37
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 38
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 39
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 40
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 41
+   { {4,1,42}, {4,0,3}, {0,12,12}, {4,0,48}, {0,0,0}, {0,13,13}, {4,23,24}, {0,23,23}, {0,33,33} }, // 42
+   { {4,0,42}, {4,0,3}, {0,12,12}, {4,0,48}, {0,0,0}, {0,13,13}, {4,23,24}, {0,23,23}, {0,33,33} }, // 43
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 44
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 45
+   { {4,1,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 46
+   { {4,0,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 47
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 48
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 49
+   { {0,1,1}, {1,0,43}, {1,12,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,24,24}, {0,23,23}, {0,32,32} }, // 50
+   { {1,2,4}, {1,0,44}, {1,12,46}, {0,2,2}, {0,0,0}, {1,0,13}, {0,24,24}, {0,23,23}, {0,32,32} }, // 51
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 52
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,32,32} }, // 53
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,24,24}, {0,23,23}, {0,32,32} }, // 54
+   { {1,2,4}, {1,0,44}, {1,0,46}, {0,2,2}, {0,0,0}, {1,0,13}, {0,24,24}, {0,23,23}, {0,32,32} }, // 55
+   { {0,1,1}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 56
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 57
+   { {4,1,4}, {0,0,0}, {1,12,14}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 58
+   { {4,0,41}, {4,0,43}, {1,12,14}, {4,0,47}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 59
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 60
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,32,32} }, // 61
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,0,0}, {0,0,0}, {1,0,49}, {0,23,23}, {0,23,23}, {0,32,32} }, // 62
+   { {4,0,4}, {0,0,0}, {1,0,45}, {0,0,0}, {0,0,0}, {1,0,49}, {0,23,23}, {0,23,23}, {0,32,32} }, // 63
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 64
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 65
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 66
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 67
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 68
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 69
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 70
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 71
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,47}, {0,0,0}, {0,13,13}, {3,22,51}, {3,0,53}, {0,32,32} }, // 72
+   { {3,3,4}, {0,3,3}, {0,14,14}, {3,0,48}, {0,0,0}, {0,13,13}, {3,22,52}, {3,0,23}, {0,32,32} }, // 73
+   { {4,0,41}, {4,0,43}, {0,12,12}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 74
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,32,32} }, // 75
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,47}, {0,0,0}, {0,13,13}, {3,22,51}, {3,0,53}, {0,32,32} }, // 76
+   { {3,3,4}, {0,3,3}, {0,14,14}, {3,0,48}, {0,0,0}, {0,13,13}, {3,22,52}, {3,0,23}, {0,32,32} }, // 77
+   { {4,1,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,32,32} }, // 78
+   { {4,0,41}, {4,0,43}, {0,13,13}, {4,0,47}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,32,32} }, // 79
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,32,55} }, // 80
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,32,55} }, // 81
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {0,0,0}, {0,22,22}, {2,0,53}, {2,0,55} }, // 82
+   { {0,2,2}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,22,22}, {0,0,0}, {2,32,33} }, // 83
+   { {0,4,4}, {0,3,3}, {2,3,14}, {0,2,2}, {0,0,0}, {2,0,50}, {0,22,22}, {2,0,23}, {2,32,56} }, // 84
+   { {0,4,4}, {0,3,3}, {2,3,14}, {0,2,2}, {0,0,0}, {2,0,50}, {0,22,22}, {2,0,23}, {2,32,56} }, // 85
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,22,22}, {0,0,0}, {0,32,32} }, // 86
+   { {0,2,2}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,22,22}, {0,0,0}, {2,32,33} }, // 87
+   { {0,1,1}, {0,3,3}, {0,12,12}, {3,0,47}, {0,0,0}, {2,0,49}, {3,0,51}, {0,0,0}, {2,0,55} }, // 88
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {3,22,24}, {0,0,0}, {2,32,33} }, // 89
+   { {4,1,4}, {0,0,0}, {1,12,14}, {0,0,0}, {0,0,0}, {0,0,0}, {3,22,24}, {0,0,0}, {2,32,33} }, // 90
+   { {4,0,41}, {4,0,43}, {1,12,14}, {4,0,47}, {0,0,0}, {0,0,0}, {3,22,24}, {0,0,0}, {2,32,33} }, // 91
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {3,22,24}, {0,0,0}, {2,32,33} }, // 92
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {3,22,24}, {0,0,0}, {2,32,33} }, // 93
+   { {4,1,4}, {1,0,43}, {1,0,45}, {0,0,0}, {0,0,0}, {1,0,49}, {3,22,24}, {0,0,0}, {2,32,33} }, // 94
+   { {4,0,41}, {0,0,0}, {1,0,45}, {4,0,47}, {0,0,0}, {1,0,49}, {0,22,22}, {0,0,0}, {0,32,32} }, // 95
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 96
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 97
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 98
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 99
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 100
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 101
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 102
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 103
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,47}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 104
+   { {3,3,4}, {0,3,3}, {0,14,14}, {3,0,48}, {0,0,0}, {0,13,13}, {3,0,52}, {3,0,23}, {0,32,32} }, // 105
+   { {0,1,1}, {0,0,0}, {0,12,12}, {3,0,47}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 106
+   { {4,0,41}, {4,0,43}, {0,12,12}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 107
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,47}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 108
+   { {3,3,4}, {0,3,3}, {0,14,14}, {3,0,48}, {0,0,0}, {0,13,13}, {3,0,52}, {3,0,23}, {0,32,32} }, // 109
+   { {0,1,1}, {0,0,0}, {0,13,13}, {3,0,47}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 110
+   { {4,0,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,32,32} }, // 111
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,13}, {2,2,24}, {2,0,54}, {2,32,56} }, // 112
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,13}, {2,2,24}, {2,0,54}, {2,32,56} }, // 113
+   { {0,1,1}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,32,33} }, // 114
+   { {0,2,2}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,32,33} }, // 115
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,32,33} }, // 116
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,32,33} }, // 117
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {1,0,49}, {0,2,2}, {0,0,0}, {0,32,32} }, // 118
+   { {1,2,4}, {1,0,44}, {1,0,46}, {0,2,2}, {0,0,0}, {1,0,13}, {0,2,2}, {0,0,0}, {0,32,32} }, // 119
+   { {0,1,1}, {0,3,3}, {0,12,12}, {3,0,47}, {0,0,0}, {0,0,0}, {3,0,51}, {3,0,53}, {0,32,32} }, // 120
+   { {0,3,3}, {0,3,3}, {0,12,12}, {3,0,47}, {0,0,0}, {0,0,0}, {3,0,51}, {3,0,53}, {2,32,33} }, // 121
+   { {4,1,4}, {0,0,0}, {1,12,14}, {3,0,47}, {0,0,0}, {0,0,0}, {3,0,51}, {3,0,53}, {2,32,33} }, // 122
+   { {4,0,41}, {4,0,43}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {3,0,51}, {3,0,53}, {0,32,32} }, // 123
+   { {0,1,1}, {0,3,3}, {0,3,3}, {3,0,47}, {0,0,0}, {0,0,0}, {3,0,51}, {3,0,53}, {0,32,32} }, // 124
+   { {3,3,4}, {0,3,3}, {0,3,3}, {3,0,48}, {0,0,0}, {0,0,0}, {3,0,52}, {3,0,23}, {0,32,32} }, // 125
+   { {0,1,1}, {1,0,43}, {1,0,45}, {3,0,47}, {0,0,0}, {1,0,49}, {3,0,51}, {3,0,53}, {0,32,32} }, // 126
+   { {4,0,4}, {4,0,43}, {1,0,45}, {4,0,47}, {0,0,0}, {1,0,49}, {3,0,51}, {3,0,53}, {0,32,32} }, // 127
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 128
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 129
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 130
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 131
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 132
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 133
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 134
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 135
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 136
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 137
+   { {4,1,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 138
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 139
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 140
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 141
+   { {4,1,42}, {4,0,44}, {4,13,14}, {4,0,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 142
+   { {4,0,42}, {4,0,44}, {4,13,14}, {4,0,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,23,23}, {0,33,33} }, // 143
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 144
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 145
+   { {0,1,1}, {1,0,3}, {1,12,46}, {0,2,2}, {0,0,0}, {1,0,50}, {0,24,24}, {0,23,23}, {1,23,33} }, // 146
+   { {0,2,2}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 147
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 148
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 149
+   { {0,1,1}, {1,0,3}, {1,0,46}, {0,2,2}, {0,0,0}, {1,0,50}, {0,24,24}, {0,23,23}, {1,23,33} }, // 150
+   { {0,2,2}, {0,0,0}, {1,0,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 151
+   { {0,1,1}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 152
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 153
+   { {4,1,4}, {0,0,0}, {1,12,14}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 154
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 155
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 156
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 157
+   { {4,1,4}, {1,0,43}, {1,0,45}, {0,0,0}, {0,0,0}, {1,0,49}, {0,22,22}, {0,23,23}, {0,23,23} }, // 158
+   { {4,0,41}, {0,0,0}, {1,0,14}, {4,0,47}, {0,0,0}, {0,0,0}, {0,22,22}, {0,23,23}, {0,23,23} }, // 159
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 160
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 161
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 162
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 163
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 164
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 165
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 166
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,24,24}, {0,23,23}, {0,33,33} }, // 167
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 168
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 169
+   { {4,1,42}, {4,0,3}, {0,12,12}, {4,0,48}, {0,0,0}, {0,13,13}, {4,23,24}, {0,23,23}, {0,33,33} }, // 170
+   { {4,0,42}, {4,0,3}, {0,12,12}, {4,0,48}, {0,0,0}, {0,13,13}, {4,23,24}, {0,23,23}, {0,33,33} }, // 171
+   { {0,1,1}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 172
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 173
+   { {4,1,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 174
+   { {4,0,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {0,23,23}, {0,23,23}, {0,33,33} }, // 175
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 176
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 177
+   { {0,1,1}, {1,0,3}, {1,12,46}, {0,2,2}, {0,0,0}, {1,0,50}, {0,24,24}, {0,23,23}, {1,23,33} }, // 178
+   { {0,2,2}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 179
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 180
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 181
+   { {0,1,1}, {1,0,3}, {1,0,46}, {0,2,2}, {0,0,0}, {1,0,50}, {0,24,24}, {0,23,23}, {1,23,33} }, // 182
+   { {0,2,2}, {0,0,0}, {1,0,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,24,24}, {0,23,23}, {0,23,23} }, // 183
+   { {0,1,1}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 184
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 185
+   { {4,1,4}, {0,0,0}, {1,12,14}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 186
+   { {4,0,42}, {4,0,3}, {0,12,12}, {4,0,48}, {0,0,0}, {0,0,0}, {4,23,24}, {0,23,23}, {0,23,23} }, // 187
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 188
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 189
+   { {0,1,1}, {1,0,3}, {1,0,46}, {0,0,0}, {0,0,0}, {1,0,50}, {0,23,23}, {0,23,23}, {1,23,33} }, // 190
+   { {4,0,4}, {0,0,0}, {1,0,14}, {0,0,0}, {0,0,0}, {0,0,0}, {0,23,23}, {0,23,23}, {0,23,23} }, // 191
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 192
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 193
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 194
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 195
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 196
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 197
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 198
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 199
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,2}, {0,0,0}, {0,13,13}, {3,22,52}, {3,0,54}, {3,13,33} }, // 200
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,13,13} }, // 201
+   { {4,1,4}, {0,0,0}, {0,12,12}, {0,0,0}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,13,13} }, // 202
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 203
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,2}, {0,0,0}, {0,13,13}, {3,22,52}, {3,0,54}, {3,13,33} }, // 204
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,13,13} }, // 205
+   { {4,1,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {3,22,24}, {0,0,0}, {0,13,13} }, // 206
+   { {4,0,42}, {4,0,44}, {4,13,14}, {4,0,2}, {0,0,0}, {0,13,13}, {0,22,22}, {0,0,0}, {0,13,13} }, // 207
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 208
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 209
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 210
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 211
+   { {0,4,4}, {0,3,3}, {2,3,14}, {0,2,2}, {0,0,0}, {2,0,50}, {0,22,22}, {2,0,23}, {2,0,56} }, // 212
+   { {0,4,4}, {0,3,3}, {2,3,14}, {0,2,2}, {0,0,0}, {2,0,50}, {0,22,22}, {2,0,23}, {2,0,56} }, // 213
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {0,0,0}, {0,22,22}, {2,0,53}, {2,0,55} }, // 214
+   { {0,2,2}, {0,0,0}, {1,0,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,22,22}, {2,0,53}, {2,0,55} }, // 215
+   { {0,1,1}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 216
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 217
+   { {4,1,4}, {0,0,0}, {1,12,14}, {0,0,0}, {0,0,0}, {2,0,49}, {3,22,24}, {2,0,53}, {2,0,55} }, // 218
+   { {4,0,41}, {4,0,43}, {0,12,12}, {4,0,47}, {0,0,0}, {2,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 219
+   { {0,1,1}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {2,0,49}, {3,22,24}, {2,0,53}, {2,0,55} }, // 220
+   { {0,3,3}, {0,3,3}, {2,3,14}, {0,0,0}, {0,0,0}, {2,0,50}, {0,22,22}, {2,0,23}, {2,0,56} }, // 221
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,0,0}, {0,0,0}, {0,0,0}, {0,22,22}, {2,0,53}, {2,0,55} }, // 222
+   { {4,0,41}, {1,0,43}, {1,0,14}, {4,0,47}, {0,0,0}, {1,0,49}, {0,22,22}, {2,0,53}, {2,0,55} }, // 223
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 224
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 225
+   { {0,1,1}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 226
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 227
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 228
+   { {0,4,4}, {0,3,3}, {0,14,14}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 229
+   { {0,1,1}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 230
+   { {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13}, {0,2,2}, {0,0,0}, {0,13,13} }, // 231
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,2}, {0,0,0}, {0,13,13}, {3,0,52}, {3,0,54}, {3,13,33} }, // 232
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,24}, {0,0,0}, {0,13,13} }, // 233
+   { {4,1,4}, {0,0,0}, {0,12,12}, {3,0,47}, {0,0,0}, {0,13,13}, {3,0,51}, {3,0,53}, {0,13,13} }, // 234
+   { {4,0,41}, {4,0,43}, {0,12,12}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,24}, {0,0,0}, {0,13,13} }, // 235
+   { {0,1,1}, {0,3,3}, {0,14,14}, {3,0,2}, {0,0,0}, {0,13,13}, {3,0,52}, {3,0,54}, {3,13,33} }, // 236
+   { {0,3,3}, {0,3,3}, {0,14,14}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,24}, {0,0,0}, {0,13,13} }, // 237
+   { {0,1,1}, {0,0,0}, {0,13,13}, {3,0,2}, {0,0,0}, {0,13,13}, {3,0,52}, {3,0,54}, {3,13,33} }, // 238
+   { {4,0,4}, {0,0,0}, {0,13,13}, {0,0,0}, {0,0,0}, {0,13,13}, {3,0,24}, {0,0,0}, {0,13,13} }, // 239
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,13}, {2,2,24}, {2,0,54}, {2,0,56} }, // 240
+   { {0,4,4}, {0,3,3}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,13}, {2,2,24}, {2,0,54}, {2,0,56} }, // 241
+   { {0,1,1}, {0,0,0}, {1,12,14}, {0,2,2}, {0,0,0}, {2,0,49}, {0,2,2}, {2,0,53}, {2,0,55} }, // 242
+   { {0,2,2}, {0,0,0}, {0,12,12}, {0,2,2}, {0,0,0}, {2,0,13}, {2,2,24}, {2,0,54}, {2,0,56} }, // 243
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,0,33} }, // 244
+   { {0,4,4}, {0,3,3}, {0,3,3}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,0,33} }, // 245
+   { {0,1,1}, {1,0,43}, {1,0,45}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,0,33} }, // 246
+   { {0,2,2}, {0,0,0}, {1,0,14}, {0,2,2}, {0,0,0}, {0,0,0}, {0,2,2}, {0,0,0}, {2,0,33} }, // 247
+   { {0,1,1}, {0,3,3}, {0,12,12}, {3,0,47}, {0,0,0}, {2,0,49}, {3,0,51}, {0,0,0}, {2,0,55} }, // 248
+   { {0,3,3}, {0,3,3}, {0,12,12}, {0,0,0}, {0,0,0}, {2,0,49}, {3,0,24}, {0,0,0}, {2,0,55} }, // 249
+   { {0,1,1}, {0,0,0}, {0,12,12}, {3,0,47}, {0,0,0}, {2,0,49}, {3,0,51}, {0,0,0}, {2,0,55} }, // 250
+   { {4,0,41}, {4,0,43}, {0,12,12}, {3,0,47}, {0,0,0}, {2,0,49}, {3,0,24}, {3,0,53}, {2,0,55} }, // 251
+   { {0,1,1}, {0,3,3}, {0,3,3}, {3,0,47}, {0,0,0}, {0,0,0}, {3,0,51}, {0,0,0}, {2,0,33} }, // 252
+   { {0,3,3}, {0,3,3}, {0,3,3}, {0,0,0}, {0,0,0}, {0,0,0}, {3,0,24}, {0,0,0}, {2,0,33} }, // 253
+   { {0,1,1}, {1,0,43}, {1,0,45}, {3,0,47}, {0,0,0}, {2,0,49}, {3,0,51}, {2,0,53}, {2,0,33} }, // 254
+   { {4,0,4}, {0,0,0}, {1,0,14}, {0,0,0}, {0,0,0}, {0,0,0}, {3,0,24}, {0,0,0}, {2,0,33} }, // 255
+};
@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*                                                                            */
+/*                  LAZYGFX: gfx decoded when they are drawn                  */
+/*                                                                            */
+/******************************************************************************/
+
+#include "raine.h"
+#include "newmem.h"
+#include "tilemod.h"
+#include "lazygfx.h"
+
+LAZY_GFX *lazy_gfx[MAX_GFX];
+int lazy_gfx_size = 32;
+
+#define MIN_SLOTS 256	// more than the tiles drawn by a sprite of the biggest
+			// drivers, a tile is not replaced before it's drawn
+
+/* Same transformations as check_tile_rotation for the tile_list : do_rotate
+   by DRAW_ROTATE, then do_flip by DRAW_FLIP */
+
+static void make_rotation(LAZY_GFX *lg)
+{
+   UINT32 x = lg->gl.width, y = lg->gl.height;
+   UINT32 rotate = DRAW_ROTATE, flip = DRAW_FLIP;
+   UINT32 ta,tb,pa,pb;
+
+   if (!rotate && !flip) {
+      if (lg->rot) {
+	 FreeMem(lg->rot);
+	 lg->rot = NULL;
+      }
+      return;
+   }
+   if (!lg->rot && !(lg->rot = AllocateMem(lg->tile_size * sizeof(UINT16))))
+      return;
+
+   for(tb=0; tb<y; tb++){
+      for(ta=0; ta<x; ta++){
+	 pa = (flip & 1 ? (x-1)-ta : ta);
+	 pb = (flip & 2 ? (y-1)-tb : tb);
+	 switch(rotate){
+	 case 0: lg->rot[ ta + (tb*x) ] = pa + (pb*x); break;
+	 case 1: lg->rot[ ta + (tb*x) ] = (((x-1)-pa)*y) + pb; break;
+	 case 2: lg->rot[ ta + (tb*x) ] = ((x-1)-pa) + (((y-1)-pb)*x); break;
+	 case 3: lg->rot[ ta + (tb*x) ] = (pa*y) + ((y-1)-pb); break;
+	 }
+      }
+   }
+}
+
+static void empty_cache(LAZY_GFX *lg)
+{
+   UINT32 s;
+
+   for (s=0; s<lg->used; s++)
+      lg->slot[lg->tile[s]] = LAZY_NO_SLOT;
+   lg->used = 0;
+   lg->head = lg->tail = LAZY_NO_SLOT;
+}
+
+LAZY_GFX *lazy_gfx_create(const UINT8 *src, UINT32 src_size, const GFX_LAYOUT *layout)
+{
+   LAZY_GFX *lg;
+   UINT32 s;
+
+   if (!(lg = AllocateMem(sizeof(LAZY_GFX))))
+      return NULL;
+   memset(lg,0,sizeof(LAZY_GFX));
+   lg->mode = prepare_gfx_layout(&lg->gl, layout, src_size);
+   lg->src = src;
+   lg->count = lg->gl.total;
+   lg->tile_size = lg->gl.width * lg->gl.height;
+
+   lg->slots = lazy_gfx_size * 1024 * 1024 / lg->tile_size;
+   if (lg->slots < MIN_SLOTS)
+      lg->slots = MIN_SLOTS;
+   if (lg->slots > lg->count)
+      lg->slots = lg->count;
+
+   if (!(lg->data = AllocateMem(lg->slots * lg->tile_size)) ||
+       !(lg->solid = AllocateMem(get_pad_size(lg->count))) ||
+       !(lg->slot = AllocateMem(lg->count * sizeof(UINT32))) ||
+       !(lg->tile = AllocateMem(lg->slots * sizeof(UINT32))) ||
+       !(lg->prev = AllocateMem(lg->slots * sizeof(UINT32))) ||
+       !(lg->next = AllocateMem(lg->slots * sizeof(UINT32))))
+      return NULL; // the memory pool frees what was allocated
+
+   // unknown until decoded : drawn as transparent, which is always right
+   memset(lg->solid,1,get_pad_size(lg->count));
+   for (s=0; s<lg->count; s++)
+      lg->slot[s] = LAZY_NO_SLOT;
+   lg->head = lg->tail = LAZY_NO_SLOT;
+   make_rotation(lg);
+
+   print_debug("lazy_gfx_create: %d tiles %dx%d, %d in the cache\n",
+	       lg->count, lg->gl.width, lg->gl.height, lg->slots);
+   return lg;
+}
+
+static void unlink_slot(LAZY_GFX *lg, UINT32 s)
+{
+   if (lg->prev[s] != LAZY_NO_SLOT)
+      lg->next[lg->prev[s]] = lg->next[s];
+   else
+      lg->head = lg->next[s];
+   if (lg->next[s] != LAZY_NO_SLOT)
+      lg->prev[lg->next[s]] = lg->prev[s];
+   else
+      lg->tail = lg->prev[s];
+}
+
+static void push_slot(LAZY_GFX *lg, UINT32 s)
+{
+   lg->prev[s] = LAZY_NO_SLOT;
+   lg->next[s] = lg->head;
+   if (lg->head != LAZY_NO_SLOT)
+      lg->prev[lg->head] = s;
+   else
+      lg->tail = s;
+   lg->head = s;
+}
+
+UINT8 *lazy_tile_slow(LAZY_GFX *lg, UINT32 code)
+{
+   UINT8 tmp[MAX_GFX_SIZE * MAX_GFX_SIZE], *dest;
+   UINT32 s = lg->slot[code], n;
+
+   if (s != LAZY_NO_SLOT) {
+      lg->hits++;
+      unlink_slot(lg, s);
+      push_slot(lg, s);
+      return lg->data + s * lg->tile_size;
+   }
+
+   lg->misses++;
+   if (lg->used < lg->slots)
+      s = lg->used++;
+   else {
+      s = lg->tail;
+      unlink_slot(lg, s);
+      lg->slot[lg->tile[s]] = LAZY_NO_SLOT;
+   }
+   dest = lg->data + s * lg->tile_size;
+
+   if (lg->rot) {
+      decode_tile(&lg->gl, lg->mode, lg->src, code, tmp);
+      for (n=0; n<lg->tile_size; n++)
+	 dest[n] = tmp[lg->rot[n]];
+   } else
+      decode_tile(&lg->gl, lg->mode, lg->src, code, dest);
+   lg->solid[code] = check_tile_solid(dest, lg->tile_size);
+
+   lg->tile[s] = code;
+   lg->slot[code] = s;
+   push_slot(lg, s);
+   return dest;
+}
+
+void lazy_gfx_flush(void)
+{
+   int nb;
+
+   for (nb=0; nb<MAX_GFX; nb++)
+      if (lazy_gfx[nb]) {
+	 empty_cache(lazy_gfx[nb]);
+	 make_rotation(lazy_gfx[nb]);
+      }
+}
+
+void lazy_gfx_close(void)
+{
+   int nb;
+
+   for (nb=0; nb<MAX_GFX; nb++) {
+      LAZY_GFX *lg = lazy_gfx[nb];
+      if (lg && lg->hits + lg->misses)
+	 print_debug("lazy gfx %d: %d tiles decoded for %d draws, hit rate %d%%\n",
+		     nb, lg->misses, lg->hits + lg->misses,
+		     (int)((UINT64)lg->hits * 100 / (lg->hits + lg->misses)));
+      lazy_gfx[nb] = NULL;	// freed with the memory pool
+   }
+}
@@ -0,0 +1,79 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_LAZYGFX_H
+#define VIDEO_LAZYGFX_H
+
+#include "loadroms.h"
+
+/*
+  Gfx decoded when they are drawn : a region loaded with the GFX_LAZY flag
+  stays in the rom format, and its tiles are decoded (and rotated) the first
+  time they are drawn, into a cache of lazy_gfx_size Mb where the least
+  recently used ones are replaced. The big sprite roms then take a fraction
+  of their decoded size, and loading the game skips decoding them.
+
+  The driver draws lazy_tile(lazy_gfx[nb],code) instead of gfx[nb] +
+  code*size. The pointer stays valid until the cache is full of other tiles,
+  so it must be used at once and not kept. It's called only from the drawing
+  code, it's not thread safe. The solid mask (gfx_solid[nb]) says 1 (draw
+  transparent) until a tile is decoded, then it has the usual value : call
+  lazy_tile before testing it, or an empty tile seen for the first time
+  reads 1 before the call and 0 after, and gets drawn as an opaque one.
+*/
+
+#define LAZY_NO_SLOT 0xffffffff
+
+typedef struct LAZY_GFX
+{
+   GFX_LAYOUT gl;		// layout with the fractions resolved
+   int mode;			// for decode_tile
+   const UINT8 *src;		// the rom data
+   UINT32 count;		// nb of tiles
+   UINT32 tile_size;		// width * height
+   UINT32 slots,used;		// size of the cache in tiles
+   UINT8 *data;			// decoded tiles
+   UINT8 *solid;		// solid mask of all the tiles
+   UINT32 *slot;		// slot of each tile, LAZY_NO_SLOT if not decoded
+   UINT32 *tile;		// tile of each slot
+   UINT32 *prev,*next;		// slots from the most recent (head) to the lru
+   UINT32 head,tail;
+   UINT16 *rot;			// pixel of the decoded tile for each pixel of the
+				// rotated one, NULL if not rotated
+   UINT32 hits,misses;
+} LAZY_GFX;
+
+extern LAZY_GFX *lazy_gfx[MAX_GFX];
+extern int lazy_gfx_size;	// config : General/lazy_gfx_size (Mb)
+
+LAZY_GFX *lazy_gfx_create(const UINT8 *src, UINT32 src_size, const GFX_LAYOUT *layout);
+
+UINT8 *lazy_tile_slow(LAZY_GFX *lg, UINT32 code);
+
+static DEF_INLINE UINT8 *lazy_tile(LAZY_GFX *lg, UINT32 code)
+{
+   UINT32 s;
+
+   if (code >= lg->count)
+      code %= lg->count;
+   s = lg->slot[code];
+   if (s == lg->head && s != LAZY_NO_SLOT) {
+      // the last tile asked again, no need to touch the lru list
+      lg->hits++;
+      return lg->data + s * lg->tile_size;
+   }
+   return lazy_tile_slow(lg, code);
+}
+
+// The rotation changed (check_tile_rotation) : empty the caches
+void lazy_gfx_flush(void);
+
+// Called when the driver is unloaded, before the memory pool is freed
+void lazy_gfx_close(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
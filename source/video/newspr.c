@@ -256,10 +256,10 @@ static void FUNC##_init_jump_table(void)                                       \
 {                                                                              \
    UINT32 i;                                                                    \
                                                                                \
-   i  = display_cfg.rotate;                                                    \
-   i ^= display_cfg.flip & 2;                                                  \
+   i  = DRAW_ROTATE;                                                    \
+   i ^= DRAW_FLIP & 2;                                                  \
                                                                                \
-   if((display_cfg.flip == 0) || (display_cfg.flip == 3)){                     \
+   if((DRAW_FLIP == 0) || (DRAW_FLIP == 3)){                     \
                                                                                \
    switch(i){                                                                  \
    case 0:                                                                     \
@@ -784,13 +784,13 @@ static void FUNC##_init_jump_table(void)                                       \
 {                                                                              \
    UINT32 i;                                                                   \
                                                                                \
-   i  = display_cfg.rotate;                                                    \
-   i ^= display_cfg.flip & 2;                                                  \
+   i  = DRAW_ROTATE;                                                    \
+   i ^= DRAW_FLIP & 2;                                                  \
                                                                                \
    switch(internal_bpp(display_cfg.bpp)){                                      \
    case 8:                                                                     \
                                                                                \
-   if((display_cfg.flip == 0) || (display_cfg.flip == 3)){                     \
+   if((DRAW_FLIP == 0) || (DRAW_FLIP == 3)){                     \
                                                                                \
    switch(i){                                                                  \
    case 0:                                                                     \
@@ -854,7 +854,7 @@ static void FUNC##_init_jump_table(void)                                       \
    break;                                                                      \
    case 16:                                                                    \
                                                                                \
-   if((display_cfg.flip == 0) || (display_cfg.flip == 3)){                     \
+   if((DRAW_FLIP == 0) || (DRAW_FLIP == 3)){                     \
                                                                                \
    switch(i){                                                                  \
    case 0:                                                                     \
@@ -918,7 +918,7 @@ static void FUNC##_init_jump_table(void)                                       \
    break;                                                                      \
    case 32:                                                                    \
                                                                                \
-   if((display_cfg.flip == 0) || (display_cfg.flip == 3)){                     \
+   if((DRAW_FLIP == 0) || (DRAW_FLIP == 3)){                     \
                                                                                \
    switch(i){                                                                  \
    case 0:                                                                     \
@@ -1058,6 +1058,16 @@ MAKE_ROT_JUMP_16( Draw8x8_Trans_Packed_Mapped, disp_x_8, disp_y_8 )
 
 MAKE_ROT_JUMP_16( Draw8x8_Trans_Packed_Mapped_SwapWord, disp_x_8, disp_y_8 )
 
+MAKE_ROT_JUMP_16( Draw8x8_Packed_Mapped,         disp_x_8,  disp_y_8  )
+
+MAKE_ROT_JUMP_16( Draw16x16_Packed_Mapped,       disp_x_16, disp_y_16 )
+
+MAKE_ROT_JUMP_16( Draw16x16_Trans_Packed_Mapped, disp_x_16, disp_y_16 )
+
+MAKE_ROT_JUMP_16( Draw32x32_Packed_Mapped,       disp_x_32, disp_y_32 )
+
+MAKE_ROT_JUMP_16( Draw32x32_Trans_Packed_Mapped, disp_x_32, disp_y_32 )
+
 MAKE_ROT_JUMP_16( Draw16x16_Mapped,       disp_x_16, disp_y_16 )
 
 MAKE_ROT_JUMP_16( Draw16x16_Trans_Mapped, disp_x_16, disp_y_16 )
@@ -1320,6 +1330,11 @@ void init_video_core(void)
 
    Draw8x8_Trans_Packed_Mapped_init_jump_table();
    Draw8x8_Trans_Packed_Mapped_SwapWord_init_jump_table();
+   Draw8x8_Packed_Mapped_init_jump_table();
+   Draw16x16_Packed_Mapped_init_jump_table();
+   Draw16x16_Trans_Packed_Mapped_init_jump_table();
+   Draw32x32_Packed_Mapped_init_jump_table();
+   Draw32x32_Trans_Packed_Mapped_init_jump_table();
 
    Draw16x16_Mapped_init_jump_table();
    Draw16x16_Trans_Mapped_init_jump_table();
@@ -19,6 +19,7 @@ extern "C" {
 #include "cache.h"
 
 #include "spp8x8.h"
+#include "spp.h"
 
 #include "str6x8.h"
 #include "mapped_alpha.h"
@@ -188,6 +189,51 @@ extern draw_mapped_func *Draw8x8_Trans_Packed_Mapped_SwapWord_Flip_Rot[4];
 #define Draw8x8_Trans_Packed_Mapped_SwapWord_FlipX_Rot(a, b, c, d)  (*Draw8x8_Trans_Packed_Mapped_SwapWord_Flip_Rot[2])(a, b, c, d)
 #define Draw8x8_Trans_Packed_Mapped_SwapWord_FlipXY_Rot(a, b, c, d) (*Draw8x8_Trans_Packed_Mapped_SwapWord_Flip_Rot[3])(a, b, c, d)
 
+extern draw_mapped_func *Draw8x8_Packed_Mapped_Flip_Rot[4];
+
+#define Draw8x8_Packed_Mapped_flip_Rot(a, b, c, d, e) (*Draw8x8_Packed_Mapped_Flip_Rot[e])(a, b, c, d)
+
+#define Draw8x8_Packed_Mapped_Rot(a, b, c, d)        (*Draw8x8_Packed_Mapped_Flip_Rot[0])(a, b, c, d)
+#define Draw8x8_Packed_Mapped_FlipY_Rot(a, b, c, d)  (*Draw8x8_Packed_Mapped_Flip_Rot[1])(a, b, c, d)
+#define Draw8x8_Packed_Mapped_FlipX_Rot(a, b, c, d)  (*Draw8x8_Packed_Mapped_Flip_Rot[2])(a, b, c, d)
+#define Draw8x8_Packed_Mapped_FlipXY_Rot(a, b, c, d) (*Draw8x8_Packed_Mapped_Flip_Rot[3])(a, b, c, d)
+
+extern draw_mapped_func *Draw16x16_Packed_Mapped_Flip_Rot[4];
+
+#define Draw16x16_Packed_Mapped_flip_Rot(a, b, c, d, e) (*Draw16x16_Packed_Mapped_Flip_Rot[e])(a, b, c, d)
+
+#define Draw16x16_Packed_Mapped_Rot(a, b, c, d)        (*Draw16x16_Packed_Mapped_Flip_Rot[0])(a, b, c, d)
+#define Draw16x16_Packed_Mapped_FlipY_Rot(a, b, c, d)  (*Draw16x16_Packed_Mapped_Flip_Rot[1])(a, b, c, d)
+#define Draw16x16_Packed_Mapped_FlipX_Rot(a, b, c, d)  (*Draw16x16_Packed_Mapped_Flip_Rot[2])(a, b, c, d)
+#define Draw16x16_Packed_Mapped_FlipXY_Rot(a, b, c, d) (*Draw16x16_Packed_Mapped_Flip_Rot[3])(a, b, c, d)
+
+extern draw_mapped_func *Draw16x16_Trans_Packed_Mapped_Flip_Rot[4];
+
+#define Draw16x16_Trans_Packed_Mapped_flip_Rot(a, b, c, d, e) (*Draw16x16_Trans_Packed_Mapped_Flip_Rot[e])(a, b, c, d)
+
+#define Draw16x16_Trans_Packed_Mapped_Rot(a, b, c, d)        (*Draw16x16_Trans_Packed_Mapped_Flip_Rot[0])(a, b, c, d)
+#define Draw16x16_Trans_Packed_Mapped_FlipY_Rot(a, b, c, d)  (*Draw16x16_Trans_Packed_Mapped_Flip_Rot[1])(a, b, c, d)
+#define Draw16x16_Trans_Packed_Mapped_FlipX_Rot(a, b, c, d)  (*Draw16x16_Trans_Packed_Mapped_Flip_Rot[2])(a, b, c, d)
+#define Draw16x16_Trans_Packed_Mapped_FlipXY_Rot(a, b, c, d) (*Draw16x16_Trans_Packed_Mapped_Flip_Rot[3])(a, b, c, d)
+
+extern draw_mapped_func *Draw32x32_Packed_Mapped_Flip_Rot[4];
+
+#define Draw32x32_Packed_Mapped_flip_Rot(a, b, c, d, e) (*Draw32x32_Packed_Mapped_Flip_Rot[e])(a, b, c, d)
+
+#define Draw32x32_Packed_Mapped_Rot(a, b, c, d)        (*Draw32x32_Packed_Mapped_Flip_Rot[0])(a, b, c, d)
+#define Draw32x32_Packed_Mapped_FlipY_Rot(a, b, c, d)  (*Draw32x32_Packed_Mapped_Flip_Rot[1])(a, b, c, d)
+#define Draw32x32_Packed_Mapped_FlipX_Rot(a, b, c, d)  (*Draw32x32_Packed_Mapped_Flip_Rot[2])(a, b, c, d)
+#define Draw32x32_Packed_Mapped_FlipXY_Rot(a, b, c, d) (*Draw32x32_Packed_Mapped_Flip_Rot[3])(a, b, c, d)
+
+extern draw_mapped_func *Draw32x32_Trans_Packed_Mapped_Flip_Rot[4];
+
+#define Draw32x32_Trans_Packed_Mapped_flip_Rot(a, b, c, d, e) (*Draw32x32_Trans_Packed_Mapped_Flip_Rot[e])(a, b, c, d)
+
+#define Draw32x32_Trans_Packed_Mapped_Rot(a, b, c, d)        (*Draw32x32_Trans_Packed_Mapped_Flip_Rot[0])(a, b, c, d)
+#define Draw32x32_Trans_Packed_Mapped_FlipY_Rot(a, b, c, d)  (*Draw32x32_Trans_Packed_Mapped_Flip_Rot[1])(a, b, c, d)
+#define Draw32x32_Trans_Packed_Mapped_FlipX_Rot(a, b, c, d)  (*Draw32x32_Trans_Packed_Mapped_Flip_Rot[2])(a, b, c, d)
+#define Draw32x32_Trans_Packed_Mapped_FlipXY_Rot(a, b, c, d) (*Draw32x32_Trans_Packed_Mapped_Flip_Rot[3])(a, b, c, d)
+
 
 extern draw_mapped_func *Draw16x16_Mapped_Flip_Rot[4];
 
@@ -16,6 +16,8 @@ from rgb values of the color).
 #include "palette.h"
 #include "blitasm.h"
 #include "profile.h"
+#include "cpuid.h"
+#include "palette_simd.h"
 
 PALETTE pal;			// 256 Colour palette for the game
 CMAP_FUNC *current_cmap_func;
@@ -76,6 +78,126 @@ PALETTE pal_screen;
 
 static UINT8 white_pen;
 
+/*
+
+Incremental conversion (15/16/32bpp) : current_cmap_func is track_bank, which
+calls the mapper and keeps a copy of the source bytes of the bank. At the start
+of the next frame ClearPaletteMap clears bank_status only for the banks whose
+source changed, the others keep their conversion. The palette ram is written
+directly by the cpu memory maps, so the changes are found by comparing, which
+is only a few Kb per frame. In 8bpp the pens are allocated again for each frame,
+every bank is converted again.
+
+*/
+
+static CMAP_FUNC *mapper_func;		// the mapper for the current depth
+static UINT8 *pal_shadow;		// source of the banks when converted
+static UINT32 shadow_size;
+static UINT32 bank_bytes;		// size of a bank in pal_shadow, 0 : off
+static UINT16 shadow_cols[MAX_COLBANKS];	// bank_status of the copy, 0 : none
+
+#ifdef RAINE_SIMD_PALETTE
+int simd_palette;
+#endif
+
+static UINT8 *bank_src(UINT32 bank)
+{
+   switch(current_colour_mapper->src_shift){
+   case PAL_SRC_BANK_COLS:
+      return RAM_PAL + bank * bank_cols * 2;
+   case PAL_SRC_RAM_SRC:
+      return colour_ram_src[bank];
+   default:
+      return RAM_PAL + (bank << current_colour_mapper->src_shift);
+   }
+}
+
+// Bytes read by the mapper for cols colours, 0 if it reads out of the bank
+
+static UINT32 bank_len(UINT32 cols)
+{
+   UINT32 len = cols * current_colour_mapper->src_col;
+
+   if (len > bank_bytes)
+      return 0;
+   if (current_colour_mapper->src_shift > PAL_SRC_RAM_SRC)
+      return bank_bytes;	// some of these read the bank backwards
+   return len;
+}
+
+static void track_bank(UINT32 bank, UINT32 cols)
+{
+   UINT32 len;
+
+   mapper_func(bank, cols);
+   if (bank >= pal_banks)
+      return;
+   if ((len = bank_len(bank_status[bank]))) {
+      memcpy(pal_shadow + bank * bank_bytes, bank_src(bank), len);
+      shadow_cols[bank] = bank_status[bank];
+   } else
+      shadow_cols[bank] = 0;
+}
+
+static void clear_changed_banks(void)
+{
+   UINT32 bank;
+#ifdef SDL
+   // the blitter can change the pixel format without telling the mapper
+   static UINT32 format[5];
+
+   if (color_format && (format[0] != color_format->BitsPerPixel ||
+			format[1] != color_format->Rmask ||
+			format[2] != color_format->Gmask ||
+			format[3] != color_format->Bmask ||
+			format[4] != color_format->Amask)) {
+      format[0] = color_format->BitsPerPixel;
+      format[1] = color_format->Rmask;
+      format[2] = color_format->Gmask;
+      format[3] = color_format->Bmask;
+      format[4] = color_format->Amask;
+      memset(shadow_cols, 0, sizeof(shadow_cols));
+   }
+#endif
+
+   for(bank=0; bank<pal_banks; bank++){
+      if(bank_status[bank] && bank_status[bank] == shadow_cols[bank] &&
+	 !memcmp(pal_shadow + bank * bank_bytes, bank_src(bank),
+		 bank_len(bank_status[bank])))
+	 continue;
+      bank_status[bank] = 0;
+      shadow_cols[bank] = 0;
+   }
+}
+
+// Called when the mapper, the depth or the banks change
+
+static void init_bank_tracking(void)
+{
+   COLOUR_MAPPER *m = current_colour_mapper;
+
+   current_cmap_func = mapper_func;
+   bank_bytes = 0;
+   memset(shadow_cols, 0, sizeof(shadow_cols));
+   if (!m || !m->src_col || display_cfg.bpp <= 8 || !pal_banks)
+      return;
+
+   if (m->src_shift > PAL_SRC_RAM_SRC)
+      bank_bytes = 1 << m->src_shift;
+   else
+      bank_bytes = bank_cols * 2;
+   if (shadow_size < pal_banks * bank_bytes) {
+      UINT8 *ptr = realloc(pal_shadow, pal_banks * bank_bytes);
+      if (!ptr) {
+	 bank_bytes = 0;
+	 return;
+      }
+      pal_shadow = ptr;
+      shadow_size = pal_banks * bank_bytes;
+   }
+   current_cmap_func = track_bank;
+}
+
 // mapsize is the size of the buffer taken to make conversions to 8bits colors
 void InitPaletteMap(UINT8 *src, int banks, int bankcols, int mapsize)
 {
@@ -90,7 +212,8 @@ void InitPaletteMap(UINT8 *src, int banks, int bankcols, int mapsize)
    map_size  = mapsize;
 
    bmsize = pal_banks * bankcols * (internal_bpp(display_cfg.bpp) / 8);
-   if (!(bankmap = AllocateMem(bmsize ))) return;
+   // + 16 colours : the simd sprites always read 16 colours from a bank
+   if (!(bankmap = AllocateMem(bmsize + 16*4))) return;
    memset(bankmap,0,bmsize); // For MAP_PALETTE_MULTI...
 
    if (!(cloc    = AllocateMem(map_size))) return;
@@ -119,6 +242,8 @@ void InitPaletteMap(UINT8 *src, int banks, int bankcols, int mapsize)
    closest_colour_init();
 
    reset_palette_map();
+   if (current_colour_mapper)
+      init_bank_tracking();
 }
 
 void ResetPalette() {
@@ -142,24 +267,29 @@ void set_colour_mapper(COLOUR_MAPPER *colour_mapper)
 
    switch(display_cfg.bpp){
       case 8:
-         current_cmap_func = current_colour_mapper->mapper_8bpp;
+         mapper_func = current_colour_mapper->mapper_8bpp;
       break;
       case 15:
-         current_cmap_func = current_colour_mapper->mapper_15bpp;
+         mapper_func = current_colour_mapper->mapper_15bpp;
       break;
       case 16:
-         current_cmap_func = current_colour_mapper->mapper_16bpp;
+         mapper_func = current_colour_mapper->mapper_16bpp;
       break;
       case 24:
-         current_cmap_func = current_colour_mapper->mapper_24bpp;
+         mapper_func = current_colour_mapper->mapper_24bpp;
       break;
       case 32:
-         current_cmap_func = current_colour_mapper->mapper_32bpp;
+         mapper_func = current_colour_mapper->mapper_32bpp;
       break;
       default:
-         current_cmap_func = current_colour_mapper->mapper_8bpp;
+         mapper_func = current_colour_mapper->mapper_8bpp;
       break;
    }
+#ifdef RAINE_SIMD_PALETTE
+   simd_palette = (raine_cpu_capabilities & CPU_SSE2) && display_cfg.bpp > 8 &&
+      color_format && !color_format->palette;
+#endif
+   init_bank_tracking();
 }
 
 void set_white_pen(int pen)
@@ -233,7 +363,10 @@ void ClearPaletteMap(void)
    pmap   = ta;			// pmap   = <new frame map>
 #endif
 
-   memset(bank_status, 0, pal_banks * 2);
+   if (bank_bytes)
+      clear_changed_banks();
+   else
+      memset(bank_status, 0, pal_banks * 2);
    memset(cloc, 0xFF, map_size);
    memset(pmap, 0x00, 256);
 
@@ -267,6 +400,7 @@ void reset_palette_map(void)
 {
    switch(map_mode){
    case PMAP_MAPPED:
+      memset(shadow_cols, 0, sizeof(shadow_cols));
       ClearPaletteMap();		// Make sure no colours are cached
       ClearPaletteMap();
 #ifdef TRIPLE_BUFFER
@@ -287,6 +421,12 @@ void reset_palette_map(void)
 void destroy_palette_map(void)
 {
    map_mode = PMAP_NONE;
+   bank_bytes = 0;
+   if (pal_shadow) {
+      free(pal_shadow);
+      pal_shadow = NULL;
+      shadow_size = 0;
+   }
 }
 
 void silly_wgp_colour_ram(UINT8 *src)
@@ -294,6 +434,15 @@ void silly_wgp_colour_ram(UINT8 *src)
    RAM_PAL = src;
 }
 
+// Moves the source colour ram of InitPaletteMap (pipelined rendering)
+void set_colour_ram(UINT8 *src)
+{
+   int ta;
+   RAM_PAL = src;
+   for(ta=0; ta<pal_banks; ta++)
+      colour_ram_src[ta] = src + (ta * bank_cols * 2);
+}
+
 // Allegro never found weird to use 0-63 colors values for 8bpp and 0-255 for other depths!
 #ifdef SDL
 // We could use sdl_maprgb here, but it would force us to really maintain the sdl_palette
@@ -495,6 +644,7 @@ struct COLOUR_MAPPER col_map_xxxx_rrrr_gggg_bbbb =
    map_12bit_xxxx_rrrr_gggg_bbbb_16,
    map_12bit_xxxx_rrrr_gggg_bbbb_24,
    map_12bit_xxxx_rrrr_gggg_bbbb_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 #define BUILD_MAPPER(NAME, TYPE, PEN_FUNC)	\
@@ -541,6 +691,7 @@ struct COLOUR_MAPPER col_map_nnnn_rrrr_gggg_bbbb_cps1 =
    map_12bit_nnnn_rrrr_gggg_bbbb_16,
    map_12bit_nnnn_rrrr_gggg_bbbb_24,
    map_12bit_nnnn_rrrr_gggg_bbbb_32,
+   5, 2,
 };
 
 // cps2 : the only difference is in the bright coefficient...
@@ -589,6 +740,7 @@ struct COLOUR_MAPPER col_map_nnnn_rrrr_gggg_bbbb_cps2 =
    map_12bit_nnnn_cps2_16,
    map_12bit_nnnn_cps2_24,
    map_12bit_nnnn_cps2_32,
+   5, 2,
 };
 
 // Map_12bit_xxxxRRRRGGGGBBBB_Rev
@@ -633,6 +785,7 @@ struct COLOUR_MAPPER col_map_12bit_xxxxRRRRGGGGBBBB_Rev =
    Map_12bit_xxxxRRRRGGGGBBBB_Rev_16,
    Map_12bit_xxxxRRRRGGGGBBBB_Rev_24,
    Map_12bit_xxxxRRRRGGGGBBBB_Rev_32,
+   5, 2,
 };
 
 // map rrr_ggg_bbb (9 bits -> 512 couleurs) (pengo)
@@ -676,6 +829,7 @@ struct COLOUR_MAPPER col_map_xxxxRrrgggbbb =
    Map_xxxxRrrgggbbb_16,
    Map_xxxxRrrgggbbb_24,
    Map_xxxxRrrgggbbb_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 /******************************************************************************/
@@ -722,6 +876,7 @@ struct COLOUR_MAPPER col_map_xxxx_bbbb_gggg_rrrr =
    Map_12bit_xBGR_16,
    Map_12bit_xBGR_24,
    Map_12bit_xBGR_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -880,6 +1035,7 @@ struct COLOUR_MAPPER col_map_rrrr_gggg_bbbb_xxxx =
    map_12bit_rrrr_gggg_bbbb_xxxx_16,
    map_12bit_rrrr_gggg_bbbb_xxxx_24,
    map_12bit_rrrr_gggg_bbbb_xxxx_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1014,6 +1170,7 @@ struct COLOUR_MAPPER col_map_rrrr_gggg_bbbb_rgbx_rev =
    map_15bit_rrrr_gggg_bbbb_rgbx_rev_16,
    map_15bit_rrrr_gggg_bbbb_rgbx_rev_24,
    map_15bit_rrrr_gggg_bbbb_rgbx_rev_32,
+   5, 2,
 };
 
 // Map_15bit_RRRRGGGGBBBBRGBx
@@ -1060,6 +1217,7 @@ void NAME(UINT32 bank, UINT32 cols)	\
    bank_status[bank] = cols;                            \
    ta = (UINT16 *) (RAM_PAL+(bank<<5));                 \
    ct = (TYPE*)coltab[bank];                            \
+   SIMD_PALETTE(map_xRGB_4444_sse2);                    \
    do{                                                  \
       yy = (*ta++);                                     \
                                                         \
@@ -1111,6 +1269,7 @@ struct COLOUR_MAPPER col_Map_15bit_RRRRGGGGBBBBRGBx =
    Map_15bit_xRGBRRRRGGGGBBBB_16,
    Map_15bit_xRGBRRRRGGGGBBBB_24,
    Map_15bit_xRGBRRRRGGGGBBBB_32,
+   5, 2,
 };
 
 struct COLOUR_MAPPER col_Map_15bit_xRGBRRRRGGGGBBBB =
@@ -1121,6 +1280,7 @@ struct COLOUR_MAPPER col_Map_15bit_xRGBRRRRGGGGBBBB =
    Map_15bit_xRGBRRRRGGGGBBBB_16,
    Map_15bit_xRGBRRRRGGGGBBBB_24,
    Map_15bit_xRGBRRRRGGGGBBBB_32,
+   5, 2,
 };
 
 void map_15bit_rrrr_rggg_ggbb_bbbx_rev_8(UINT32 bank, UINT32 cols)
@@ -1251,6 +1411,7 @@ struct COLOUR_MAPPER col_map_rrrr_rggg_ggbb_bbbx_rev =
    map_15bit_rrrr_rggg_ggbb_bbbx_rev_16,
    map_15bit_rrrr_rggg_ggbb_bbbx_rev_24,
    map_15bit_rrrr_rggg_ggbb_bbbx_rev_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1296,6 +1457,7 @@ struct COLOUR_MAPPER col_map_xxxx_bbbb_gggg_rrrr_rev =
    Map_12bit_xBGR_Rev_16,
    Map_12bit_xBGR_Rev_24,
    Map_12bit_xBGR_Rev_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1462,6 +1624,7 @@ struct COLOUR_MAPPER col_map_rrrr_gggg_bbbb_xxxx_68k =
    map_12bit_rrrr_gggg_bbbb_xxxx_rev_16,
    map_12bit_rrrr_gggg_bbbb_xxxx_rev_24,
    map_12bit_rrrr_gggg_bbbb_xxxx_rev_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1538,6 +1701,7 @@ struct COLOUR_MAPPER col_map_xrrr_rrgg_gggb_bbbb_rev_68k =
    map_15bit_xrrr_rrgg_gggb_bbbb_rev_68k_16,
    map_15bit_xrrr_rrgg_gggb_bbbb_rev_68k_24,
    map_15bit_xrrr_rrgg_gggb_bbbb_rev_68k_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1584,6 +1748,7 @@ struct COLOUR_MAPPER col_map_xrrr_rrgg_gggb_bbbb_68k =
    map_15bit_xrrr_rrgg_gggb_bbbb_68k_16,
    map_15bit_xrrr_rrgg_gggb_bbbb_68k_24,
    map_15bit_xrrr_rrgg_gggb_bbbb_68k_32,
+   5, 2,
 };
 
 // GRBx (galpanic) 15 bit
@@ -1628,6 +1793,7 @@ struct COLOUR_MAPPER col_map_15bit_grbx =
    map_15bit_grbx_16,
    map_15bit_grbx_24,
    map_15bit_grbx_32,
+   5, 2,
 };
 
 /******************************************************************************/
@@ -1667,6 +1833,7 @@ void map_15bit_xrrr_rrgg_gggb_bbbb_15(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 10, 5, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1691,6 +1858,7 @@ void map_15bit_xrrr_rrgg_gggb_bbbb_16(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 10, 5, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1739,6 +1907,7 @@ void map_15bit_xrrr_rrgg_gggb_bbbb_32(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT32 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 10, 5, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1762,6 +1931,7 @@ struct COLOUR_MAPPER col_map_xrrr_rrgg_gggb_bbbb =
    map_15bit_xrrr_rrgg_gggb_bbbb_16,
    map_15bit_xrrr_rrgg_gggb_bbbb_24,
    map_15bit_xrrr_rrgg_gggb_bbbb_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 /******************************************************************************/
@@ -1825,6 +1995,7 @@ void map_15bit_xbbb_bbgg_gggr_rrrr_15(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 0, 5, 10);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1849,6 +2020,7 @@ void map_15bit_xbbb_bbgg_gggr_rrrr_16(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 0, 5, 10);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1897,6 +2069,7 @@ void map_15bit_xbbb_bbgg_gggr_rrrr_32(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) (RAM_PAL+(bank*bank_cols*2));
    ct = (UINT32 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 0, 5, 10);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -1920,6 +2093,7 @@ struct COLOUR_MAPPER col_map_xbbb_bbgg_gggr_rrrr =
    map_15bit_xbbb_bbgg_gggr_rrrr_16,
    map_15bit_xbbb_bbgg_gggr_rrrr_24,
    map_15bit_xbbb_bbgg_gggr_rrrr_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 /******************************************************************************/
@@ -2054,6 +2228,7 @@ struct COLOUR_MAPPER col_map_xxbb_bbxg_gggx_rrrr =
    map_15bit_xxbb_bbxg_gggx_rrrr_16,
    map_15bit_xxbb_bbxg_gggx_rrrr_24,
    map_15bit_xxbb_bbxg_gggx_rrrr_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 /******************************************************************************/
@@ -2241,6 +2416,7 @@ struct COLOUR_MAPPER col_map_xxxx_xxxx_rrrr_rrrr_gggg_gggg_bbbb_bbbb =
    map_24bit_xxxx_xxxx_rrrr_rrrr_gggg_gggg_bbbb_bbbb_16,
    map_24bit_xxxx_xxxx_rrrr_rrrr_gggg_gggg_bbbb_bbbb_24,
    map_24bit_xxxx_xxxx_rrrr_rrrr_gggg_gggg_bbbb_bbbb_32,
+   6, 4,
 };
 
 
@@ -2311,6 +2487,7 @@ struct COLOUR_MAPPER col_map_24bit_rgb =
    Map_24bit_RGB_16,
    Map_24bit_RGB_24,
    Map_24bit_RGB_32,
+   6, 4,
 };
 
 /******************************************************************************/
@@ -2395,6 +2572,7 @@ struct COLOUR_MAPPER col_map_21bit_xRGB =
    Map_21bit_xRGB_16,
    Map_21bit_xRGB_24,
    Map_21bit_xRGB_32,
+   6, 4,
 };
 
 /******************************************************************************/
@@ -2442,6 +2620,7 @@ struct COLOUR_MAPPER col_map_12bit_rgbxxxx =
    Map_12bit_RGBxxxxx_16,
    Map_12bit_RGBxxxxx_24,
    Map_12bit_RGBxxxxx_32,
+   6, 4,
 };
 
 #undef BUILD_MAPPER
@@ -2484,6 +2663,7 @@ struct COLOUR_MAPPER col_map_rrrr_gggg_xxxx_bbbb =
    map_12bit_rrrr_gggg_xxxx_bbbb_16,
    map_12bit_rrrr_gggg_xxxx_bbbb_24,
    map_12bit_rrrr_gggg_xxxx_bbbb_32,
+   PAL_SRC_BANK_COLS, 2,
 };
 
 /******************************************************************************/
@@ -2618,6 +2798,7 @@ struct COLOUR_MAPPER col_map_bbbb_bggg_ggrr_rrrx_xxxx_xxxx_xxxx_xxxx =
    map_15bit_bbbb_bggg_ggrr_rrrx_xxxx_xxxx_xxxx_xxxx_16,
    map_15bit_bbbb_bggg_ggrr_rrrx_xxxx_xxxx_xxxx_xxxx_24,
    map_15bit_bbbb_bggg_ggrr_rrrx_xxxx_xxxx_xxxx_xxxx_32,
+   10, 4,
 };
 
 /******************************************************************************/
@@ -2657,6 +2838,7 @@ void map_15bit_xggg_ggrr_rrrb_bbbb_15(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) colour_ram_src[bank];
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 5, 10, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -2681,6 +2863,7 @@ void map_15bit_xggg_ggrr_rrrb_bbbb_16(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) colour_ram_src[bank];
    ct = (UINT16 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 5, 10, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -2729,6 +2912,7 @@ void map_15bit_xggg_ggrr_rrrb_bbbb_32(UINT32 bank, UINT32 cols)
    bank_status[bank] = cols;
    ta = (UINT16 *) colour_ram_src[bank];
    ct = (UINT32 *) coltab[bank];
+   SIMD_PALETTE(map_555_sse2, 5, 10, 0);
    do{
       yy = (*ta++) & 0x7FFF;
 
@@ -2752,6 +2936,7 @@ struct COLOUR_MAPPER col_map_xggg_ggrr_rrrb_bbbb =
    map_15bit_xggg_ggrr_rrrb_bbbb_16,
    map_15bit_xggg_ggrr_rrrb_bbbb_24,
    map_15bit_xggg_ggrr_rrrb_bbbb_32,
+   PAL_SRC_RAM_SRC, 2,
 };
 
 /******************************************************************************/
@@ -67,8 +67,19 @@ typedef struct COLOUR_MAPPER
    CMAP_FUNC *mapper_16bpp;
    CMAP_FUNC *mapper_24bpp;
    CMAP_FUNC *mapper_32bpp;
+   UINT8    src_shift;	// where the mapper reads bank n, see PAL_SRC_*
+   UINT8    src_col;	// bytes per colour in the source, 0 if unknown
 } COLOUR_MAPPER;
 
+/* Source of the banks, for the incremental conversion : in 15/16/32bpp a bank
+   converted in a frame is kept in the next ones as long as its source bytes
+   don't change. The mappers which don't give src_col are converted again for
+   each frame as before. */
+
+#define PAL_SRC_BANK_COLS 0	// RAM_PAL + n*bank_cols*2
+#define PAL_SRC_RAM_SRC   1	// colour_ram_src[n] (set_colour_ram)
+				// others : RAM_PAL + (n << src_shift)
+
 extern CMAP_FUNC *current_cmap_func;
 extern COLOUR_MAPPER *current_colour_mapper;
 
@@ -157,6 +168,7 @@ void reset_palette_map(void);
 int Reserve_Pens(int num);
 
 void silly_wgp_colour_ram(UINT8 *src);
+void set_colour_ram(UINT8 *src);
 
 // Call these to change permanently allocated pen colours
 
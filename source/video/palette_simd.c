@@ -0,0 +1,129 @@
+/******************************************************************************/
+/*                                                                            */
+/*                        SSE2 COLOUR MAPPING (15 BIT SOURCES)                */
+/*                                                                            */
+/******************************************************************************/
+
+/*
+
+The mappers convert 1 colour at a time through SDL_MapRGB. For a true colour
+display it's only shifts and masks : (c >> loss) << shift for each component,
+so here it's done for 8 colours at once, the components in 16 bits lanes.
+The result is the same as SDL_MapRGB.
+
+*/
+
+#include "deftypes.h"
+#include "raine.h"
+#include "palette.h"
+#include "palette_simd.h"
+
+#ifdef RAINE_SIMD_PALETTE
+
+#include <emmintrin.h>
+
+#define SIMD __attribute__((target("sse2")))
+
+typedef struct PIXEL_FORMAT
+{
+   __m128i rl,gl,bl;		// losses
+   __m128i rs,gs,bs;		// shifts
+   __m128i a16,a32;		// alpha mask
+} PIXEL_FORMAT;
+
+SIMD static inline void get_format(PIXEL_FORMAT *pf)
+{
+   pf->rl = _mm_cvtsi32_si128(color_format->Rloss);
+   pf->gl = _mm_cvtsi32_si128(color_format->Gloss);
+   pf->bl = _mm_cvtsi32_si128(color_format->Bloss);
+   pf->rs = _mm_cvtsi32_si128(color_format->Rshift);
+   pf->gs = _mm_cvtsi32_si128(color_format->Gshift);
+   pf->bs = _mm_cvtsi32_si128(color_format->Bshift);
+   pf->a16 = _mm_set1_epi16((short)color_format->Amask);
+   pf->a32 = _mm_set1_epi32(color_format->Amask);
+}
+
+// r, g, b : 8 components of 8 bits in 16 bits lanes -> 8 pixels
+
+SIMD static inline void store_16(const PIXEL_FORMAT *pf, __m128i r, __m128i g, __m128i b, UINT16 *dst)
+{
+   __m128i p;
+
+   p = _mm_sll_epi16(_mm_srl_epi16(r, pf->rl), pf->rs);
+   p = _mm_or_si128(p, _mm_sll_epi16(_mm_srl_epi16(g, pf->gl), pf->gs));
+   p = _mm_or_si128(p, _mm_sll_epi16(_mm_srl_epi16(b, pf->bl), pf->bs));
+   _mm_storeu_si128((__m128i*)dst, _mm_or_si128(p, pf->a16));
+}
+
+SIMD static inline __m128i pixels_32(const PIXEL_FORMAT *pf, __m128i r, __m128i g, __m128i b)
+{
+   __m128i p;
+
+   p = _mm_sll_epi32(_mm_srl_epi32(r, pf->rl), pf->rs);
+   p = _mm_or_si128(p, _mm_sll_epi32(_mm_srl_epi32(g, pf->gl), pf->gs));
+   p = _mm_or_si128(p, _mm_sll_epi32(_mm_srl_epi32(b, pf->bl), pf->bs));
+   return _mm_or_si128(p, pf->a32);
+}
+
+SIMD static inline void store_32(const PIXEL_FORMAT *pf, __m128i r, __m128i g, __m128i b, UINT32 *dst)
+{
+   const __m128i zero = _mm_setzero_si128();
+
+   _mm_storeu_si128((__m128i*)dst, pixels_32(pf,
+      _mm_unpacklo_epi16(r, zero), _mm_unpacklo_epi16(g, zero),
+      _mm_unpacklo_epi16(b, zero)));
+   _mm_storeu_si128((__m128i*)(dst+4), pixels_32(pf,
+      _mm_unpackhi_epi16(r, zero), _mm_unpackhi_epi16(g, zero),
+      _mm_unpackhi_epi16(b, zero)));
+}
+
+#define STORE(r, g, b)                                  \
+   if (bpp == 16)                                       \
+      store_16(&pf, r, g, b, ((UINT16*)dst) + n);       \
+   else                                                 \
+      store_32(&pf, r, g, b, ((UINT32*)dst) + n);       \
+
+SIMD UINT32 map_555_sse2(const UINT16 *src, void *dst, UINT32 cols, int bpp,
+			 int rs, int gs, int bs)
+{
+   const __m128i mask = _mm_set1_epi16(0x1f);
+   const __m128i r_sh = _mm_cvtsi32_si128(rs);
+   const __m128i g_sh = _mm_cvtsi32_si128(gs);
+   const __m128i b_sh = _mm_cvtsi32_si128(bs);
+   PIXEL_FORMAT pf;
+   UINT32 n;
+
+   get_format(&pf);
+   for (n=0; n+8 <= cols; n+=8) {
+      __m128i c = _mm_loadu_si128((const __m128i*)(src + n));
+      __m128i r = _mm_slli_epi16(_mm_and_si128(_mm_srl_epi16(c, r_sh), mask), 3);
+      __m128i g = _mm_slli_epi16(_mm_and_si128(_mm_srl_epi16(c, g_sh), mask), 3);
+      __m128i b = _mm_slli_epi16(_mm_and_si128(_mm_srl_epi16(c, b_sh), mask), 3);
+      STORE(r, g, b);
+   }
+   return n;
+}
+
+SIMD UINT32 map_xRGB_4444_sse2(const UINT16 *src, void *dst, UINT32 cols, int bpp)
+{
+   const __m128i m4 = _mm_set1_epi16(0xf0);
+   const __m128i m1 = _mm_set1_epi16(0x08);
+   PIXEL_FORMAT pf;
+   UINT32 n;
+
+   get_format(&pf);
+   for (n=0; n+8 <= cols; n+=8) {
+      __m128i c = _mm_loadu_si128((const __m128i*)(src + n));
+      // 4 bits of the component in 7-4, its low bit (14-12) in bit 3
+      __m128i r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(c, 4), m4),
+			       _mm_and_si128(_mm_srli_epi16(c, 11), m1));
+      __m128i g = _mm_or_si128(_mm_and_si128(c, m4),
+			       _mm_and_si128(_mm_srli_epi16(c, 10), m1));
+      __m128i b = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(c, 4), m4),
+			       _mm_and_si128(_mm_srli_epi16(c, 9), m1));
+      STORE(r, g, b);
+   }
+   return n;
+}
+
+#endif
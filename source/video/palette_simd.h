@@ -0,0 +1,48 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_PALETTE_SIMD_H
+#define VIDEO_PALETTE_SIMD_H
+
+/* SSE2 versions of the 15/16/32bpp mappers for the usual 15 bit formats
+   (palette_simd.c), 8 colours at a time. They convert what they can of the
+   bank and return the number of colours done, the mapper does the rest. */
+
+#if defined(SDL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9) || defined(__clang__))
+#define RAINE_SIMD_PALETTE 1
+#endif
+
+#ifdef RAINE_SIMD_PALETTE
+
+extern int simd_palette;	// sse2 and a true colour display
+
+// 5 bits components, at bits rs, gs and bs of the colour
+UINT32 map_555_sse2(const UINT16 *src, void *dst, UINT32 cols, int bpp,
+		    int rs, int gs, int bs);
+
+// neogeo : xRGBRRRRGGGGBBBB
+UINT32 map_xRGB_4444_sse2(const UINT16 *src, void *dst, UINT32 cols, int bpp);
+
+// in a mapper, with ta the source and ct the colours
+#define SIMD_PALETTE(func, ...)                                         \
+   if (simd_palette && sizeof(*ct) > 1 && cols >= 8) {                  \
+      UINT32 done = func(ta, ct, cols, sizeof(*ct) * 8, ##__VA_ARGS__); \
+      ta += done;                                                       \
+      ct += done;                                                       \
+      if (!(cols -= done))                                              \
+         return;                                                        \
+   }
+
+#else
+
+#define SIMD_PALETTE(func, ...)
+
+#endif
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
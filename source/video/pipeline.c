@@ -0,0 +1,169 @@
+/******************************************************************************/
+/*                                                                            */
+/*         PIPELINE: draw a frame while the next one is emulated              */
+/*                                                                            */
+/******************************************************************************/
+
+#include "raine.h"
+#include "newmem.h"
+#include "pipeline.h"
+#include "palette.h"
+#ifdef SDL
+#include "SDL_thread.h"
+#endif
+
+int render_pipeline = 0;
+
+#define MAX_VIDEO_STATES 16
+
+typedef struct VIDEO_STATE
+{
+   UINT8 **ptr;			// pointer used by the drawing code
+   UINT8 *live;			// what the cpus write to
+   UINT8 *snap;			// copy drawn by the render thread
+   UINT32 size;
+} VIDEO_STATE;
+
+static VIDEO_STATE video_state[MAX_VIDEO_STATES];
+static int nb_states, palette_state = -1;
+static int running;
+
+void add_video_state(UINT8 **ptr, UINT32 size)
+{
+   VIDEO_STATE *vs;
+   if (nb_states == MAX_VIDEO_STATES) {
+      print_debug("add_video_state: too many states\n");
+      return;
+   }
+   vs = &video_state[nb_states++];
+   vs->ptr = ptr;
+   vs->live = *ptr;
+   vs->snap = NULL;
+   vs->size = size;
+}
+
+void add_video_palette(UINT32 size)
+{
+   palette_state = nb_states;
+   add_video_state(&RAM_PAL,size);
+}
+
+void clear_video_states(void)
+{
+   // the snapshots are in the memory pool, freed with the driver
+   nb_states = 0;
+   palette_state = -1;
+}
+
+static void set_pointers(int snap)
+{
+   int n;
+   for (n=0; n<nb_states; n++)
+      *video_state[n].ptr = (snap ? video_state[n].snap : video_state[n].live);
+   if (palette_state >= 0)
+      set_colour_ram(RAM_PAL);
+   RefreshBuffers = 1;
+}
+
+#ifdef SDL
+
+static SDL_Thread *thread;
+static SDL_sem *start, *done;
+static void (*draw_func)(void);
+static int pending;
+
+static int pipeline_thread_func(void *data)
+{
+   while (1) {
+      SDL_SemWait(start);
+      draw_func();
+      SDL_SemPost(done);
+   }
+   return 0;
+}
+
+int pipeline_start(void)
+{
+   int n;
+   if (!render_pipeline || !nb_states)
+      return 0;
+   if (!thread) {
+      start = SDL_CreateSemaphore(0);
+      done = SDL_CreateSemaphore(0);
+      thread = SDL_CreateThread(pipeline_thread_func,NULL);
+      if (!thread) {
+	 printf("could not create the render thread: %s\n",SDL_GetError());
+	 return 0;
+      }
+   }
+   for (n=0; n<nb_states; n++) {
+      VIDEO_STATE *vs = &video_state[n];
+      if (!vs->snap && !(vs->snap = AllocateMem(vs->size)))
+	 return 0;
+      memcpy(vs->snap,vs->live,vs->size);
+   }
+   set_pointers(1);
+   running = 1;
+   return 1;
+}
+
+void pipeline_draw(void (*draw)(void))
+{
+   int n;
+   for (n=0; n<nb_states; n++)
+      memcpy(video_state[n].snap,video_state[n].live,video_state[n].size);
+   if (RefreshBuffers) {
+      // The drivers redo their setup (tilemaps, palette...) when it's set,
+      // this frame is drawn here. RefreshBuffers is cleared so that it only
+      // says something if it's set again while this frame waits for its blit
+      draw();
+      RefreshBuffers = 0;
+      pending = 2;
+      return;
+   }
+   draw_func = draw;
+   pending = 1;
+   SDL_SemPost(start);
+}
+
+int pipeline_wait(void)
+{
+   if (!pending)
+      return 0;
+   if (pending == 1)
+      SDL_SemWait(done);
+   pending = 0;
+   return 1;
+}
+
+void pipeline_stop(void)
+{
+   if (!running)
+      return;
+   pipeline_wait();
+   set_pointers(0);
+   running = 0;
+}
+
+#else
+
+int pipeline_start(void)
+{
+   return 0;
+}
+
+void pipeline_draw(void (*draw)(void))
+{
+   draw();
+}
+
+int pipeline_wait(void)
+{
+   return 0;
+}
+
+void pipeline_stop(void)
+{
+}
+
+#endif
@@ -0,0 +1,50 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_PIPELINE_H
+#define VIDEO_PIPELINE_H
+
+/*
+  Pipelined rendering : draw_game of frame N runs in a thread while the
+  main thread emulates frame N+1, and frame N is blitted after that.
+
+  Drivers must opt in, because their draw_game must not read anything the
+  cpus can change while it runs. They do it by declaring the pointers their
+  drawing code uses to read the video ram, sprite ram, scroll registers...
+  with add_video_state, and the palette ram with add_video_palette. At the
+  end of each frame these regions are copied to snapshots, and the pointers
+  are moved to the snapshots for as long as the pipeline is running, so the
+  pointers must be used only by the drawing code (the memory maps and the
+  save states keep the address given when they were set).
+  Nothing changes for the drivers which don't declare anything.
+*/
+
+extern int render_pipeline;	// config : use the pipeline when possible
+
+// *ptr points to size bytes of live ram when it's called
+void add_video_state(UINT8 **ptr, UINT32 size);
+
+// palette ram given to InitPaletteMap (RAM_PAL)
+void add_video_palette(UINT32 size);
+
+void clear_video_states(void);
+
+// Called around the emulation loop. pipeline_start returns 1 if the draws
+// will be pipelined. RefreshBuffers is set when the pointers change.
+int pipeline_start(void);
+void pipeline_stop(void);
+
+// Snapshots the video state and starts draw in the render thread. If
+// RefreshBuffers is set, draw runs at once in the caller and clears it.
+void pipeline_draw(void (*draw)(void));
+
+// Waits for the draw started by pipeline_draw, returns 1 if there was one,
+// then GameBitmap holds the new frame
+int pipeline_wait(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
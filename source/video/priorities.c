@@ -58,7 +58,13 @@
 
 */
 
-static struct TILE_Q *TileQueue;               // full list
+TILE_QUEUE tq,tq_in;
+UINT32 tq_first[MAX_PRI+1];
+UINT8 *tq_pri;
+UINT32 tq_count[MAX_PRI];
+UINT32 tq_nb,tq_sized;
+UINT32 tile_start;
+
 BITMAP *pbitmap = NULL; // global, because used by the pdraw functions
 
 void init_pbitmap() {
@@ -67,6 +73,9 @@ void init_pbitmap() {
   int x = vid->screen_x + vid->border_size*2, y = vid->screen_y+vid->border_size*2;
   int rotate = vid->flags ^ display_cfg.user_rotate;
 
+  if (display_cfg.rotated_at_blit) // the game is drawn unrotated
+    rotate = 0;
+
   if (pbitmap)
     destroy_bitmap(pbitmap);
   if (rotate & 1) { // rotate 90, 270
@@ -77,34 +86,63 @@ void init_pbitmap() {
   init_spr16x16asm_mask(pbitmap);
 }
 
+static int alloc_queue(TILE_QUEUE *q) {
+  if(!(q->tile = (UINT32 *) AllocateMem(sizeof(UINT32)*MAX_TILES)))return 0;
+  if(!(q->x    = (INT16 *)  AllocateMem(sizeof(INT16)*MAX_TILES)))return 0;
+  if(!(q->y    = (INT16 *)  AllocateMem(sizeof(INT16)*MAX_TILES)))return 0;
+  if(!(q->map  = (UINT8 **) AllocateMem(sizeof(UINT8*)*MAX_TILES)))return 0;
+  if(!(q->flip = (UINT8 *)  AllocateMem(MAX_TILES)))return 0;
+  if(!(q->ww   = (UINT16 *) AllocateMem(sizeof(UINT16)*MAX_TILES)))return 0;
+  if(!(q->hh   = (UINT16 *) AllocateMem(sizeof(UINT16)*MAX_TILES)))return 0;
+  if(!(q->zoomx= (UINT16 *) AllocateMem(sizeof(UINT16)*MAX_TILES)))return 0;
+  if(!(q->zoomy= (UINT16 *) AllocateMem(sizeof(UINT16)*MAX_TILES)))return 0;
+  return 1;
+}
+
 int init_tilequeue() {
-  if(!(TileQueue = (struct TILE_Q *) AllocateMem(sizeof(struct TILE_Q)*MAX_TILES)))return 0;
+  if (!alloc_queue(&tq) || !alloc_queue(&tq_in)) return 0;
+  if(!(tq_pri = (UINT8 *) AllocateMem(MAX_TILES)))return 0;
+  ClearTileQueue();
   return 1;
 }
 
+// Counting sort of the queue by priority, into tq
+
 void TerminateTileQueue(void)
 {
-   int ta;
-   struct TILE_Q *curr_tile;
+   UINT32 ta,n,pos[MAX_PRI];
 
+   tq_first[0] = 0;
    for(ta=0; ta<MAX_PRI; ta++){
+      pos[ta] = tq_first[ta];
+      tq_first[ta+1] = tq_first[ta] + tq_count[ta];
+   }
 
-      curr_tile = next_tile[ta];
-
-      curr_tile->next = NULL;
+   for(n=0; n<tq_nb; n++){
+      ta = pos[tq_pri[n]]++;
+      tq.tile[ta] = tq_in.tile[n];
+      tq.x[ta]    = tq_in.x[n];
+      tq.y[ta]    = tq_in.y[n];
+      tq.map[ta]  = tq_in.map[n];
+      tq.flip[ta] = tq_in.flip[n];
+   }
 
+   if (tq_sized) {
+      for(ta=0; ta<MAX_PRI; ta++)
+	 pos[ta] = tq_first[ta];
+      for(n=0; n<tq_nb; n++){
+	 ta = pos[tq_pri[n]]++;
+	 tq.ww[ta]    = tq_in.ww[n];
+	 tq.hh[ta]    = tq_in.hh[n];
+	 tq.zoomx[ta] = tq_in.zoomx[n];
+	 tq.zoomy[ta] = tq_in.zoomy[n];
+      }
    }
 }
 
 void ClearTileQueue(void)
 {
-   int ta;
-
-   last_tile = TileQueue;
-
-   for(ta=0; ta<MAX_PRI; ta++){
-      first_tile[ta] = last_tile;
-      next_tile[ta]  = last_tile;
-      last_tile      = last_tile+1;
-   }
+   memset(tq_count,0,sizeof(tq_count));
+   tq_nb = 0;
+   tq_sized = 0;
 }
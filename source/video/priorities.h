@@ -8,95 +8,112 @@ extern "C" {
 /*
   These functions are intended to handle games with a "priority mess" : games where
   each sprites on a given tile can have a different priority.
-  Drivers using this for now : cave, toaplan2, mcatadv
+  Drivers using this for now : toaplan2, cps1 (cave and mcatadv used it before)
 
-  The principle is not so hard : an array of priorities (first_tile) containing the list
+  The principle is not so hard : an array of priorities (tq_first) containing the list
   of sprites to draw for this priority. Then you just draw the priorities in order.
   This file does not contain the drawing function itself, because it's dependant on the
   driver : 8x8, 16x16, optional zoom and so on : driver specific.
 
-  The idea here is to use a pre-allocated array of TILE_Q instead of allocating each
-  element by new (c++) or malloc, which would be way too slow for what we want.
-  The size of this array is given by MAX_TILES below.
+  The tiles are stored in a structure of arrays : QueueTile appends them in
+  the order they come, with their priority, and TerminateTileQueue sorts them
+  by priority with a counting sort (stable, so the order of the tiles of a
+  given priority is kept). After that the tiles of priority pri are the
+  indexes tq_first[pri] to tq_first[pri+1]-1 of the arrays of tq, which
+  can be walked without following any pointer.
+  TileQueueRun returns the end of the run of tiles with the same flip and
+  size starting at a given index, so that a draw loop can choose its drawing
+  function once per run instead of once per tile.
+  The size of the arrays is given by MAX_TILES below.
 */
 
 #define MAX_PRI         32              // 32 levels of priority
 
-#define MAX_TILES       0x8000          // 0x4000*0x14=0xA0000 (640kb)
+#define MAX_TILES       0x8000
 
-struct TILE_Q
+typedef struct TILE_QUEUE
 {
-   UINT32 tile;                          // Tile number
-   INT16 x,y;                           // X,Y position
-   UINT8 *map;                          // Colour map data
-   UINT32 flip;                          // Flip X/Y Axis
+   UINT32 *tile;                        // Tile number
+   INT16 *x,*y;                         // X,Y position
+   UINT8 **map;                         // Colour map data
+   UINT8 *flip;                         // Flip X/Y Axis
   // These 4 are optional : size and zoom when needed
-   UINT16 ww,hh;
-   UINT16 zoomx,zoomy;
-   struct TILE_Q *next;                 // Next item with equal priority
-};
+   UINT16 *ww,*hh;
+   UINT16 *zoomx,*zoomy;
+} TILE_QUEUE;
 
-struct TILE_Q *last_tile;               // last tile in use
-struct TILE_Q *next_tile[MAX_PRI];      // next tile for each priority
-struct TILE_Q *first_tile[MAX_PRI];     // first tile for each priority
+extern TILE_QUEUE tq;                   // tiles sorted by priority
+extern UINT32 tq_first[MAX_PRI+1];      // first tile for each priority
 
-UINT32 tile_start;
+// Don't use these directly, it's the unsorted queue
+extern TILE_QUEUE tq_in;
+extern UINT8 *tq_pri;
+extern UINT32 tq_count[MAX_PRI];
+extern UINT32 tq_nb,tq_sized;
 
-static DEF_INLINE void QueueTile(int tile, int x, int y, UINT8 *map, UINT8 flip, int pri)
-{
-   struct TILE_Q *curr_tile;
-
-   curr_tile = next_tile[pri];
+extern UINT32 tile_start;
 
-   curr_tile->tile = tile+tile_start;
-   curr_tile->x    = x;
-   curr_tile->y    = y;
-   curr_tile->map  = map;
-   curr_tile->flip = flip;
-   curr_tile->next = last_tile;
+static DEF_INLINE UINT32 QueueTileBase(UINT32 tile, int x, int y, UINT8 *map, UINT8 flip, UINT32 pri)
+{
+   UINT32 n = tq_nb;
+
+   if (n == MAX_TILES) return n;
+   tq_in.tile[n] = tile;
+   tq_in.x[n]    = x;
+   tq_in.y[n]    = y;
+   tq_in.map[n]  = map;
+   tq_in.flip[n] = flip;
+   tq_pri[n]     = pri;
+   tq_count[pri]++;
+   tq_nb = n+1;
+   return n;
+}
 
-   next_tile[pri]  = last_tile;
-   last_tile       = last_tile+1;
+static DEF_INLINE void QueueTile(int tile, int x, int y, UINT8 *map, UINT8 flip, int pri)
+{
+   QueueTileBase(tile+tile_start, x, y, map, flip, pri);
 }
 
 /* Same thing, but with the the added sizes parameters */
 static DEF_INLINE void QueueTileSize(UINT32 tile, int x, int y, UINT8 *map, UINT8 flip, UINT32 pri,UINT16 ww,UINT16 hh)
 {
-   struct TILE_Q *curr_tile;
-   curr_tile = next_tile[pri];
-
-   curr_tile->tile = tile;
-   curr_tile->x    = x;
-   curr_tile->y    = y;
-   curr_tile->map  = map;
-   curr_tile->flip = flip;
-   curr_tile->next = last_tile;
-   curr_tile->ww   = ww;
-   curr_tile->hh   = hh;
-
-   next_tile[pri]  = last_tile;
-   last_tile       = last_tile+1;
+   UINT32 n = QueueTileBase(tile, x, y, map, flip, pri);
+   if (n == MAX_TILES) return;
+
+   tq_in.ww[n]   = ww;
+   tq_in.hh[n]   = hh;
+   tq_sized = 1;
 }
 
 /* And with the zoom parameters */
 static DEF_INLINE void QueueTileZoom(UINT32 tile, int x, int y, UINT8 *map, UINT8 flip, UINT32 pri,UINT16 ww,UINT16 hh,UINT16 zoomx, UINT16 zoomy)
 {
-   struct TILE_Q *curr_tile;
-   curr_tile = next_tile[pri];
-
-   curr_tile->tile = tile;
-   curr_tile->x    = x;
-   curr_tile->y    = y;
-   curr_tile->map  = map;
-   curr_tile->flip = flip;
-   curr_tile->next = last_tile;
-   curr_tile->ww   = ww;
-   curr_tile->hh   = hh;
-   curr_tile->zoomx= zoomx;
-   curr_tile->zoomy= zoomy;
-
-   next_tile[pri]  = last_tile;
-   last_tile       = last_tile+1;
+   UINT32 n = QueueTileBase(tile, x, y, map, flip, pri);
+   if (n == MAX_TILES) return;
+
+   tq_in.ww[n]   = ww;
+   tq_in.hh[n]   = hh;
+   tq_in.zoomx[n]= zoomx;
+   tq_in.zoomy[n]= zoomy;
+   tq_sized = 1;
+}
+
+/* End of the run of tiles starting at n (before end) with the same flip and
+   the same size */
+static DEF_INLINE UINT32 TileQueueRun(UINT32 n, UINT32 end)
+{
+   UINT8 flip = tq.flip[n];
+   UINT32 run = n+1;
+
+   if (tq_sized) {
+      while (run < end && tq.flip[run] == flip &&
+	     tq.ww[run] == tq.ww[n] && tq.hh[run] == tq.hh[n])
+	 run++;
+   } else {
+      while (run < end && tq.flip[run] == flip)
+	 run++;
+   }
+   return run;
 }
 
 void ClearTileQueue(void);
@@ -0,0 +1,217 @@
+/******************************************************************************/
+/*                                                                            */
+/*            ROTBITMAP: rotate / flip the whole screen in one pass           */
+/*                                                                            */
+/******************************************************************************/
+
+#include <stddef.h>
+#include "raine.h"
+#include "rotbitmap.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define BLOCK 32 // 32 columns of src stay in the L1 cache for any depth
+
+/* Position in src of the pixel (rx,ry) of dst */
+
+static void src_pos(BITMAP *src, BITMAP *dst, int rotate, int flip,
+		    int rx, int ry, int *sx, int *sy)
+{
+   int x = (flip & 1 ? dst->w - 1 - rx : rx);
+   int y = (flip & 2 ? dst->h - 1 - ry : ry);
+
+   switch(rotate & 3) {
+   case 0: *sx = x;              *sy = y;              break;
+   case 1: *sx = y;              *sy = src->h - 1 - x; break;
+   case 2: *sx = src->w - 1 - x; *sy = src->h - 1 - y; break;
+   case 3: *sx = src->w - 1 - y; *sy = x;              break;
+   }
+}
+
+/* The pixels of dst from (x1,y1) to (x2,y2) excluded, one by one. org is
+   the address in src of the pixel (0,0) of dst, xstep and ystep the offsets
+   in src for 1 pixel to the right or to the bottom in dst. */
+
+#define PIXELS(TYPE, x1, y1, x2, y2)                                 \
+   for (ry=(y1); ry<(y2); ry++) {                                    \
+      TYPE *d = ((TYPE*)dst->line[ry]) + (x1);                       \
+      UINT8 *s = org + (x1)*xstep + ry*ystep;                        \
+      for (rx=(x1); rx<(x2); rx++, s+=xstep)                          \
+	 *d++ = *(TYPE*)s;                                           \
+   }
+
+#ifdef __SSE2__
+
+/* Transposed tiles : column i of the tile in dst is made of consecutive
+   pixels in src (ystep = +/- the pixel size), so the tile is loaded as
+   columns and transposed into rows. */
+
+static void tile_4x4_32(UINT8 *org, ptrdiff_t xstep, ptrdiff_t ystep,
+			BITMAP *dst, int rx, int ry)
+{
+   UINT8 *s = org + rx*xstep + ry*ystep;
+   __m128i c0,c1,c2,c3,t0,t1,t2,t3;
+
+   if (ystep > 0) {
+      c0 = _mm_loadu_si128((__m128i*)(s));
+      c1 = _mm_loadu_si128((__m128i*)(s+xstep));
+      c2 = _mm_loadu_si128((__m128i*)(s+2*xstep));
+      c3 = _mm_loadu_si128((__m128i*)(s+3*xstep));
+   } else {
+      c0 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)(s-12)),0x1b);
+      c1 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)(s+xstep-12)),0x1b);
+      c2 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)(s+2*xstep-12)),0x1b);
+      c3 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)(s+3*xstep-12)),0x1b);
+   }
+   t0 = _mm_unpacklo_epi32(c0,c1);
+   t1 = _mm_unpacklo_epi32(c2,c3);
+   t2 = _mm_unpackhi_epi32(c0,c1);
+   t3 = _mm_unpackhi_epi32(c2,c3);
+   rx *= 4;
+   _mm_storeu_si128((__m128i*)(dst->line[ry+0]+rx),_mm_unpacklo_epi64(t0,t1));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+1]+rx),_mm_unpackhi_epi64(t0,t1));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+2]+rx),_mm_unpacklo_epi64(t2,t3));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+3]+rx),_mm_unpackhi_epi64(t2,t3));
+}
+
+static DEF_INLINE __m128i load_col_16(UINT8 *s, ptrdiff_t ystep)
+{
+   __m128i c;
+   if (ystep > 0)
+      return _mm_loadu_si128((__m128i*)s);
+   c = _mm_loadu_si128((__m128i*)(s-14));
+   c = _mm_shufflelo_epi16(c,0x1b);
+   c = _mm_shufflehi_epi16(c,0x1b);
+   return _mm_shuffle_epi32(c,0x4e);
+}
+
+static void tile_8x8_16(UINT8 *org, ptrdiff_t xstep, ptrdiff_t ystep,
+			BITMAP *dst, int rx, int ry)
+{
+   UINT8 *s = org + rx*xstep + ry*ystep;
+   __m128i c0,c1,c2,c3,c4,c5,c6,c7,a0,a1,a2,a3,a4,a5,a6,a7;
+
+   c0 = load_col_16(s,ystep); s += xstep;
+   c1 = load_col_16(s,ystep); s += xstep;
+   c2 = load_col_16(s,ystep); s += xstep;
+   c3 = load_col_16(s,ystep); s += xstep;
+   c4 = load_col_16(s,ystep); s += xstep;
+   c5 = load_col_16(s,ystep); s += xstep;
+   c6 = load_col_16(s,ystep); s += xstep;
+   c7 = load_col_16(s,ystep);
+
+   a0 = _mm_unpacklo_epi16(c0,c1);
+   a1 = _mm_unpacklo_epi16(c2,c3);
+   a2 = _mm_unpacklo_epi16(c4,c5);
+   a3 = _mm_unpacklo_epi16(c6,c7);
+   a4 = _mm_unpackhi_epi16(c0,c1);
+   a5 = _mm_unpackhi_epi16(c2,c3);
+   a6 = _mm_unpackhi_epi16(c4,c5);
+   a7 = _mm_unpackhi_epi16(c6,c7);
+
+   c0 = _mm_unpacklo_epi32(a0,a1);
+   c1 = _mm_unpacklo_epi32(a2,a3);
+   c2 = _mm_unpackhi_epi32(a0,a1);
+   c3 = _mm_unpackhi_epi32(a2,a3);
+   c4 = _mm_unpacklo_epi32(a4,a5);
+   c5 = _mm_unpacklo_epi32(a6,a7);
+   c6 = _mm_unpackhi_epi32(a4,a5);
+   c7 = _mm_unpackhi_epi32(a6,a7);
+
+   rx *= 2;
+   _mm_storeu_si128((__m128i*)(dst->line[ry+0]+rx),_mm_unpacklo_epi64(c0,c1));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+1]+rx),_mm_unpackhi_epi64(c0,c1));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+2]+rx),_mm_unpacklo_epi64(c2,c3));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+3]+rx),_mm_unpackhi_epi64(c2,c3));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+4]+rx),_mm_unpacklo_epi64(c4,c5));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+5]+rx),_mm_unpackhi_epi64(c4,c5));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+6]+rx),_mm_unpacklo_epi64(c6,c7));
+   _mm_storeu_si128((__m128i*)(dst->line[ry+7]+rx),_mm_unpackhi_epi64(c6,c7));
+}
+
+#endif
+
+static void block_8(UINT8 *org, ptrdiff_t xstep, ptrdiff_t ystep,
+		    BITMAP *dst, int x1, int y1, int x2, int y2)
+{
+   int rx,ry;
+   PIXELS(UINT8, x1, y1, x2, y2);
+}
+
+static void block_16(UINT8 *org, ptrdiff_t xstep, ptrdiff_t ystep,
+		     BITMAP *dst, int x1, int y1, int x2, int y2)
+{
+   int rx,ry,ex = x1,ey = y1;
+#ifdef __SSE2__
+   ex = x1 + ((x2-x1) & ~7);
+   ey = y1 + ((y2-y1) & ~7);
+   for (ry=y1; ry<ey; ry+=8)
+      for (rx=x1; rx<ex; rx+=8)
+	 tile_8x8_16(org,xstep,ystep,dst,rx,ry);
+#endif
+   PIXELS(UINT16, ex, y1, x2, ey);
+   PIXELS(UINT16, x1, ey, x2, y2);
+}
+
+static void block_32(UINT8 *org, ptrdiff_t xstep, ptrdiff_t ystep,
+		     BITMAP *dst, int x1, int y1, int x2, int y2)
+{
+   int rx,ry,ex = x1,ey = y1;
+#ifdef __SSE2__
+   ex = x1 + ((x2-x1) & ~3);
+   ey = y1 + ((y2-y1) & ~3);
+   for (ry=y1; ry<ey; ry+=4)
+      for (rx=x1; rx<ex; rx+=4)
+	 tile_4x4_32(org,xstep,ystep,dst,rx,ry);
+#endif
+   PIXELS(UINT32, ex, y1, x2, ey);
+   PIXELS(UINT32, x1, ey, x2, y2);
+}
+
+void rotate_bitmap(BITMAP *src, BITMAP *dst, int rotate, int flip,
+		   int x, int y, int w, int h)
+{
+   int bpp = bytes_per_pixel(src);
+   ptrdiff_t pitch = src->line[1] - src->line[0];
+   ptrdiff_t xstep,ystep;
+   int sx,sy,sx1,sy1,sx2,sy2,rx,ry,bx,by;
+   UINT8 *org;
+
+   src_pos(src,dst,rotate,flip,0,0,&sx,&sy);
+   src_pos(src,dst,rotate,flip,1,0,&sx1,&sy1);
+   src_pos(src,dst,rotate,flip,0,1,&sx2,&sy2);
+   org   = src->line[0] + sy*pitch + sx*bpp;
+   xstep = (sy1-sy)*pitch + (sx1-sx)*bpp;
+   ystep = (sy2-sy)*pitch + (sx2-sx)*bpp;
+
+   if (xstep == bpp) {
+      // only a vertical flip
+      for (ry=y; ry<y+h; ry++)
+	 memcpy(dst->line[ry]+x*bpp, org + x*xstep + ry*ystep, w*bpp);
+      return;
+   }
+   if (xstep == -bpp) {
+      // mirrored rows
+      switch(bpp) {
+      case 1: PIXELS(UINT8,  x, y, x+w, y+h); break;
+      case 2: PIXELS(UINT16, x, y, x+w, y+h); break;
+      case 4: PIXELS(UINT32, x, y, x+w, y+h); break;
+      }
+      return;
+   }
+
+   // Odd rotations : the rows of dst are read from columns of src. Done by
+   // blocks so that the columns being read stay in the cache.
+   for (by=y; by<y+h; by+=BLOCK) {
+      int y2 = MIN(by+BLOCK,y+h);
+      for (bx=x; bx<x+w; bx+=BLOCK) {
+	 int x2 = MIN(bx+BLOCK,x+w);
+	 switch(bpp) {
+	 case 1: block_8 (org,xstep,ystep,dst,bx,by,x2,y2); break;
+	 case 2: block_16(org,xstep,ystep,dst,bx,by,x2,y2); break;
+	 case 4: block_32(org,xstep,ystep,dst,bx,by,x2,y2); break;
+	 }
+      }
+   }
+}
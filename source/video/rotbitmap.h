@@ -0,0 +1,23 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_ROTBITMAP_H
+#define VIDEO_ROTBITMAP_H
+
+/* Rotate and flip a whole bitmap, for the games drawn unrotated when the
+   rotation is done at blit time (display_cfg.rotate_at_blit).
+   rotate and flip have the meaning of display_cfg.rotate and display_cfg.flip :
+   the image is rotated first, then flip bit 0 mirrors the x axis and bit 1
+   the y axis of the result.
+   Only the area (x,y,w,h) of dst is updated. src and dst must have the same
+   depth, with sizes swapped for odd rotations. */
+
+void rotate_bitmap(BITMAP *src, BITMAP *dst, int rotate, int flip,
+		   int x, int y, int w, int h);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
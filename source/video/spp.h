@@ -0,0 +1,58 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/******************************************************************************/
+/*                                                                            */
+/*            RAINE 8x8 / 16x16 / 32x32 TILE DRAWING (4BPP PACKED DATA)       */
+/*                                                                            */
+/******************************************************************************/
+
+/*
+
+4bpp packed data : 2 pixels per byte, the high nibble is the left pixel
+[10325476], so a tile takes half the size of the usual 8bpp tile. These are
+the sprites for the regions loaded with GFX_PACKED, the transparent 8x8 ones
+are in spp8x8.h.
+
+*/
+
+#define declare_packed(SIZE,BPP)                                                     \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipX(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipY(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Packed_Mapped_##BPP##_FlipXY(UINT8 *SPR, int x, int y, UINT8 *cmap);
+
+#define declare_packed_trans(SIZE,BPP)                                               \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP(UINT8 *SPR, int x, int y, UINT8 *cmap);        \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipX(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipY(UINT8 *SPR, int x, int y, UINT8 *cmap);  \
+void Draw##SIZE##x##SIZE##_Trans_Packed_Mapped_##BPP##_FlipXY(UINT8 *SPR, int x, int y, UINT8 *cmap);
+
+// 8x8 4bpp Packed Mapped Sprites
+
+declare_packed(8,8)
+declare_packed(8,16)
+declare_packed(8,32)
+
+// 16x16 4bpp Packed Mapped Sprites
+
+declare_packed(16,8)
+declare_packed(16,16)
+declare_packed(16,32)
+declare_packed_trans(16,8)
+declare_packed_trans(16,16)
+declare_packed_trans(16,32)
+
+// 32x32 4bpp Packed Mapped Sprites
+
+declare_packed(32,8)
+declare_packed(32,16)
+declare_packed(32,32)
+declare_packed_trans(32,8)
+declare_packed_trans(32,16)
+declare_packed_trans(32,32)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,320 @@
+/******************************************************************************/
+/*                                                                            */
+/*              TILEMAP: generic cached tile layers (see tilemap.h)           */
+/*                                                                            */
+/******************************************************************************/
+
+#include <string.h>
+#include "raine.h"
+#include "newmem.h"
+#include "palette.h"
+#include "tilemod.h" // internal_bpp
+#include "priorities.h" // pbitmap
+#include "blit.h"
+#include "tilemap.h"
+#include "bands.h"
+
+TILEMAP *tilemap_create(tile_info_func *get_info, void *param, UINT8 *gfx,
+			UINT32 tile_w, UINT32 tile_h,
+			UINT32 cols, UINT32 rows, UINT32 colours, UINT32 flags)
+{
+   TILEMAP *tmap;
+   UINT32 nb = cols*rows;
+
+   tmap = (TILEMAP*)AllocateMem(sizeof(TILEMAP));
+   if (!tmap) return NULL;
+   memset(tmap,0,sizeof(TILEMAP));
+
+   tmap->get_info = get_info;
+   tmap->param = param;
+   tmap->gfx = gfx;
+   tmap->tile_w = tile_w;
+   tmap->tile_h = tile_h;
+   tmap->cols = cols;
+   tmap->rows = rows;
+   tmap->colours = colours;
+   tmap->flags = flags;
+   tmap->width = cols*tile_w;
+   tmap->height = rows*tile_h;
+
+   tmap->tile_code = (UINT32*)AllocateMem(nb*sizeof(UINT32));
+   tmap->tile_attr = (UINT32*)AllocateMem(nb*sizeof(UINT32));
+   tmap->tile_serial = (UINT32*)AllocateMem(nb*sizeof(UINT32));
+   // big enough for 32bpp, so that a change of depth doesn't need a new one
+   tmap->bank_map = (UINT8*)AllocateMem(MAX_COLBANKS*colours*4);
+   tmap->bank_frame = (UINT32*)AllocateMem(MAX_COLBANKS*sizeof(UINT32));
+   tmap->bank_serial = (UINT32*)AllocateMem(MAX_COLBANKS*sizeof(UINT32));
+   if (!tmap->tile_code || !tmap->tile_attr || !tmap->tile_serial ||
+       !tmap->bank_map || !tmap->bank_frame || !tmap->bank_serial) {
+      tilemap_destroy(tmap);
+      return NULL;
+   }
+   if (flags & TILEMAP_TRANSPARENT) {
+      tmap->opaque = (UINT8*)AllocateMem(tmap->width*tmap->height);
+      if (!tmap->opaque) {
+	 tilemap_destroy(tmap);
+	 return NULL;
+      }
+   }
+
+   memset(tmap->bank_map,0,MAX_COLBANKS*colours*4);
+   memset(tmap->bank_frame,0,MAX_COLBANKS*sizeof(UINT32));
+   memset(tmap->bank_serial,0,MAX_COLBANKS*sizeof(UINT32));
+   tmap->frame = 1;
+   tilemap_mark_all_dirty(tmap);
+   return tmap;
+}
+
+void tilemap_destroy(TILEMAP *tmap)
+{
+   if (!tmap) return;
+   FreeMem(tmap->tile_code);
+   FreeMem(tmap->tile_attr);
+   FreeMem(tmap->tile_serial);
+   FreeMem(tmap->bank_map);
+   FreeMem(tmap->bank_frame);
+   FreeMem(tmap->bank_serial);
+   FreeMem(tmap->opaque);
+   FreeMem(tmap->pixels);
+   FreeMem(tmap);
+}
+
+void tilemap_mark_all_dirty(TILEMAP *tmap)
+{
+   memset(tmap->tile_attr,0xff,tmap->cols*tmap->rows*sizeof(UINT32));
+}
+
+void tilemap_mark_tile_dirty(TILEMAP *tmap, UINT32 index)
+{
+   tmap->tile_attr[index] = 0xffffffff;
+}
+
+/* The surface is in the depth of GameBitmap, it must be allocated again
+   when the user changes the video mode */
+
+static int check_surface(TILEMAP *tmap)
+{
+   UINT32 bpp = internal_bpp(display_cfg.bpp);
+
+   if (tmap->pixels && tmap->bpp == bpp)
+      return 1;
+   if (tmap->pixels)
+      FreeMem(tmap->pixels);
+   tmap->bpp = bpp;
+   tmap->pixels = (UINT8*)AllocateMem(tmap->width*tmap->height*bpp/8);
+   tilemap_mark_all_dirty(tmap);
+   return tmap->pixels != NULL;
+}
+
+/* Compare the colours of a bank with the ones seen the last time, only once
+   per frame and per bank. This catches palette ram writes and the pens which
+   move in 8bpp mode. */
+
+static UINT32 get_bank_serial(TILEMAP *tmap, UINT32 bank, UINT8 *map)
+{
+   if (tmap->bank_frame[bank] != tmap->frame) {
+      UINT32 size = tmap->colours*tmap->bpp/8;
+      UINT8 *saved = tmap->bank_map + bank*size;
+
+      tmap->bank_frame[bank] = tmap->frame;
+      if (memcmp(saved,map,size)) {
+	 memcpy(saved,map,size);
+	 tmap->bank_serial[bank]++;
+      }
+   }
+   return tmap->bank_serial[bank];
+}
+
+#define DRAW_TILE(BPP)                                                        \
+static void draw_tile_##BPP(TILEMAP *tmap, UINT32 index, TILEMAP_TILE *tile,     \
+			    UINT8 *map)                                       \
+{                                                                             \
+   UINT32 tw = tmap->tile_w, th = tmap->tile_h, width = tmap->width;          \
+   UINT32 ofs = (index / tmap->cols)*th*width + (index % tmap->cols)*tw;      \
+   UINT8 *src = tmap->gfx + tile->code*tw*th;                                 \
+   int dx = 1, dy = tw;                                                       \
+   UINT32 x,y;                                                                \
+                                                                              \
+   if (tile->flip & TILE_FLIPY) { src += tw-1; dx = -1; }                     \
+   if (tile->flip & TILE_FLIPX) { src += (th-1)*tw; dy = -dy; }               \
+                                                                              \
+   for (y=0; y<th; y++, src += dy, ofs += width) {                            \
+      UINT##BPP *dst = ((UINT##BPP*)tmap->pixels) + ofs;                      \
+      UINT8 *s = src;                                                         \
+      for (x=0; x<tw; x++, s += dx)                                           \
+	 dst[x] = ((UINT##BPP*)map)[*s];                                      \
+      if (tmap->opaque) {                                                     \
+	 UINT8 *op = tmap->opaque + ofs;                                      \
+	 for (x=0, s=src; x<tw; x++, s += dx)                                 \
+	    op[x] = (*s != 0);                                                \
+      }                                                                       \
+   }                                                                          \
+}
+
+DRAW_TILE(8)
+DRAW_TILE(16)
+DRAW_TILE(32)
+
+/* Refresh the tiles which can be seen in the window.
+   Only the rows (or columns) which are really visible are checked, all the
+   columns (or rows) when rowscroll (or colscroll) is used. */
+
+static void update_tiles(TILEMAP *tmap, int scr_x, int scr_y, int w, int h,
+			 INT16 *rowscroll, INT16 *colscroll)
+{
+   UINT32 col0,row0,ncols,nrows,r,c;
+   UINT32 cmask = tmap->cols-1, rmask = tmap->rows-1;
+   TILEMAP_TILE tile;
+   UINT8 *map;
+
+   if (rowscroll) {
+      col0 = 0; ncols = tmap->cols;
+   } else {
+      col0 = (scr_x & (tmap->width-1)) / tmap->tile_w;
+      ncols = ((scr_x & (tmap->tile_w-1)) + w + tmap->tile_w-1) / tmap->tile_w;
+      if (ncols > tmap->cols) ncols = tmap->cols;
+   }
+   if (colscroll) {
+      row0 = 0; nrows = tmap->rows;
+   } else {
+      row0 = (scr_y & (tmap->height-1)) / tmap->tile_h;
+      nrows = ((scr_y & (tmap->tile_h-1)) + h + tmap->tile_h-1) / tmap->tile_h;
+      if (nrows > tmap->rows) nrows = tmap->rows;
+   }
+
+   for (r=0; r<nrows; r++) {
+      UINT32 row = ((row0+r) & rmask)*tmap->cols;
+      for (c=0; c<ncols; c++) {
+	 UINT32 index = row + ((col0+c) & cmask);
+	 UINT32 serial;
+	 UINT32 attr;
+
+	 tmap->get_info(tmap,index,&tile);
+	 MAP_PALETTE_MAPPED_NEW(
+	    tile.bank,
+	    tmap->colours,
+	    map
+	    );
+	 serial = get_bank_serial(tmap,tile.bank,map);
+	 attr = tile.bank | (tile.flip << 16);
+
+	 if (tmap->tile_code[index] == tile.code &&
+	     tmap->tile_attr[index] == attr &&
+	     tmap->tile_serial[index] == serial)
+	    continue;
+
+	 tmap->tile_code[index] = tile.code;
+	 tmap->tile_attr[index] = attr;
+	 tmap->tile_serial[index] = serial;
+
+	 switch(tmap->bpp) {
+	 case 8: draw_tile_8(tmap,index,&tile,map); break;
+	 case 16: draw_tile_16(tmap,index,&tile,map); break;
+	 case 32: draw_tile_32(tmap,index,&tile,map); break;
+	 }
+      }
+   }
+}
+
+/* The copy only reads the surface, so it can be done in bands */
+
+typedef struct COPY_ARGS
+{
+   TILEMAP *tmap;
+   int scr_x, scr_y, x, y, w;
+   INT16 *rowscroll, *colscroll;
+   UINT8 *opaque;
+   UINT8 pri;
+} COPY_ARGS;
+
+#define COPY_LAYER(BPP)                                                       \
+static void copy_layer_##BPP(int start, int end, void *param)                 \
+{                                                                             \
+   COPY_ARGS *a = (COPY_ARGS*)param;                                          \
+   TILEMAP *tmap = a->tmap;                                                   \
+   int scr_x = a->scr_x, scr_y = a->scr_y, x = a->x, y = a->y, w = a->w;      \
+   INT16 *rowscroll = a->rowscroll, *colscroll = a->colscroll;                \
+   UINT8 *opaque = a->opaque, pri = a->pri;                                   \
+   UINT32 width = tmap->width;                                                \
+   UINT32 wmask = width-1, hmask = tmap->height-1;                            \
+   int line,n,i;                                                              \
+                                                                              \
+   for (line=start; line<end; line++) {                                       \
+      UINT##BPP *dst = ((UINT##BPP*)GameBitmap->line[y+line]) + x;            \
+      UINT8 *pdst = (pri ? pbitmap->line[y+line] + x : NULL);                 \
+      int sx = scr_x + (rowscroll ? rowscroll[line] : 0);                     \
+                                                                              \
+      if (colscroll) {                                                        \
+	 for (n=0; n<w; n++) {                                                \
+	    UINT32 ofs = ((scr_y + line + colscroll[n/tmap->tile_w]) & hmask)*width + \
+	       ((sx + n) & wmask);                                            \
+	    if (!opaque || opaque[ofs]) {                                     \
+	       dst[n] = ((UINT##BPP*)tmap->pixels)[ofs];                      \
+	       if (pdst) pdst[n] = pri;                                       \
+	    }                                                                 \
+	 }                                                                    \
+	 continue;                                                            \
+      }                                                                       \
+                                                                              \
+      {                                                                       \
+	 UINT32 row = ((scr_y + line) & hmask)*width;                         \
+	 UINT##BPP *src = ((UINT##BPP*)tmap->pixels) + row;                   \
+	 UINT8 *op = (opaque ? opaque + row : NULL);                          \
+                                                                              \
+	 for (n=0; n<w; ) { /* 1 span until the layer wraps */                \
+	    UINT32 from = (sx + n) & wmask;                                   \
+	    int len = width - from;                                           \
+	    if (len > w-n) len = w-n;                                         \
+	    if (!op) {                                                        \
+	       memcpy(dst+n,src+from,len*sizeof(UINT##BPP));                  \
+	       if (pdst) memset(pdst+n,pri,len);                              \
+	    } else {                                                          \
+	       for (i=0; i<len; i++)                                          \
+		  if (op[from+i]) {                                           \
+		     dst[n+i] = src[from+i];                                  \
+		     if (pdst) pdst[n+i] = pri;                               \
+		  }                                                           \
+	    }                                                                 \
+	    n += len;                                                         \
+	 }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+COPY_LAYER(8)
+COPY_LAYER(16)
+COPY_LAYER(32)
+
+int tilemap_draw(TILEMAP *tmap, int scr_x, int scr_y, int x, int y, int w, int h,
+		 INT16 *rowscroll, INT16 *colscroll, int trans, UINT8 pri)
+{
+   COPY_ARGS args;
+
+   // The surface is not rotated, the _Rot functions are still needed here
+   if (!tmap || DRAW_ROTATE || DRAW_FLIP)
+      return 0;
+   if (pri && !pbitmap)
+      pri = 0;
+   if (!check_surface(tmap))
+      return 0;
+
+   tmap->frame++;
+   update_tiles(tmap,scr_x,scr_y,w,h,rowscroll,colscroll);
+   args.tmap = tmap;
+   args.scr_x = scr_x;
+   args.scr_y = scr_y;
+   args.x = x;
+   args.y = y;
+   args.w = w;
+   args.rowscroll = rowscroll;
+   args.colscroll = colscroll;
+   args.opaque = (trans ? tmap->opaque : NULL);
+   args.pri = pri;
+
+   switch(tmap->bpp) {
+   case 8: render_bands(copy_layer_8,&args,0,h); break;
+   case 16: render_bands(copy_layer_16,&args,0,h); break;
+   case 32: render_bands(copy_layer_32,&args,0,h); break;
+   }
+   return 1;
+}
@@ -0,0 +1,104 @@
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifndef VIDEO_TILEMAP_H
+#define VIDEO_TILEMAP_H
+
+/*
+  Generic tilemap layer with a persistent pre-rendered surface.
+
+  Most of our drivers redraw every visible tile of their scrolling layers at
+  every frame, even when the layer did not change at all. A TILEMAP keeps the
+  whole layer rendered in a surface of the current colour depth, and only the
+  tiles which changed (tile number, colour bank, flip, or the colours of their
+  bank) are drawn again. A frame is then just a copy of the visible window to
+  GameBitmap, with optional rowscroll / colscroll, transparency and priority.
+
+  The driver describes its layer with a callback returning the tile info for
+  a given tile index (row * cols + col). Tiles are 8x8 or 16x16, 1 byte per
+  pixel (the usual decoded gfx), and the size of the layer in pixels must be
+  a power of 2 in both directions so that the scrolling wraps.
+
+  Tiles are checked only when they are visible, so a tile which is changed
+  outside of the screen is drawn only when it scrolls in.
+
+  The surface is unrotated, so tilemap_draw returns 0 when the screen is
+  rotated or flipped, and the driver must then use its usual _Rot drawing.
+  Memory comes from AllocateMem, so it's freed when the driver is unloaded.
+*/
+
+// Same meaning as the _FlipX / _FlipY sprite functions :
+// FlipX mirrors the rows (vertical), FlipY mirrors the columns (horizontal)
+#define TILE_FLIPX      0x01
+#define TILE_FLIPY      0x02
+
+#define TILEMAP_TRANSPARENT 0x01  // keep the opaque pixels, for transparent draws
+
+typedef struct TILEMAP_TILE
+{
+   UINT32 code;                 // Tile number in gfx
+   UINT16 bank;                 // Colour bank (MAP_PALETTE_MAPPED_NEW)
+   UINT8 flip;                  // TILE_FLIPX / TILE_FLIPY
+} TILEMAP_TILE;
+
+struct TILEMAP;
+
+typedef void tile_info_func(struct TILEMAP *tmap, UINT32 index, TILEMAP_TILE *tile);
+
+typedef struct TILEMAP
+{
+   tile_info_func *get_info;    // fills the TILEMAP_TILE of a tile index
+   void *param;                 // free for the driver (ram base...)
+   UINT8 *gfx;                  // decoded tiles, 1 byte per pixel
+   UINT32 tile_w, tile_h;       // 8 or 16
+   UINT32 cols, rows;           // size of the layer in tiles
+   UINT32 colours;              // colours per bank
+   UINT32 flags;                // TILEMAP_TRANSPARENT
+
+   // private data, don't touch from the drivers
+
+   UINT32 width, height;        // size in pixels
+   UINT32 bpp;                  // depth of the surface (8, 16 or 32)
+   UINT8 *pixels;               // pre-rendered layer
+   UINT8 *opaque;               // 1 byte per pixel, only when transparent
+   UINT32 *tile_code;           // last drawn tile, per tile index
+   UINT32 *tile_attr;           // last drawn bank | flip<<16, ~0 = dirty
+   UINT32 *tile_serial;         // bank_serial when the tile was drawn
+   UINT8 *bank_map;             // colours of the banks when they were compared
+   UINT32 *bank_frame;          // last frame where the bank was compared
+   UINT32 *bank_serial;         // incremented each time the bank colours change
+   UINT32 frame;
+} TILEMAP;
+
+TILEMAP *tilemap_create(tile_info_func *get_info, void *param, UINT8 *gfx,
+			UINT32 tile_w, UINT32 tile_h,
+			UINT32 cols, UINT32 rows, UINT32 colours, UINT32 flags);
+
+// Free a tilemap (the pool frees them anyway when the driver is unloaded)
+
+void tilemap_destroy(TILEMAP *tmap);
+
+// Force a redraw of all the tiles (ram tiles changed, state load...)
+
+void tilemap_mark_all_dirty(TILEMAP *tmap);
+
+void tilemap_mark_tile_dirty(TILEMAP *tmap, UINT32 index);
+
+/* Copy the window starting at (scr_x,scr_y) in the layer to (x,y,w,h) in
+   GameBitmap. rowscroll (can be NULL) has 1 entry per screen line, added to
+   scr_x. colscroll (can be NULL) has 1 entry per tile_w screen columns, added
+   to scr_y. If trans is set (and the tilemap was created TILEMAP_TRANSPARENT)
+   pen 0 is not drawn. If pri is not 0, pbitmap receives pri where the layer
+   is drawn.
+   Returns 0 if the tilemap can't draw (rotated screen), the driver must
+   then draw the layer itself. */
+
+int tilemap_draw(TILEMAP *tmap, int scr_x, int scr_y, int x, int y, int w, int h,
+		 INT16 *rowscroll, INT16 *colscroll, int trans, UINT8 pri);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
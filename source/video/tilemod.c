@@ -6,6 +6,8 @@
 
 #include "gameinc.h"
 #include "tilemod.h"
+#include "bands.h"
+#include "lazygfx.h"
 #ifdef RAINE_DEBUG
 #include "debug.h"
 #endif
@@ -61,10 +63,31 @@ static struct TILE_INFO tile_32x32_template =
    0,
 };
 
+/* 4bpp packed tiles : 2 pixels per byte, the high nibble is the left one */
+
+static void unpack_4bpp(UINT8 *dst, const UINT8 *src, UINT32 size)
+{
+   UINT32 ta;
+
+   for(ta=0; ta<size; ta+=2){
+      dst[ta+0] = src[ta>>1] >> 4;
+      dst[ta+1] = src[ta>>1] & 15;
+   }
+}
+
+static void pack_4bpp(UINT8 *dst, const UINT8 *src, UINT32 size)
+{
+   UINT32 ta;
+
+   for(ta=0; ta<size; ta+=2)
+      dst[ta>>1] = (src[ta+0] << 4) | (src[ta+1] & 15);
+}
+
 static void do_rotate(TILE_INFO *tile, UINT32 rotate)
 {
    UINT32 count,size,x,y,ta,tb,tc;
-   UINT8 *src,*buffer;
+   UINT8 *src,*dst,*buffer;
+   int packed;
 
    if(!rotate) return;
 
@@ -73,12 +96,21 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
    count = tile->count;
    size  = x * y;
    src   = tile->data;
+   packed = TILE_TYPE_PACKED(tile->type);
 
-   if(!(buffer=AllocateMem(size))) return;
+   // packed tiles are unpacked in buffer and transformed in the 2nd half
+   if(!(buffer=AllocateMem(packed ? size*2 : size))) return;
 
    for(tc=0;tc<count;tc++){
 
-   memcpy(buffer, src, size);
+   if(packed){
+      unpack_4bpp(buffer, src, size);
+      dst = buffer + size;
+   }
+   else{
+      memcpy(buffer, src, size);
+      dst = src;
+   }
 
    switch(rotate){
    case 1:
@@ -86,7 +118,7 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ (((x-1)-ta)*y) + tb ];
+            dst[ ta + (tb*x) ] = buffer[ (((x-1)-ta)*y) + tb ];
 
          }
 
@@ -97,7 +129,7 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (((y-1)-tb)*x) ];
+            dst[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (((y-1)-tb)*x) ];
 
          }
 
@@ -108,7 +140,7 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ (ta*y) + ((y-1)-tb) ];
+            dst[ ta + (tb*x) ] = buffer[ (ta*y) + ((y-1)-tb) ];
 
          }
 
@@ -116,7 +148,12 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
    break;
    }
 
-   src += size;
+   if(packed){
+      pack_4bpp(src, dst, size);
+      src += size / 2;
+   }
+   else
+      src += size;
 
    }
 
@@ -126,7 +163,8 @@ static void do_rotate(TILE_INFO *tile, UINT32 rotate)
 static void do_flip(TILE_INFO *tile, UINT32 flip)
 {
    UINT32 count,size,x,y,ta,tb,tc;
-   UINT8 *src,*buffer;
+   UINT8 *src,*dst,*buffer;
+   int packed;
 
    if(!flip) return;
 
@@ -135,12 +173,21 @@ static void do_flip(TILE_INFO *tile, UINT32 flip)
    count = tile->count;
    size  = x * y;
    src   = tile->data;
+   packed = TILE_TYPE_PACKED(tile->type);
 
-   if(!(buffer=AllocateMem(size))) return;
+   // packed tiles are unpacked in buffer and transformed in the 2nd half
+   if(!(buffer=AllocateMem(packed ? size*2 : size))) return;
 
    for(tc=0;tc<count;tc++){
 
-   memcpy(buffer, src, size);
+   if(packed){
+      unpack_4bpp(buffer, src, size);
+      dst = buffer + size;
+   }
+   else{
+      memcpy(buffer, src, size);
+      dst = src;
+   }
 
    switch(flip){
    case 1:
@@ -148,7 +195,7 @@ static void do_flip(TILE_INFO *tile, UINT32 flip)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (tb*x) ];
+            dst[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (tb*x) ];
 
          }
 
@@ -159,7 +206,7 @@ static void do_flip(TILE_INFO *tile, UINT32 flip)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ ta + (((y-1)-tb)*x) ];
+            dst[ ta + (tb*x) ] = buffer[ ta + (((y-1)-tb)*x) ];
 
          }
 
@@ -170,7 +217,7 @@ static void do_flip(TILE_INFO *tile, UINT32 flip)
 
          for(ta=0; ta<x; ta++){
 
-            src[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (((y-1)-tb)*x) ];
+            dst[ ta + (tb*x) ] = buffer[ ((x-1)-ta) + (((y-1)-tb)*x) ];
 
          }
 
@@ -178,7 +225,12 @@ static void do_flip(TILE_INFO *tile, UINT32 flip)
    break;
    }
 
-   src += size;
+   if(packed){
+      pack_4bpp(src, dst, size);
+      src += size / 2;
+   }
+   else
+      src += size;
 
    }
 
@@ -488,6 +540,9 @@ char *tile_type[TILE_TYPE_MAX] =
    " 8 x  8 (8bpp)",
    "16 x 16 (8bpp)",
    "32 x 32 (8bpp)",
+   " 8 x  8 (4bpp)",
+   "16 x 16 (4bpp)",
+   "32 x 32 (4bpp)",
 };
 
 void check_tile_rotation(void)
@@ -502,11 +557,11 @@ void check_tile_rotation(void)
 
    for( i = 0; i < tile_list_count; i ++){
 
-      j  = display_cfg.rotate;
+      j  = DRAW_ROTATE;
       j -= tile_list[i].rotate;
       j &= 3;
 
-      k  = display_cfg.flip;
+      k  = DRAW_FLIP;
       k -= tile_list[i].flip;
       k &= 3;
 
@@ -516,15 +571,17 @@ void check_tile_rotation(void)
 
          do_rotate(&tile_list[i], j);
 
-         do_flip(&tile_list[i], display_cfg.flip);
+         do_flip(&tile_list[i], DRAW_FLIP);
 
-         tile_list[i].rotate = display_cfg.rotate;
-         tile_list[i].flip   = display_cfg.flip;
+         tile_list[i].rotate = DRAW_ROTATE;
+         tile_list[i].flip   = DRAW_FLIP;
 
       }
 
    }
 
+   lazy_gfx_flush();
+
    /*
 
    rotate and flip the template tiles (used for building correctly
@@ -539,11 +596,11 @@ void check_tile_rotation(void)
    tile_8x8_template.rotate = 0;
    tile_8x8_template.flip = 0;
 
-   do_rotate(&tile_8x8_template, (0 - display_cfg.rotate) & 3);
-   do_flip(&tile_8x8_template, display_cfg.flip);
+   do_rotate(&tile_8x8_template, (0 - DRAW_ROTATE) & 3);
+   do_flip(&tile_8x8_template, DRAW_FLIP);
 
-   tile_8x8_template.rotate = display_cfg.rotate;
-   tile_8x8_template.flip = display_cfg.flip;
+   tile_8x8_template.rotate = DRAW_ROTATE;
+   tile_8x8_template.flip = DRAW_FLIP;
 
 
    for(i = 0; i < (16 * 16); i++)
@@ -553,11 +610,11 @@ void check_tile_rotation(void)
    tile_16x16_template.rotate = 0;
    tile_16x16_template.flip = 0;
 
-   do_rotate(&tile_16x16_template, (0 - display_cfg.rotate) & 3);
-   do_flip(&tile_16x16_template, display_cfg.flip);
+   do_rotate(&tile_16x16_template, (0 - DRAW_ROTATE) & 3);
+   do_flip(&tile_16x16_template, DRAW_FLIP);
 
-   tile_16x16_template.rotate = display_cfg.rotate;
-   tile_16x16_template.flip = display_cfg.flip;
+   tile_16x16_template.rotate = DRAW_ROTATE;
+   tile_16x16_template.flip = DRAW_FLIP;
 
    for(i = 0; i < (32 * 32); i++)
 
@@ -566,11 +623,11 @@ void check_tile_rotation(void)
    tile_32x32_template.rotate = 0;
    tile_32x32_template.flip = 0;
 
-   do_rotate(&tile_32x32_template, (0 - display_cfg.rotate) & 3);
-   do_flip(&tile_32x32_template, display_cfg.flip);
+   do_rotate(&tile_32x32_template, (0 - DRAW_ROTATE) & 3);
+   do_flip(&tile_32x32_template, DRAW_FLIP);
 
-   tile_32x32_template.rotate = display_cfg.rotate;
-   tile_32x32_template.flip = display_cfg.flip;
+   tile_32x32_template.rotate = DRAW_ROTATE;
+   tile_32x32_template.flip = DRAW_FLIP;
 
 }
 
@@ -819,6 +876,40 @@ UINT8 *make_solid_mask_64x64_4bpp(UINT8 *source, UINT32 count)
    return make_solid_mask_4bpp(source,count,64*64);
 }
 
+UINT8 *make_solid_mask_packed(UINT8 *source, UINT32 count, UINT32 width, UINT32 height)
+{
+   UINT8 *map = NULL;
+   int nb;
+
+   for (nb=0; nb<MAX_GFX; nb++) {
+     if (source == gfx[nb]) {
+       map = gfx_solid[nb]; // from the gfx cache
+       break;
+     }
+   }
+   if (!map)
+     map = make_solid_mask_4bpp(source,count,width*height);
+   if (nb < MAX_GFX)
+     gfx_solid[nb] = map;
+
+   if (width == height && (width == 8 || width == 16 || width == 32)) {
+      tile_list[tile_list_count].count  = count;
+      tile_list[tile_list_count].type   = (width == 8 ? TILE_TYPE_8x8_4BPP :
+					   width == 16 ? TILE_TYPE_16x16_4BPP :
+					   TILE_TYPE_32x32_4BPP);
+      tile_list[tile_list_count].width  = width;
+      tile_list[tile_list_count].height = height;
+      tile_list[tile_list_count].data   = source;
+      tile_list[tile_list_count].mask   = map;
+      tile_list[tile_list_count].rotate = 0;
+      tile_list[tile_list_count].flip   = 0;
+
+      tile_list_count++;
+   }
+
+   return map;
+}
+
 
 UINT8 *make_colour_count(UINT8 *source, UINT32 count, UINT32 size)
 {
@@ -882,7 +973,7 @@ typedef struct GFX_ELEMENT
 } GFX_ELEMENT;
 
 
-static void decodechar(GFX_ELEMENT *gfx, int num, const UINT8 *src, const GFX_LAYOUT *gl)
+static void decodechar(GFX_ELEMENT *gfx, UINT8 *dest, int num, const UINT8 *src, const GFX_LAYOUT *gl)
 {
    int plane,x,y;
    UINT8 *dp;
@@ -892,7 +983,7 @@ static void decodechar(GFX_ELEMENT *gfx, int num, const UINT8 *src, const GFX_LA
    xoffset = gl->xoffset;
    yoffset = gl->yoffset;
 
-   dp = gfx->gfxdata + num * gfx->char_modulo;
+   dp = dest;
    memset(dp,0,gfx->height * gfx->line_modulo);
 
    baseoffs = num * gl->charincrement;
@@ -902,7 +993,7 @@ static void decodechar(GFX_ELEMENT *gfx, int num, const UINT8 *src, const GFX_LA
       int shiftedbit = 1 << (gl->planes-1-plane);
       int offs = baseoffs + gl->planeoffset[plane];
 
-      dp = gfx->gfxdata + num * gfx->char_modulo + (gfx->height-1) * gfx->line_modulo;
+      dp = dest + (gfx->height-1) * gfx->line_modulo;
 
       y = gfx->height;
       while (--y >= 0)
@@ -921,11 +1012,131 @@ static void decodechar(GFX_ELEMENT *gfx, int num, const UINT8 *src, const GFX_LA
    }
 }
 
-UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *layout,UINT32 *dest_size)
+/*
+
+Faster decoders for the 2 usual kinds of layouts :
+ - chunky : the bits of all the planes of a pixel follow each other (packed
+   nibbles, bytes...), so a pixel is read at once instead of bit by bit.
+ - planar : every row of 8 pixels of a plane is a whole byte, which is
+   expanded to 8 pixels with a table, the planes are or'ed 8 pixels at a time
+   in a 64 bit word.
+
+*/
+
+enum
+{
+   DECODE_GENERIC = 0,
+   DECODE_CHUNKY,
+   DECODE_PLANAR,
+};
+
+typedef struct DECODE_JOB
+{
+   GFX_ELEMENT *gfx;
+   const UINT8 *src;
+   const GFX_LAYOUT *gl;
+   int mode;
+   int packed;			// 4bpp packed output
+} DECODE_JOB;
+
+static UINT64 expand_byte[256];	// bit 7-n of the index -> byte n
+
+static inline int readbits(const UINT8 *src, int bitnum, int nb)
+{
+   int shift = 16 - (bitnum & 7) - nb;
+   int v = src[bitnum >> 3] << 8;
+   if (shift < 8) // the next byte is needed
+      v |= src[(bitnum >> 3) + 1];
+   return (v >> shift) & ((1 << nb) - 1);
+}
+
+static int get_decode_mode(const GFX_LAYOUT *gl)
+{
+   int n, x, y;
+
+   if (gl->planes > 8)
+      return DECODE_GENERIC;
+
+   for (n = 1; n < gl->planes; n++)
+      if (gl->planeoffset[n] != gl->planeoffset[0] + n)
+	 break;
+   if (n == gl->planes)
+      return DECODE_CHUNKY;
+
+   if ((gl->width & 7) || (gl->charincrement & 7))
+      return DECODE_GENERIC;
+   for (n = 0; n < gl->planes; n++)
+      if (gl->planeoffset[n] & 7)
+	 return DECODE_GENERIC;
+   for (y = 0; y < gl->height; y++)
+      if (gl->yoffset[y] & 7)
+	 return DECODE_GENERIC;
+   for (x = 0; x < gl->width; x++)
+      if (gl->xoffset[x] != gl->xoffset[x & ~7] + (x & 7) || (gl->xoffset[x & ~7] & 7))
+	 return DECODE_GENERIC;
+   return DECODE_PLANAR;
+}
+
+static void decode_chunky(GFX_ELEMENT *gfx, UINT8 *dp, int num, const UINT8 *src, const GFX_LAYOUT *gl)
+{
+   int x, y;
+   int offs = num * gl->charincrement + gl->planeoffset[0];
+
+   for (y = 0; y < gfx->height; y++, dp += gfx->line_modulo) {
+      int offs2 = offs + gl->yoffset[y];
+      for (x = 0; x < gfx->width; x++)
+	 dp[x] = readbits(src, offs2 + gl->xoffset[x], gl->planes);
+   }
+}
+
+static void decode_planar(GFX_ELEMENT *gfx, UINT8 *dp, int num, const UINT8 *src, const GFX_LAYOUT *gl)
+{
+   int plane, x, y;
+   int baseoffs = num * gl->charincrement;
+
+   for (y = 0; y < gfx->height; y++, dp += gfx->line_modulo) {
+      for (x = 0; x < gfx->width; x += 8) {
+	 int offs = (baseoffs + gl->yoffset[y] + gl->xoffset[x]) >> 3;
+	 UINT64 pixels = 0;
+	 for (plane = 0; plane < gl->planes; plane++)
+	    pixels |= expand_byte[src[offs + (gl->planeoffset[plane] >> 3)]] << (gl->planes-1-plane);
+	 memcpy(dp + x, &pixels, 8);
+      }
+   }
+}
+
+static void decode_char(DECODE_JOB *job, UINT8 *dest, int c)
+{
+   switch(job->mode) {
+   case DECODE_CHUNKY:
+      decode_chunky(job->gfx, dest, c, job->src, job->gl);
+      break;
+   case DECODE_PLANAR:
+      decode_planar(job->gfx, dest, c, job->src, job->gl);
+      break;
+   default:
+      decodechar(job->gfx, dest, c, job->src, job->gl);
+   }
+}
+
+static void decode_chars(int start, int end, void *param)
+{
+   DECODE_JOB *job = (DECODE_JOB*)param;
+   GFX_ELEMENT *gfx = job->gfx;
+   UINT8 tmp[MAX_GFX_SIZE * MAX_GFX_SIZE];
+   int c;
+
+   for (c = start; c < end; c++) {
+      if (job->packed) {
+	 decode_char(job, tmp, c);
+	 pack_4bpp(gfx->gfxdata + c * gfx->char_modulo / 2, tmp, gfx->char_modulo);
+      } else
+	 decode_char(job, gfx->gfxdata + c * gfx->char_modulo, c);
+   }
+}
+
+int prepare_gfx_layout(GFX_LAYOUT *gl, const GFX_LAYOUT *layout, UINT32 src_size)
 {
-   GFX_ELEMENT gfx;
-   gfx_layout gl;
-   UINT8 *gfx_data;
    UINT32 c, j, reglen;
 
    /*
@@ -936,34 +1147,73 @@ UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *lay
 
    reglen = 8 * src_size;
 
-   memcpy(&gl, layout, sizeof(gl));
+   memcpy(gl, layout, sizeof(*gl));
 
-   if (IS_FRAC(gl.total))
-      gl.total = reglen / gl.charincrement * FRAC_NUM(gl.total) / FRAC_DEN(gl.total);
+   if (IS_FRAC(gl->total))
+      gl->total = reglen / gl->charincrement * FRAC_NUM(gl->total) / FRAC_DEN(gl->total);
 
    for (j = 0;j < MAX_GFX_PLANES;j++)
    {
-      if (IS_FRAC(gl.planeoffset[j]))
+      if (IS_FRAC(gl->planeoffset[j]))
       {
-         gl.planeoffset[j] = FRAC_OFFSET(gl.planeoffset[j]) +
-               reglen * FRAC_NUM(gl.planeoffset[j]) / FRAC_DEN(gl.planeoffset[j]);
+         gl->planeoffset[j] = FRAC_OFFSET(gl->planeoffset[j]) +
+               reglen * FRAC_NUM(gl->planeoffset[j]) / FRAC_DEN(gl->planeoffset[j]);
       }
    }
 
    for (j = 0;j < MAX_GFX_SIZE;j++)
    {
-      if (IS_FRAC(gl.xoffset[j]))
+      if (IS_FRAC(gl->xoffset[j]))
       {
-         gl.xoffset[j] = FRAC_OFFSET(gl.xoffset[j]) +
-               reglen * FRAC_NUM(gl.xoffset[j]) / FRAC_DEN(gl.xoffset[j]);
+         gl->xoffset[j] = FRAC_OFFSET(gl->xoffset[j]) +
+               reglen * FRAC_NUM(gl->xoffset[j]) / FRAC_DEN(gl->xoffset[j]);
       }
-      if (IS_FRAC(gl.yoffset[j]))
+      if (IS_FRAC(gl->yoffset[j]))
       {
-         gl.yoffset[j] = FRAC_OFFSET(gl.yoffset[j]) +
-               reglen * FRAC_NUM(gl.yoffset[j]) / FRAC_DEN(gl.yoffset[j]);
+         gl->yoffset[j] = FRAC_OFFSET(gl->yoffset[j]) +
+               reglen * FRAC_NUM(gl->yoffset[j]) / FRAC_DEN(gl->yoffset[j]);
       }
    }
 
+   if (!expand_byte[1]) {
+      for (c = 0; c < 256; c++) {
+	 UINT8 *p = (UINT8*)&expand_byte[c];
+	 for (j = 0; j < 8; j++)
+	    p[j] = (c >> (7-j)) & 1;
+      }
+   }
+   return get_decode_mode(gl);
+}
+
+void decode_tile(const GFX_LAYOUT *gl, int mode, const UINT8 *src, int num, UINT8 *dest)
+{
+   GFX_ELEMENT gfx;
+   DECODE_JOB job;
+
+   memset(&gfx, 0, sizeof(gfx));
+   gfx.width = gl->width;
+   gfx.height = gl->height;
+   gfx.line_modulo = gfx.width;
+   gfx.char_modulo = gfx.line_modulo * gfx.height;
+
+   job.gfx = &gfx;
+   job.src = src;
+   job.gl = gl;
+   job.mode = mode;
+   job.packed = 0;
+   decode_char(&job, dest, num);
+}
+
+static UINT8 *decode_gfx_common(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *layout,UINT32 *dest_size, int packed)
+{
+   GFX_ELEMENT gfx;
+   gfx_layout gl;
+   UINT8 *gfx_data;
+   UINT32 reglen;
+   DECODE_JOB job;
+
+   job.mode = prepare_gfx_layout(&gl, layout, src_size);
+
    /*
 
    some setup then decode
@@ -979,6 +1229,8 @@ UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *lay
    gfx.char_modulo = gfx.line_modulo * gfx.height;
 
    reglen = gl.total * gfx.char_modulo * sizeof(UINT8);
+   if (packed)
+     reglen /= 2;
    gfx_data = AllocateMem(reglen);
    if (dest_size)
      *dest_size = reglen; // for get_region_size
@@ -989,12 +1241,31 @@ UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *lay
    }
 
    gfx.gfxdata = gfx_data;
-   for (c = 0;c < gl.total;c++)
-      decodechar(&gfx, c, src, &gl);
+   job.gfx = &gfx;
+   job.src = src;
+   job.gl = &gl;
+   job.packed = packed;
+   // the chars are independent, they are split between the render threads
+   render_bands(decode_chars, &job, 0, gl.total);
 
    return gfx_data;
 }
 
+UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *layout,UINT32 *dest_size)
+{
+   return decode_gfx_common(src, src_size, layout, dest_size, 0);
+}
+
+UINT8 *decode_gfx_packed(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *layout,UINT32 *dest_size)
+{
+   if (layout->planes > 4 || (layout->width & 1)) {
+      print_debug("decode_gfx_packed: %d planes, %dx%d can't be packed\n",
+		  layout->planes, layout->width, layout->height);
+      return NULL;
+   }
+   return decode_gfx_common(src, src_size, layout, dest_size, 1);
+}
+
 /*
 
 convert real bpp -> internal bpp
@@ -21,9 +21,14 @@ enum tile_type_num
    TILE_TYPE_8x8,
    TILE_TYPE_16x16,
    TILE_TYPE_32x32,
+   TILE_TYPE_8x8_4BPP,		// 4bpp packed
+   TILE_TYPE_16x16_4BPP,
+   TILE_TYPE_32x32_4BPP,
    TILE_TYPE_MAX,
 };
 
+#define TILE_TYPE_PACKED(type) ((type) >= TILE_TYPE_8x8_4BPP)
+
 extern char *tile_type[TILE_TYPE_MAX];
 extern int max_tile_sprites;
 
@@ -102,6 +107,8 @@ UINT8 *make_solid_mask_64x64(UINT8 *source, UINT32 count);
 UINT8 *make_solid_mask_8x8_4bpp(UINT8 *source, UINT32 count);
 UINT8 *make_solid_mask_16x16_4bpp(UINT8 *source, UINT32 count);
 UINT8 *make_solid_mask_64x64_4bpp(UINT8 *source, UINT32 count);
+// solid mask of a region loaded with GFX_PACKED, rotated with the game
+UINT8 *make_solid_mask_packed(UINT8 *source, UINT32 count, UINT32 width, UINT32 height);
 
 UINT8 *make_solid_mask_pad_8x8(UINT8 *source, UINT32 count, UINT32 pad_size);
 UINT8 *make_solid_mask_pad_16x16(UINT8 *source, UINT32 count, UINT32 pad_size);
@@ -121,7 +128,17 @@ UINT8 *make_colour_count_16x16(UINT8 *source, UINT32 count);
 UINT8 check_tile_solid(UINT8 *src, UINT32 size);
 void check_tile_rotation(void);
 
+UINT32 get_pad_size(UINT32 count);
+
 UINT8 *decode_gfx(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *gfx_layout,UINT32 *dest_size);
+// same thing, 4bpp packed (2 pixels per byte), NULL if more than 4 planes
+UINT8 *decode_gfx_packed(const UINT8 *src, const UINT32 src_size, const GFX_LAYOUT *gfx_layout,UINT32 *dest_size);
+
+// Decoding of single chars (tilecache.c) : prepare_gfx_layout resolves the
+// offsets given as fractions of the size of the source in gl and returns the
+// mode to pass to decode_tile, which decodes char num to dest (1 byte/pixel)
+int prepare_gfx_layout(GFX_LAYOUT *gl, const GFX_LAYOUT *layout, UINT32 src_size);
+void decode_tile(const GFX_LAYOUT *gl, int mode, const UINT8 *src, int num, UINT8 *dest);
 
 int get_mask(int v);
 